@@ -0,0 +1,217 @@
+#include "Benchmark.hpp"
+
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <utility>
+
+namespace Benchmarks
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Calls in one sample are repeated until it takes about this long.
+constexpr double SampleNanoseconds = 1e7;
+
+double Elapsed(Clock::time_point begin, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::nano>(end - begin).count();
+}
+
+double Median(std::vector<double> samples)
+{
+    const auto middle = samples.begin() + samples.size() / 2;
+    std::nth_element(samples.begin(), middle, samples.end());
+
+    return *middle;
+}
+
+std::size_t CallCount(double firstNanoseconds)
+{
+    return static_cast<std::size_t>(
+        std::max(1.0, SampleNanoseconds / std::max(firstNanoseconds, 1.0)));
+}
+
+// Names only hold printable ASCII, so quotes and backslashes are the only
+// characters that need escaping.
+std::string Quote(const std::string& text)
+{
+    std::string result = "\"";
+
+    for (const char character : text)
+    {
+        if (character == '"' || character == '\\')
+        {
+            result += '\\';
+        }
+
+        result += character;
+    }
+
+    return result + "\"";
+}
+
+std::string Number(double value)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.6g", value);
+
+    return buffer;
+}
+}  // namespace
+
+Suite::Suite(std::string filter, std::size_t numSample)
+    : m_filter(std::move(filter)),
+      m_numSample(std::max<std::size_t>(numSample, 1)),
+      m_clockOverhead(0.0)
+{
+    std::vector<double> samples(1001);
+
+    for (auto& sample : samples)
+    {
+        const auto begin = Clock::now();
+        const auto end = Clock::now();
+
+        sample = Elapsed(begin, end);
+    }
+
+    m_clockOverhead = Median(samples);
+}
+
+void Suite::Run(const std::string& op, const std::string& shape,
+                std::size_t numElement, double numFlop, double numByte,
+                const std::function<void()>& run)
+{
+    if (!IsSelected(op, shape))
+    {
+        return;
+    }
+
+    // The first call warms the caches and sizes the groups.
+    const auto first = Clock::now();
+    run();
+    const std::size_t numCall = CallCount(Elapsed(first, Clock::now()));
+
+    std::vector<double> samples(m_numSample);
+
+    for (auto& sample : samples)
+    {
+        const auto begin = Clock::now();
+
+        for (std::size_t index = 0; index < numCall; ++index)
+        {
+            run();
+        }
+
+        sample = Elapsed(begin, Clock::now()) / numCall;
+    }
+
+    Record({ op, shape, numElement, numFlop, numByte, Median(samples) });
+}
+
+void Suite::Run(const std::string& op, const std::string& shape,
+                std::size_t numElement, double numFlop, double numByte,
+                const std::function<void()>& setup,
+                const std::function<void()>& run)
+{
+    if (!IsSelected(op, shape))
+    {
+        return;
+    }
+
+    setup();
+    const auto first = Clock::now();
+    run();
+    const std::size_t numCall = CallCount(Elapsed(first, Clock::now()));
+
+    std::vector<double> samples(m_numSample);
+
+    for (auto& sample : samples)
+    {
+        double total = 0.0;
+
+        for (std::size_t index = 0; index < numCall; ++index)
+        {
+            setup();
+
+            const auto begin = Clock::now();
+            run();
+            total += Elapsed(begin, Clock::now()) - m_clockOverhead;
+        }
+
+        sample = std::max(total / numCall, 0.0);
+    }
+
+    Record({ op, shape, numElement, numFlop, numByte, Median(samples) });
+}
+
+const std::vector<Result>& Suite::Results() const noexcept
+{
+    return m_results;
+}
+
+void Suite::WriteJSON(std::ostream& stream) const
+{
+    const auto isa = CubbyDNN::Compute::KernelRegistry::Active().isa;
+
+    stream << "{\n  \"context\": {\n    \"isa\": "
+           << Quote(std::string(CubbyDNN::Compute::CPUInfo::Name(isa)))
+           << ",\n    \"threads\": " << std::thread::hardware_concurrency()
+           << ",\n    \"samples\": " << m_numSample
+           << "\n  },\n  \"benchmarks\": [";
+
+    for (std::size_t index = 0; index < m_results.size(); ++index)
+    {
+        const auto& result = m_results[index];
+        const double seconds = result.nanoseconds * 1e-9;
+
+        stream << (index ? ",\n" : "\n") << "    {\n      \"op\": "
+               << Quote(result.op) << ",\n      \"shape\": "
+               << Quote(result.shape)
+               << ",\n      \"elements\": " << result.numElement
+               << ",\n      \"ns\": " << Number(result.nanoseconds)
+               << ",\n      \"gflops\": "
+               << (result.numFlop > 0.0
+                       ? Number(result.numFlop / seconds * 1e-9)
+                       : "null")
+               << ",\n      \"gbps\": "
+               << Number(result.numByte / seconds * 1e-9)
+               << ",\n      \"bytes_per_element\": "
+               << Number(result.numByte / result.numElement)
+               << ",\n      \"ns_per_element\": "
+               << Number(result.nanoseconds / result.numElement)
+               << "\n    }";
+    }
+
+    stream << "\n  ]\n}\n";
+}
+
+bool Suite::IsSelected(const std::string& op, const std::string& shape) const
+{
+    return (op + "/" + shape).find(m_filter) != std::string::npos;
+}
+
+void Suite::Record(Result result)
+{
+    const double seconds = result.nanoseconds * 1e-9;
+    char gflops[16] = "-";
+
+    if (result.numFlop > 0.0)
+    {
+        std::snprintf(gflops, sizeof(gflops), "%.2f",
+                      result.numFlop / seconds * 1e-9);
+    }
+
+    std::printf("%-20s %-22s %14.1f %10s %10.2f %12.3f\n", result.op.c_str(),
+                result.shape.c_str(), result.nanoseconds, gflops,
+                result.numByte / seconds * 1e-9,
+                result.nanoseconds / result.numElement);
+    std::fflush(stdout);
+
+    m_results.emplace_back(std::move(result));
+}
+}  // namespace Benchmarks
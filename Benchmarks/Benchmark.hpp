@@ -0,0 +1,82 @@
+#ifndef CUBBYDNN_BENCHMARK_HPP
+#define CUBBYDNN_BENCHMARK_HPP
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+//! One timed operation. numFlop is 0 where a FLOP count has no meaning
+//! (element-wise nodes); numByte is the compulsory traffic, every operand
+//! read once and every destination written once (twice when accumulated).
+struct Result
+{
+    std::string op;
+    std::string shape;
+    //! The destination of a product, the input of a node.
+    std::size_t numElement;
+    double numFlop;
+    double numByte;
+    //! Median latency of one call.
+    double nanoseconds;
+};
+
+class Suite
+{
+ public:
+    Suite(std::string filter, std::size_t numSample);
+
+    //! Times run() and records the result unless "op/shape" does not
+    //! contain the filter. Calls are timed in groups, so run() has to be
+    //! repeatable on its own.
+    void Run(const std::string& op, const std::string& shape,
+             std::size_t numElement, double numFlop, double numByte,
+             const std::function<void()>& run);
+
+    //! Same as above, with setup() run untimed before every call. Each call
+    //! is timed separately and the cost of reading the clock is subtracted.
+    void Run(const std::string& op, const std::string& shape,
+             std::size_t numElement, double numFlop, double numByte,
+             const std::function<void()>& setup,
+             const std::function<void()>& run);
+
+    const std::vector<Result>& Results() const noexcept;
+
+    void WriteJSON(std::ostream& stream) const;
+
+ private:
+    bool IsSelected(const std::string& op, const std::string& shape) const;
+    void Record(Result result);
+
+    std::string m_filter;
+    std::size_t m_numSample;
+    double m_clockOverhead;
+    std::vector<Result> m_results;
+};
+
+//! Multiply, dMultiplyAddLeft and dMultiplyAddRight on the Examples/GraphBasic
+//! layers and on square shapes, and MultiplyAdd against MultiplyAddGEMV on
+//! small batches.
+void RunGEMMBenchmarks(Suite& suite);
+
+//! Forward and backward paths of ReLU, Softmax and SoftmaxCE on the
+//! Examples/GraphBasic activation shapes, and of ReLU chains node by node and
+//! fused.
+void RunNodeBenchmarks(Suite& suite);
+
+//! Construction and MarkDirty of chains and ensembles of 1k to 100k nodes,
+//! forward and backward passes evaluated node by node and through compiled
+//! Core::ExecutionPlan and Core::BackwardPlan, on ReLU chains and
+//! Examples/GraphBasic, and plans run sequentially and in parallel on
+//! independent Dense towers.
+void RunGraphBenchmarks(Suite& suite);
+
+//! Allocation, streaming and a Dense product on buffers placed under each
+//! Core::AllocationPolicy.
+void RunMemoryBenchmarks(Suite& suite);
+}  // namespace Benchmarks
+
+#endif
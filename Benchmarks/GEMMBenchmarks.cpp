@@ -0,0 +1,133 @@
+#include "Benchmark.hpp"
+
+#include <CubbyDNN/Compute/GEMM.hpp>
+
+#include <algorithm>
+#include <random>
+
+using namespace CubbyDNN;
+
+namespace Benchmarks
+{
+namespace
+{
+using GEMMFunction = void (*)(std::size_t, std::size_t, std::size_t,
+                              const Core::Span<float>, const Core::Span<float>,
+                              Core::Span<float>) noexcept;
+
+std::vector<float> RandomVector(std::size_t size)
+{
+    std::mt19937 engine{ 0 };
+    std::uniform_real_distribution<float> distribution{ -1.0f, 1.0f };
+
+    std::vector<float> vector(size);
+    std::generate(vector.begin(), vector.end(),
+                  [&] { return distribution(engine); });
+
+    return vector;
+}
+
+Core::Span<float> ToSpan(std::vector<float>& vector)
+{
+    return Core::Span<float>(vector.data(), vector.size());
+}
+
+std::string ShapeName(std::size_t numInput, std::size_t numOutput,
+                      std::size_t batchSize)
+{
+    return std::to_string(numInput) + "x" + std::to_string(numOutput) +
+           "/batch" + std::to_string(batchSize);
+}
+
+//! Times a product taking the weight as its right operand: the input is
+//! batchSize x numInput, the weight numOutput x numInput and the output
+//! batchSize x numOutput. isAccumulated counts the destination as read and
+//! written.
+void RunProduct(Suite& suite, const std::string& op, GEMMFunction function,
+                std::size_t numInput, std::size_t batchSize,
+                std::size_t numOutput, std::size_t destinationSize,
+                bool isAccumulated)
+{
+    const std::size_t inputSize = batchSize * numInput;
+    const std::size_t weightSize = numOutput * numInput;
+    const std::size_t outputSize = batchSize * numOutput;
+
+    // Left is whichever of the input and the output is not the destination.
+    auto left = RandomVector(inputSize + outputSize - destinationSize);
+    auto right = RandomVector(weightSize);
+    auto destination = RandomVector(destinationSize);
+
+    const double numFlop = 2.0 * batchSize * numInput * numOutput;
+    const double numByte =
+        4.0 * (left.size() + right.size() +
+               (isAccumulated ? 2 : 1) * destination.size());
+
+    suite.Run(op, ShapeName(numInput, numOutput, batchSize), destinationSize,
+              numFlop, numByte, [&] {
+                  function(numInput, batchSize, numOutput, ToSpan(left),
+                           ToSpan(right), ToSpan(destination));
+              });
+}
+
+//! dMultiplyAddRight takes the input where the others take the weight.
+void RunWeightGradient(Suite& suite, std::size_t numInput,
+                       std::size_t batchSize, std::size_t numOutput)
+{
+    auto gradient = RandomVector(batchSize * numOutput);
+    auto input = RandomVector(batchSize * numInput);
+    auto destination = RandomVector(numOutput * numInput);
+
+    const double numFlop = 2.0 * batchSize * numInput * numOutput;
+    const double numByte = 4.0 * (gradient.size() + input.size() +
+                                  2 * destination.size());
+
+    suite.Run("dMultiplyAddRight", ShapeName(numInput, numOutput, batchSize),
+              destination.size(), numFlop, numByte, [&] {
+                  Compute::GEMM::dMultiplyAddRight(
+                      numInput, batchSize, numOutput, ToSpan(gradient),
+                      ToSpan(input), ToSpan(destination));
+              });
+}
+}  // namespace
+
+void RunGEMMBenchmarks(Suite& suite)
+{
+    // Dense layers of Examples/GraphBasic, (input, output), at inference,
+    // its training batch and a full pass over the training set.
+    const std::size_t layers[][2] = { { 784, 300 }, { 300, 10 } };
+    const std::size_t batchSizes[] = { 1, 32, 60000 };
+
+    for (const auto& layer : layers)
+    {
+        for (const auto batchSize : batchSizes)
+        {
+            RunProduct(suite, "Multiply", Compute::GEMM::Multiply, layer[0],
+                       batchSize, layer[1], batchSize * layer[1], false);
+            RunProduct(suite, "dMultiplyAddLeft",
+                       Compute::GEMM::dMultiplyAddLeft, layer[0], batchSize,
+                       layer[1], batchSize * layer[0], true);
+            RunWeightGradient(suite, layer[0], batchSize, layer[1]);
+        }
+    }
+
+    for (const std::size_t size : { 64, 128, 256, 512, 1024 })
+    {
+        RunProduct(suite, "Multiply", Compute::GEMM::Multiply, size, size,
+                   size, size * size, false);
+    }
+
+    // The small batches MultiplyAddGEMV is meant for.
+    for (const auto& layer : layers)
+    {
+        for (const std::size_t batchSize : { 1, 2, 4, 8 })
+        {
+            RunProduct(suite, "MultiplyAdd", Compute::GEMM::MultiplyAdd,
+                       layer[0], batchSize, layer[1], batchSize * layer[1],
+                       true);
+            RunProduct(suite, "MultiplyAddGEMV",
+                       Compute::GEMM::MultiplyAddGEMV, layer[0], batchSize,
+                       layer[1], batchSize * layer[1], true);
+        }
+    }
+}
+}  // namespace Benchmarks
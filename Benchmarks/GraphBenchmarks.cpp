@@ -0,0 +1,309 @@
+#include "Benchmark.hpp"
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace Benchmarks
+{
+namespace
+{
+//! Times the forward pass of target, reevaluated after input is dirtied,
+//! through Node::EvalOutput and through a compiled plan. numElement is the
+//! number of nodes evaluated, so ns/element is the cost per node.
+void RunForward(Suite& suite, const std::string& shape, Core::Graph& graph,
+                Node::NodeWrapper input, Node::NodeWrapper target)
+{
+    auto plan = graph.Compile({ target });
+    const std::size_t numNode = plan.StepCount();
+
+    suite.Run(
+        "Forward/recursive", shape, numNode, 0.0, 0.0,
+        [&] { input.node->MarkDirty(false); }, [&] { target.EvalOutput(); });
+    suite.Run(
+        "Forward/plan", shape, numNode, 0.0, 0.0,
+        [&] { input.node->MarkDirty(false); }, [&] { plan.Run(); });
+}
+
+//! Times the gradients of target with respect to the sources, through one
+//! Node::EvalGradient per source and through a compiled backward plan. The
+//! forward pass is evaluated before each run.
+void RunBackward(Suite& suite, const std::string& shape, Core::Graph& graph,
+                 const std::vector<Node::NodeWrapper>& sourceList,
+                 Node::NodeWrapper target)
+{
+    auto plan = graph.CompileBackward(target, sourceList);
+    const std::size_t numNode = plan.StepCount();
+
+    const auto reset = [&] {
+        for (const auto& source : sourceList)
+        {
+            source.node->MarkDirty(false);
+        }
+
+        target.EvalOutput();
+    };
+
+    suite.Run("Backward/recursive", shape, numNode, 0.0, 0.0, reset, [&] {
+        for (const auto& source : sourceList)
+        {
+            source.node->EvalGradient(target);
+        }
+    });
+    suite.Run("Backward/plan", shape, numNode, 0.0, 0.0, reset,
+              [&] { plan.Run(); });
+}
+
+//! Times building a graph of about numNode nodes from an input "x" with
+//! build(graph), which returns its outputs, starting from an empty graph
+//! each time. Then times dirtying every node through the input once their
+//! shapes are evaluated.
+void RunBuild(
+    Suite& suite, const std::string& shape, std::size_t numNode,
+    const std::function<std::vector<Node::Node*>(Core::Graph&)>& build)
+{
+    std::unique_ptr<Core::Graph> graph;
+    std::vector<Node::Node*> outputList;
+
+    suite.Run(
+        "Build", shape, numNode, 0.0, 0.0,
+        [&] {
+            graph.reset();
+            graph = std::make_unique<Core::Graph>();
+        },
+        [&] { outputList = build(*graph); });
+
+    // Not built yet when the filter left Build out.
+    if (!graph)
+    {
+        graph = std::make_unique<Core::Graph>();
+        outputList = build(*graph);
+    }
+
+    std::vector<float> data(2, 1.0f);
+    graph->Feed({ { "x", Core::Shape{ 2, 1 },
+                    Core::Span<float>(data.data(), data.size()) } });
+
+    // In evaluation order, so that no evaluation recurses deeply.
+    const auto nodeList = graph->SortDeps(outputList);
+
+    suite.Run(
+        "MarkDirty", shape, numNode, 0.0, 0.0,
+        [&] {
+            for (auto* node : nodeList)
+            {
+                node->EvalShape();
+            }
+        },
+        [&] { graph->Node("x")->MarkDirty(); });
+}
+}  // namespace
+
+void RunGraphBenchmarks(Suite& suite)
+{
+    // Construction of unrolled sequences, a chain of ReLUs, and of
+    // ensembles, Dense and ReLU members reading one input.
+    for (const std::size_t numNode : { 1000, 10000, 100000 })
+    {
+        RunBuild(suite, "Chain/" + std::to_string(numNode), numNode,
+                 [numNode](Core::Graph& graph) {
+                     Node::Node* node = graph.Builder().Input("x");
+
+                     for (std::size_t index = 1; index < numNode; ++index)
+                     {
+                         node = graph.Builder().ReLU(node);
+                     }
+
+                     return std::vector<Node::Node*>{ node };
+                 });
+        RunBuild(suite, "Ensemble/" + std::to_string(numNode), numNode,
+                 [numNode](Core::Graph& graph) {
+                     auto& builder = graph.Builder();
+                     auto x = builder.Input("x");
+                     std::vector<Node::Node*> outputList;
+
+                     for (std::size_t index = 0; index + 4 <= numNode;
+                          index += 4)
+                     {
+                         const auto id = std::to_string(index);
+                         auto w = builder.Parameter(
+                             "w" + id, Core::Shape{ 2, 2 },
+                             builder.InitConstant());
+                         auto b = builder.Parameter("b" + id, Core::Shape{ 2 },
+                                                    builder.InitConstant());
+
+                         outputList.emplace_back(
+                             builder.ReLU(builder.Dense(x, w, b)));
+                     }
+
+                     return outputList;
+                 });
+    }
+
+    // Per-node overhead on its own: a chain of ReLUs over 4 values each.
+    for (const std::size_t depth : { 16, 256 })
+    {
+        Core::Graph graph;
+
+        auto input = graph.Builder().Input("input");
+        Node::Node* node = input;
+        std::vector<float> data(4, 1.0f);
+
+        for (std::size_t index = 0; index < depth; ++index)
+        {
+            node = graph.Builder().ReLU(node, .001f);
+        }
+
+        graph.Feed({ { "input", Core::Shape{ 4, 1 },
+                       Core::Span<float>(data.data(), data.size()) } });
+
+        RunForward(suite, "ReLU" + std::to_string(depth) + "/4", graph,
+                   input, node);
+        RunBackward(suite, "ReLU" + std::to_string(depth) + "/4", graph,
+                    { input }, node);
+    }
+
+    // Examples/GraphBasic on single requests, where the products are small
+    // enough for the overhead to show.
+    {
+        Core::Graph graph;
+        auto& builder = graph.Builder();
+
+        auto x = builder.Input("x");
+        auto w1 = builder.Parameter("w1", Core::Shape{ 300, 784 },
+                                    builder.InitXavier(0, 784, 300));
+        auto b1 = builder.Parameter("b1", Core::Shape{ 300 },
+                                    builder.InitConstant(0.0f));
+        auto w2 = builder.Parameter("w2", Core::Shape{ 10, 300 },
+                                    builder.InitXavier(1, 300, 10));
+        auto b2 = builder.Parameter("b2", Core::Shape{ 10 },
+                                    builder.InitConstant(0.0f));
+        auto y = builder.Softmax(
+            builder.Dense(builder.ReLU(builder.Dense(x, w1, b1), .001f), w2,
+                          b2),
+            { true, false });
+        std::vector<float> data(784, 0.5f);
+
+        graph.Feed({ { "x", Core::Shape{ 784, 1 },
+                       Core::Span<float>(data.data(), data.size()) } });
+
+        RunForward(suite, "GraphBasic/batch1", graph, x, y);
+        RunBackward(suite, "GraphBasic/batch1", graph, { w1, b1, w2, b2 },
+                    y);
+    }
+
+    // An MLP classifier as built and as Core::Graph::Fuse rewrites it, with
+    // the loss and its gradients run through compiled plans.
+    for (const bool isFused : { false, true })
+    {
+        constexpr std::size_t NumLayer = 3, Width = 512, BatchSize = 64;
+        constexpr std::size_t NumClass = 10;
+
+        Core::Graph graph;
+        auto& builder = graph.Builder();
+        auto x = builder.Input("x");
+        auto y = builder.Input("y");
+        Node::Node* layer = x;
+        std::vector<Node::NodeWrapper> parameterList;
+
+        for (std::size_t index = 0; index < NumLayer; ++index)
+        {
+            const auto id = std::to_string(index);
+            const std::size_t fanOut = index + 1 < NumLayer ? Width : NumClass;
+            auto w = builder.Parameter("w" + id, Core::Shape{ fanOut, Width },
+                                       builder.InitXavier(index, Width,
+                                                          fanOut));
+            auto b = builder.Parameter("b" + id, Core::Shape{ fanOut },
+                                       builder.InitConstant(0.0f));
+
+            layer = builder.Dense(layer, w, b);
+            layer = index + 1 < NumLayer
+                        ? builder.ReLU(layer, .001f)
+                        : builder.Softmax(layer, { true, false });
+            parameterList.emplace_back(w);
+            parameterList.emplace_back(b);
+        }
+
+        Node::Node* loss = builder.SoftmaxCE(y, layer);
+
+        if (isFused)
+        {
+            loss = graph.Fuse({ loss }).front();
+        }
+
+        std::vector<float> data(Width * BatchSize, 0.5f);
+        std::vector<float> label(NumClass * BatchSize);
+
+        for (std::size_t index = 0; index < BatchSize; ++index)
+        {
+            label[index * NumClass + index % NumClass] = 1.0f;
+        }
+
+        graph.Feed({ { "x", Core::Shape{ Width, BatchSize },
+                       Core::Span<float>(data.data(), data.size()) },
+                     { "y", Core::Shape{ NumClass, BatchSize },
+                       Core::Span<float>(label.data(), label.size()) } });
+
+        const std::string shape =
+            std::string(isFused ? "Fused" : "Unfused") + "MLP/batch" +
+            std::to_string(BatchSize);
+
+        RunForward(suite, shape, graph, x, loss);
+        RunBackward(suite, shape, graph, parameterList, loss);
+    }
+
+    // Eight independent Dense towers over one input, run one node at a time
+    // and with the towers started side by side on the default pool.
+    {
+        constexpr std::size_t NumTower = 8, NumLayer = 4, Width = 256;
+        constexpr std::size_t BatchSize = 16;
+
+        Core::Graph graph;
+        auto& builder = graph.Builder();
+        auto x = builder.Input("x");
+        std::vector<Node::Node*> targetList;
+
+        for (std::size_t tower = 0; tower < NumTower; ++tower)
+        {
+            Node::Node* layer = x;
+
+            for (std::size_t index = 0; index < NumLayer; ++index)
+            {
+                const auto name = std::to_string(tower) + "/" +
+                                  std::to_string(index);
+                auto w = builder.Parameter(
+                    "w" + name, Core::Shape{ Width, Width },
+                    builder.InitXavier(tower * NumLayer + index, Width,
+                                       Width));
+                auto b = builder.Parameter("b" + name, Core::Shape{ Width },
+                                           builder.InitConstant(0.0f));
+
+                layer = builder.ReLU(builder.Dense(layer, w, b), .001f);
+            }
+
+            targetList.emplace_back(layer);
+        }
+
+        std::vector<float> data(Width * BatchSize, 0.5f);
+
+        graph.Feed({ { "x", Core::Shape{ Width, BatchSize },
+                       Core::Span<float>(data.data(), data.size()) } });
+
+        Core::ExecutionPlan plan(targetList);
+        const std::string shape =
+            "Towers" + std::to_string(NumTower) + "/" +
+            std::to_string(Core::DefaultThreadPool().ThreadCount()) + "threads";
+
+        suite.Run(
+            "Forward/plan", shape, plan.StepCount(), 0.0, 0.0,
+            [&] { x.node->MarkDirty(false); }, [&] { plan.Run(); });
+        suite.Run(
+            "Forward/parallel", shape, plan.StepCount(), 0.0, 0.0,
+            [&] { x.node->MarkDirty(false); }, [&] { plan.RunParallel(); });
+    }
+}
+}  // namespace Benchmarks
@@ -0,0 +1,99 @@
+#include "Benchmark.hpp"
+
+#include <CubbyDNN/Compute/GEMM.hpp>
+#include <CubbyDNN/Core/Memory.hpp>
+
+#include <algorithm>
+#include <random>
+
+using namespace CubbyDNN;
+
+namespace Benchmarks
+{
+namespace
+{
+struct NamedPolicy
+{
+    const char* name;
+    Core::AllocationPolicy policy;
+};
+
+const NamedPolicy PolicyList[] = {
+    { "default", {} },
+    { "thp", { Core::HugePagePolicy::Transparent } },
+    { "hugetlb", { Core::HugePagePolicy::Explicit } },
+    { "interleave",
+      { Core::HugePagePolicy::None, Core::NUMAPolicy::Interleave } },
+    { "parallel-touch",
+      { Core::HugePagePolicy::None, Core::NUMAPolicy::ParallelFirstTouch } },
+    { "thp+parallel-touch",
+      { Core::HugePagePolicy::Transparent,
+        Core::NUMAPolicy::ParallelFirstTouch } },
+};
+
+void FillRandom(Core::Span<float> span)
+{
+    std::mt19937 engine{ 0 };
+    std::uniform_real_distribution<float> distribution{ -1.0f, 1.0f };
+
+    std::generate(span.begin(), span.end(),
+                  [&] { return distribution(engine); });
+}
+
+//! Allocates and zeroes a buffer, which is where its pages are placed.
+void RunAllocate(Suite& suite, const NamedPolicy& policy, std::size_t size)
+{
+    Core::PageAllocator allocator(policy.policy);
+
+    suite.Run("Allocate", std::string(policy.name) + "/256MB", size, 0.0,
+              4.0 * size, [&] { Core::Memory<float> memory(size, allocator); });
+}
+
+//! Streams one buffer into another, bound by bandwidth and TLB reach.
+void RunCopy(Suite& suite, const NamedPolicy& policy, std::size_t size)
+{
+    Core::PageAllocator allocator(policy.policy);
+    Core::Memory<float> source(size, allocator);
+    Core::Memory<float> destination(size, allocator);
+    FillRandom(source.GetSpan());
+
+    suite.Run("Copy", std::string(policy.name) + "/128MB", size, 0.0,
+              8.0 * size, [&] {
+                  std::copy(source.GetSpan().begin(), source.GetSpan().end(),
+                            destination.GetSpan().begin());
+              });
+}
+
+//! The first Dense layer of Examples/GraphBasic over its test set, with
+//! every operand placed by the policy.
+void RunMultiply(Suite& suite, const NamedPolicy& policy)
+{
+    constexpr std::size_t numInput = 784, numOutput = 300, batchSize = 10000;
+
+    Core::PageAllocator allocator(policy.policy);
+    Core::Memory<float> input(batchSize * numInput, allocator);
+    Core::Memory<float> weight(numOutput * numInput, allocator);
+    Core::Memory<float> output(batchSize * numOutput, allocator);
+    FillRandom(input.GetSpan());
+    FillRandom(weight.GetSpan());
+
+    suite.Run("Multiply", std::string(policy.name) + "/784x300/batch10000",
+              output.Size(), 2.0 * batchSize * numInput * numOutput,
+              4.0 * (input.Size() + weight.Size() + output.Size()), [&] {
+                  Compute::GEMM::Multiply(numInput, batchSize, numOutput,
+                                          input.GetSpan(), weight.GetSpan(),
+                                          output.GetSpan());
+              });
+}
+}  // namespace
+
+void RunMemoryBenchmarks(Suite& suite)
+{
+    for (const auto& policy : PolicyList)
+    {
+        RunAllocate(suite, policy, std::size_t{ 64 } << 20);
+        RunCopy(suite, policy, std::size_t{ 32 } << 20);
+        RunMultiply(suite, policy);
+    }
+}
+}  // namespace Benchmarks
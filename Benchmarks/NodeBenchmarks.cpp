@@ -0,0 +1,180 @@
+#include "Benchmark.hpp"
+
+#include <CubbyDNN/Core/Graph.hpp>
+
+#include <algorithm>
+#include <random>
+
+using namespace CubbyDNN;
+
+namespace Benchmarks
+{
+namespace
+{
+std::vector<float> RandomVector(std::size_t size, float min, float max)
+{
+    std::mt19937 engine{ 0 };
+    std::uniform_real_distribution<float> distribution{ min, max };
+
+    std::vector<float> vector(size);
+    std::generate(vector.begin(), vector.end(),
+                  [&] { return distribution(engine); });
+
+    return vector;
+}
+
+//! One-hot columns of a numClass x batchSize label.
+std::vector<float> OneHotVector(std::size_t numClass, std::size_t batchSize)
+{
+    std::vector<float> vector(numClass * batchSize, 0.0f);
+
+    for (std::size_t index = 0; index < batchSize; ++index)
+    {
+        vector[index * numClass + index % numClass] = 1.0f;
+    }
+
+    return vector;
+}
+
+Core::Span<float> ToSpan(std::vector<float>& vector)
+{
+    return Core::Span<float>(vector.data(), vector.size());
+}
+
+//! Times the forward and backward path of node, which reads the output of
+//! input. Forward reevaluates the node; backward reevaluates the gradient of
+//! input, with the forward pass and the seed gradient done as setup.
+//! numByte holds the forward and backward traffic per element.
+void RunNode(Suite& suite, const std::string& op, const std::string& shape,
+             Node::NodeWrapper input, Node::NodeWrapper node,
+             const double (&numByte)[2])
+{
+    const std::size_t numElement = input.node->EvalShape().Shape().Size();
+
+    suite.Run(
+        op + "/forward", shape, numElement, 0.0, numByte[0] * numElement,
+        [&] { node.node->MarkDirty(false); }, [&] { node.EvalOutput(); });
+    suite.Run(
+        op + "/backward", shape, numElement, 0.0, numByte[1] * numElement,
+        [&] {
+            input.node->MarkDirty(false);
+            node.EvalOutput();
+            node.node->EvalGradient(node.node);
+        },
+        [&] { input.node->EvalGradient(node.node); });
+}
+}  // namespace
+
+void RunNodeBenchmarks(Suite& suite)
+{
+    // Activations of Examples/GraphBasic: the 300 hidden units after the
+    // first layer and the 10 classes after the second.
+    for (const std::size_t batchSize : { 1, 32, 60000 })
+    {
+        const std::string batchName = "batch" + std::to_string(batchSize);
+
+        {
+            Core::Graph graph;
+
+            auto logit = graph.Builder().Input("logit");
+            auto relu = graph.Builder().ReLU(logit, .001f);
+            auto data = RandomVector(300 * batchSize, -1.0f, 1.0f);
+
+            graph.Feed({ { "logit", Core::Shape{ 300, batchSize },
+                           ToSpan(data) } });
+
+            // Forward reads the logit and writes the output; backward reads
+            // the logit and the gradient and accumulates into the logit's.
+            RunNode(suite, "ReLU", "300/" + batchName, logit, relu,
+                    { 8.0, 16.0 });
+        }
+
+        {
+            Core::Graph graph;
+
+            auto logit = graph.Builder().Input("logit");
+            auto softmax = graph.Builder().Softmax(logit, { true, false });
+            auto data = RandomVector(10 * batchSize, -4.0f, 4.0f);
+
+            graph.Feed({ { "logit", Core::Shape{ 10, batchSize },
+                           ToSpan(data) } });
+
+            // Backward reads the output instead of the logit.
+            RunNode(suite, "Softmax", "10/" + batchName, logit, softmax,
+                    { 8.0, 16.0 });
+        }
+
+        {
+            Core::Graph graph;
+
+            auto label = graph.Builder().Input("label");
+            auto prob = graph.Builder().Input("prob");
+            auto loss = graph.Builder().SoftmaxCE(label, prob);
+            auto labelData = OneHotVector(10, batchSize);
+            auto probData = RandomVector(10 * batchSize, 0.01f, 1.0f);
+
+            graph.Feed(
+                { { "label", Core::Shape{ 10, batchSize }, ToSpan(labelData) },
+                  { "prob", Core::Shape{ 10, batchSize },
+                    ToSpan(probData) } });
+
+            // Both directions read the label and the probability; backward
+            // also accumulates into the probability's gradient.
+            RunNode(suite, "SoftmaxCE", "10/" + batchName, prob, loss,
+                    { 8.0, 16.0 });
+        }
+    }
+
+    // Chains of ReLUs over 2M values, node by node and fused into one
+    // Node::FusedElementwise. Node by node, every step moves 8 bytes per
+    // element forward and 16 backward, as above; fused, the whole chain
+    // does.
+    for (const std::size_t length : { 2, 4, 8 })
+    {
+        for (const bool isFused : { false, true })
+        {
+            constexpr std::size_t NumRow = 2048, NumColumn = 1024;
+
+            Core::Graph graph;
+
+            auto input = graph.Builder().Input("input");
+            Node::Node* node = input;
+            auto data = RandomVector(NumRow * NumColumn, -1.0f, 1.0f);
+
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                node = graph.Builder().ReLU(node, .001f);
+            }
+
+            if (isFused)
+            {
+                node = graph.Fuse({ node }).front();
+            }
+
+            graph.Feed({ { "input", Core::Shape{ NumRow, NumColumn },
+                           ToSpan(data) } });
+
+            const std::string op = "ReLUChain" + std::to_string(length);
+            const std::string shape =
+                std::string(isFused ? "fused" : "unfused") + "/2M";
+            const std::size_t numElement = NumRow * NumColumn;
+            const double numStep = isFused ? 1.0 : length;
+
+            suite.Run(
+                op + "/forward", shape, numElement, 0.0,
+                8.0 * numStep * numElement,
+                [&] { input.node->MarkDirty(false); },
+                [&] { node->EvalOutput(); });
+            suite.Run(
+                op + "/backward", shape, numElement, 0.0,
+                16.0 * numStep * numElement,
+                [&] {
+                    input.node->MarkDirty(false);
+                    node->EvalOutput();
+                    node->EvalGradient(node);
+                },
+                [&] { input.node->EvalGradient(node); });
+        }
+    }
+}
+}  // namespace Benchmarks
@@ -0,0 +1,89 @@
+#include "Benchmark.hpp"
+
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+using namespace CubbyDNN;
+
+namespace
+{
+void PrintUsage(const char* program)
+{
+    std::printf(
+        "Usage: %s [--json <path>] [--filter <text>] [--samples <count>]\n"
+        "  --json     where to write the results (default: Benchmarks.json)\n"
+        "  --filter   only run benchmarks whose op/shape contains the text\n"
+        "  --samples  timed samples per benchmark, the median is kept "
+        "(default: 11)\n",
+        program);
+}
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    std::string jsonPath = "Benchmarks.json";
+    std::string filter;
+    std::size_t numSample = 11;
+
+    for (int index = 1; index < argc; ++index)
+    {
+        const std::string option = argv[index];
+
+        if (index + 1 == argc)
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        const std::string value = argv[++index];
+
+        if (option == "--json")
+        {
+            jsonPath = value;
+        }
+        else if (option == "--filter")
+        {
+            filter = value;
+        }
+        else if (option == "--samples")
+        {
+            numSample = std::strtoul(value.c_str(), nullptr, 10);
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf("ISA: %s\n",
+                Compute::CPUInfo::Name(Compute::KernelRegistry::Active().isa)
+                    .data());
+    std::printf("%-20s %-22s %14s %10s %10s %12s\n", "op", "shape", "ns",
+                "GFLOP/s", "GB/s", "ns/element");
+
+    Benchmarks::Suite suite(filter, numSample);
+
+    Benchmarks::RunGEMMBenchmarks(suite);
+    Benchmarks::RunNodeBenchmarks(suite);
+    Benchmarks::RunGraphBenchmarks(suite);
+    Benchmarks::RunMemoryBenchmarks(suite);
+
+    std::ofstream stream(jsonPath);
+    suite.WriteJSON(stream);
+
+    if (!stream)
+    {
+        std::fprintf(stderr, "Failed to write %s\n", jsonPath.c_str());
+        return 1;
+    }
+
+    std::printf("%zu results written to %s\n", suite.Results().size(),
+                jsonPath.c_str());
+
+    return 0;
+}
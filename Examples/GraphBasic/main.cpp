@@ -18,28 +18,28 @@ auto main() -> int
     std::vector<float> testY(10000 * 10);
 
     {
-        std::ifstream input{ L"train_input.dat",
+        std::ifstream input{ "train_input.dat",
                              std::ifstream::binary | std::ifstream::in };
         input.read(reinterpret_cast<char*>(trainX.data()),
                    sizeof(float) * trainX.size());
     }
 
     {
-        std::ifstream input{ L"train_label.dat",
+        std::ifstream input{ "train_label.dat",
                              std::ifstream::binary | std::ifstream::in };
         input.read(reinterpret_cast<char*>(trainY.data()),
                    sizeof(float) * trainY.size());
     }
 
     {
-        std::ifstream input{ L"test_input.dat",
+        std::ifstream input{ "test_input.dat",
                              std::ifstream::binary | std::ifstream::in };
         input.read(reinterpret_cast<char*>(testX.data()),
                    sizeof(float) * testX.size());
     }
 
     {
-        std::ifstream input{ L"test_label.dat",
+        std::ifstream input{ "test_label.dat",
                              std::ifstream::binary | std::ifstream::in };
         input.read(reinterpret_cast<char*>(testY.data()),
                    sizeof(float) * testY.size());
@@ -88,6 +88,15 @@ auto main() -> int
                      { "y", Core::Shape{ 10, 60000 },
                        Core::Span<float>{ trainY.begin(), trainY.end() } } });
 
+        // The full-set evaluations only need the loss, so the intermediate
+        // outputs can share one arena.
+        const auto& plan =
+            graph.PlanMemory({ loss }, Core::PlanMode::Inference);
+
+        std::cout << "Planned: " << plan.PlannedSize() / 1048576
+                  << "MB (instead of " << plan.NaiveSize() / 1048576
+                  << "MB)" << std::endl;
+
         std::cout << "Training Loss: " << loss.EvalOutput().Output()[0]
                   << std::endl;
 
@@ -99,6 +108,8 @@ auto main() -> int
         std::cout << "Test Loss: " << loss.EvalOutput().Output()[0]
                   << std::endl;
 
+        graph.ClearMemoryPlan();
+
         for (std::size_t index = 1; index < 60000; ++index)
         {
             std::swap(
@@ -119,7 +130,7 @@ auto main() -> int
                            Core::Span<float>{ trainY.data() + index * 10,
                                               actualBatchSize * 10 } } });
 
-            auto g = o1.EvalOutput().Output();
+            o1.EvalOutput();
 
             optimizer.Reduce(0.001f, loss);
         }
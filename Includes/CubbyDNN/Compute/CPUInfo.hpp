@@ -0,0 +1,66 @@
+#ifndef CUBBYDNN_CPU_INFO_HPP
+#define CUBBYDNN_CPU_INFO_HPP
+
+#include <string_view>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+    defined(_M_IX86)
+#define CUBBYDNN_ARCH_X86
+#endif
+
+namespace CubbyDNN::Compute
+{
+//! Instruction set levels that have a dedicated kernel implementation,
+//! ordered from the most portable to the widest.
+enum class ISA
+{
+    Scalar,
+    SSE42,
+    AVX2,
+    AVX512,
+};
+
+//! Optional extensions that do not define an ISA level of their own. Each is
+//! only reported when the ISA level it extends is supported as well.
+enum class Extension
+{
+    //! 8-bit dot products (vpdpbusd), on top of AVX512.
+    AVX512VNNI,
+    //! fp32 to bfloat16 conversion and bf16 dot products, on top of AVX512.
+    AVX512BF16,
+    //! fp16 <-> fp32 conversion, on top of AVX2.
+    F16C,
+};
+
+class CPUInfo final
+{
+ public:
+    CPUInfo() = delete;
+    ~CPUInfo() noexcept = delete;
+    CPUInfo(const CPUInfo& rhs) = delete;
+    CPUInfo(CPUInfo&& rhs) noexcept = delete;
+
+    CPUInfo& operator=(const CPUInfo& rhs) = delete;
+    CPUInfo& operator=(CPUInfo&& rhs) noexcept = delete;
+
+    //! Widest ISA supported by both the CPU and the operating system. CPUID
+    //! is only queried on the first call.
+    static ISA SupportedISA() noexcept;
+
+    //! ISA requested through the CUBBYDNN_ISA environment variable, as
+    //! Parse reads it, clamped to SupportedISA(). Falls back to
+    //! SupportedISA() when the variable is unset, and warns on stderr when it
+    //! is unknown or not supported.
+    static ISA PreferredISA() noexcept;
+
+    static bool IsSupported(ISA isa) noexcept;
+    static bool HasExtension(Extension extension) noexcept;
+
+    static std::string_view Name(ISA isa) noexcept;
+    //! Reads the Name of an ISA ("scalar", "sse4.2", "avx2" or "avx512") in
+    //! any case, or "sse42" for "sse4.2".
+    static bool Parse(std::string_view name, ISA& isa) noexcept;
+};
+}  // namespace CubbyDNN::Compute
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef CUBBYDNN_CONVERT_HPP
+#define CUBBYDNN_CONVERT_HPP
+
+#include <CubbyDNN/Core/Half.hpp>
+#include <CubbyDNN/Core/Span.hpp>
+
+namespace CubbyDNN::Compute
+{
+//! Bulk conversion between fp32 and the half-precision storage types,
+//! dispatched to the active kernels (F16C and AVX-512 BF16 when available).
+//! source and destination must have the same length.
+class Convert final
+{
+ public:
+    Convert() = delete;
+    ~Convert() noexcept = delete;
+    Convert(const Convert& rhs) = delete;
+    Convert(Convert&& rhs) noexcept = delete;
+
+    Convert& operator=(const Convert& rhs) = delete;
+    Convert& operator=(Convert&& rhs) noexcept = delete;
+
+    static void ToFloat(const Core::Span<Core::BFloat16> source,
+                        Core::Span<float> destination) noexcept;
+    static void ToFloat(const Core::Span<Core::Float16> source,
+                        Core::Span<float> destination) noexcept;
+
+    //! Rounds to nearest even.
+    static void FromFloat(const Core::Span<float> source,
+                          Core::Span<Core::BFloat16> destination) noexcept;
+    static void FromFloat(const Core::Span<float> source,
+                          Core::Span<Core::Float16> destination) noexcept;
+};
+}  // namespace CubbyDNN::Compute
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef CUBBYDNN_ELEMENTWISE_HPP
+#define CUBBYDNN_ELEMENTWISE_HPP
+
+#include <CubbyDNN/Core/Span.hpp>
+
+#include <vector>
+
+namespace CubbyDNN::Compute
+{
+enum class ElementwiseType
+{
+    //! value < 0 ? alpha * value : value, as Node::ReLU. Its derivative is
+    //! alpha at 0 as well.
+    ReLU,
+};
+
+//! One step of a chain of element-wise nodes.
+struct ElementwiseOp
+{
+    ElementwiseType type;
+    float alpha;
+};
+
+//! Runs chains of element-wise ops as one loop, on the ActivationKernel of
+//! the active instruction set for each. Every chunk of values goes through
+//! the whole chain while it is in L1, so a chain reads its input and writes
+//! its output once, however long it is. Work is split over the chunks. A
+//! single op, as a node that is not fused runs, makes no more passes than
+//! its kernel.
+class Elementwise final
+{
+ public:
+    Elementwise() = delete;
+    ~Elementwise() noexcept = delete;
+    Elementwise(const Elementwise& rhs) = delete;
+    Elementwise(Elementwise&& rhs) noexcept = delete;
+
+    Elementwise& operator=(const Elementwise& rhs) = delete;
+    Elementwise& operator=(Elementwise&& rhs) noexcept = delete;
+
+    //! Number of values run through a chain at a time.
+    static constexpr std::size_t ChunkSize = 1024;
+
+    //! Threads of Core::DefaultThreadPool() a pass over size values is
+    //! split over, the calling one included. Compute::Softmax and
+    //! Node::FusedSoftmaxCE split their passes the same way.
+    static std::size_t ThreadCount(std::size_t size) noexcept;
+
+    //! output = opList.back()(...(opList.front()(input))). input and output
+    //! must have the same length and may be the same span.
+    static void Forward(const std::vector<ElementwiseOp>& opList,
+                        const Core::Span<float> input,
+                        Core::Span<float> output);
+
+    //! inputGradient += gradient * d output / d input, with output as
+    //! Forward computes it from input. The values between the steps are
+    //! recomputed a chunk at a time rather than read back.
+    static void BackwardAdd(const std::vector<ElementwiseOp>& opList,
+                            const Core::Span<float> input,
+                            const Core::Span<float> gradient,
+                            Core::Span<float> inputGradient);
+};
+}  // namespace CubbyDNN::Compute
+
+#endif
\ No newline at end of file
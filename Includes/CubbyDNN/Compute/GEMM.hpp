@@ -1,8 +1,11 @@
 #ifndef CUBBYDNN_GEMM_HPP
 #define CUBBYDNN_GEMM_HPP
 
+#include <CubbyDNN/Core/Half.hpp>
 #include <CubbyDNN/Core/Span.hpp>
 
+#include <cstdint>
+
 namespace CubbyDNN::Compute
 {
 class GEMM final
@@ -16,36 +19,218 @@ class GEMM final
     GEMM& operator=(const GEMM& rhs) = delete;
     GEMM& operator=(GEMM&& rhs) noexcept = delete;
 
-    static void __vectorcall Multiply(std::size_t maxIndex, std::size_t numRow,
-                                      std::size_t numColumn,
-                                      const Core::Span<float> left,
-                                      const Core::Span<float> right,
-                                      Core::Span<float> destination) noexcept;
-
-    static void __vectorcall MultiplyAdd(
-        std::size_t maxIndex, std::size_t numRow, std::size_t numColumn,
-        const Core::Span<float> left, const Core::Span<float> right,
-        Core::Span<float> destination) noexcept;
-
-    static void __vectorcall dMultiplyLeft(
-        std::size_t maxIndex, std::size_t numRow, std::size_t numColumn,
-        const Core::Span<float> gradient, const Core::Span<float> right,
-        Core::Span<float> destination) noexcept;
-
-    static void __vectorcall dMultiplyAddLeft(
-        std::size_t maxIndex, std::size_t numRow, std::size_t numColumn,
-        const Core::Span<float> gradient, const Core::Span<float> right,
-        Core::Span<float> destination) noexcept;
-
-    static void __vectorcall dMultiplyRight(
-        std::size_t maxIndex, std::size_t numRow, std::size_t numColumn,
-        const Core::Span<float> gradient, const Core::Span<float> left,
-        Core::Span<float> destination) noexcept;
-
-    static void __vectorcall dMultiplyAddRight(
-        std::size_t maxIndex, std::size_t numRow, std::size_t numColumn,
-        const Core::Span<float> gradient, const Core::Span<float> left,
-        Core::Span<float> destination) noexcept;
+    enum class Transpose
+    {
+        NoTrans,
+        Trans,
+    };
+
+    //! Finishes the products that take one, a register tile at a time, once
+    //! the tile holds its last K block and is still in L1: c(i, j) =
+    //! Activate(c(i, j) + bias[j]), where Activate is the identity, or with
+    //! isReLU multiplies values below zero by alpha. A value-initialized
+    //! Epilogue does nothing.
+    struct Epilogue
+    {
+        //! One value per column of c, or nullptr for none.
+        const float* bias;
+        bool isReLU;
+        float alpha;
+    };
+
+    //! c = alpha * op(a) * op(b) + beta * c on row-major matrices, where
+    //! op(a) is m x k, op(b) is k x n and c is m x n. lda, ldb and ldc are
+    //! the row strides of a, b and c as stored. Transposed operands are read
+    //! in place; no temporary copy is made.
+    static void Gemm(Transpose transA, Transpose transB, std::size_t m,
+                     std::size_t n, std::size_t k, float alpha,
+                     const Core::Span<float> a, std::size_t lda,
+                     const Core::Span<float> b, std::size_t ldb, float beta,
+                     Core::Span<float> c, std::size_t ldc) noexcept;
+
+    //! Gemm with b stored in half precision. Panels of b are widened to fp32
+    //! as they are packed, so every product and sum is still computed in
+    //! fp32; only the memory traffic of b is halved.
+    static void Gemm(Transpose transA, Transpose transB, std::size_t m,
+                     std::size_t n, std::size_t k, float alpha,
+                     const Core::Span<float> a, std::size_t lda,
+                     const Core::Span<Core::BFloat16> b, std::size_t ldb,
+                     float beta, Core::Span<float> c,
+                     std::size_t ldc) noexcept;
+
+    static void Gemm(Transpose transA, Transpose transB, std::size_t m,
+                     std::size_t n, std::size_t k, float alpha,
+                     const Core::Span<float> a, std::size_t lda,
+                     const Core::Span<Core::Float16> b, std::size_t ldb,
+                     float beta, Core::Span<float> c,
+                     std::size_t ldc) noexcept;
+
+    //! The Gemm overloads above, with epilogue applied on top.
+    static void Gemm(Transpose transA, Transpose transB, std::size_t m,
+                     std::size_t n, std::size_t k, float alpha,
+                     const Core::Span<float> a, std::size_t lda,
+                     const Core::Span<float> b, std::size_t ldb, float beta,
+                     Core::Span<float> c, std::size_t ldc,
+                     const Epilogue& epilogue) noexcept;
+
+    static void Gemm(Transpose transA, Transpose transB, std::size_t m,
+                     std::size_t n, std::size_t k, float alpha,
+                     const Core::Span<float> a, std::size_t lda,
+                     const Core::Span<Core::BFloat16> b, std::size_t ldb,
+                     float beta, Core::Span<float> c, std::size_t ldc,
+                     const Epilogue& epilogue) noexcept;
+
+    static void Gemm(Transpose transA, Transpose transB, std::size_t m,
+                     std::size_t n, std::size_t k, float alpha,
+                     const Core::Span<float> a, std::size_t lda,
+                     const Core::Span<Core::Float16> b, std::size_t ldb,
+                     float beta, Core::Span<float> c, std::size_t ldc,
+                     const Epilogue& epilogue) noexcept;
+
+    //! batchCount independent Gemm products, the i-th one on the matrices
+    //! starting at a[i * strideA], b[i * strideB] and c[i * strideC]. The
+    //! batch is spread over the threads with one product per thread at a
+    //! time. Products that fit a single cache block skip the blocking and
+    //! go straight to the register kernel.
+    static void GemmStridedBatched(
+        Transpose transA, Transpose transB, std::size_t m, std::size_t n,
+        std::size_t k, float alpha, const Core::Span<float> a,
+        std::size_t lda, std::size_t strideA, const Core::Span<float> b,
+        std::size_t ldb, std::size_t strideB, float beta, Core::Span<float> c,
+        std::size_t ldc, std::size_t strideC, std::size_t batchCount) noexcept;
+
+    //! c(m x n) = a(m x k) * b(n x k)^T on 8-bit operands with 32-bit
+    //! accumulation. Rows of a and b hold k contiguous values; lda, ldb and
+    //! ldc are the row strides. Values of b must lie within
+    //! [-Int8MaxWeight(), Int8MaxWeight()] for the result to be exact.
+    static void GemmU8S8(std::size_t m, std::size_t n, std::size_t k,
+                         const Core::Span<std::uint8_t> a, std::size_t lda,
+                         const Core::Span<std::int8_t> b, std::size_t ldb,
+                         Core::Span<std::int32_t> c, std::size_t ldc) noexcept;
+
+    //! Same as GemmU8S8 with a signed a. a is shifted by +128 into the
+    //! unsigned kernel operand and 128 * sum(b row) is subtracted afterwards.
+    static void GemmS8S8(std::size_t m, std::size_t n, std::size_t k,
+                         const Core::Span<std::int8_t> a, std::size_t lda,
+                         const Core::Span<std::int8_t> b, std::size_t ldb,
+                         Core::Span<std::int32_t> c, std::size_t ldc) noexcept;
+
+    //! Largest |b| the active int8 kernel multiplies exactly: 127, or 64
+    //! when the kernel is built on vpmaddubsw.
+    static std::int32_t Int8MaxWeight() noexcept;
+
+    static void Multiply(std::size_t maxIndex, std::size_t numRow,
+                         std::size_t numColumn, const Core::Span<float> left,
+                         const Core::Span<float> right,
+                         Core::Span<float> destination) noexcept;
+
+    //! Multiply on batchCount densely packed products: destination holds
+    //! batchCount numRow x numColumn results, left batchCount numRow x
+    //! maxIndex matrices and right batchCount numColumn x maxIndex ones.
+    static void MultiplyBatched(std::size_t batchCount, std::size_t maxIndex,
+                                std::size_t numRow, std::size_t numColumn,
+                                const Core::Span<float> left,
+                                const Core::Span<float> right,
+                                Core::Span<float> destination) noexcept;
+
+    static void MultiplyAdd(std::size_t maxIndex, std::size_t numRow,
+                            std::size_t numColumn,
+                            const Core::Span<float> left,
+                            const Core::Span<float> right,
+                            Core::Span<float> destination) noexcept;
+
+    //! MultiplyAdd with right stored in half precision.
+    static void MultiplyAdd(std::size_t maxIndex, std::size_t numRow,
+                            std::size_t numColumn,
+                            const Core::Span<float> left,
+                            const Core::Span<Core::BFloat16> right,
+                            Core::Span<float> destination) noexcept;
+
+    static void MultiplyAdd(std::size_t maxIndex, std::size_t numRow,
+                            std::size_t numColumn,
+                            const Core::Span<float> left,
+                            const Core::Span<Core::Float16> right,
+                            Core::Span<float> destination) noexcept;
+
+    //! Same contract as MultiplyAdd, computed on the calling thread by the
+    //! GEMV kernels: right is streamed once per group of batch rows instead
+    //! of being packed. Only worthwhile for numRow <= MaxGEMVBatch.
+    static void MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                                std::size_t numColumn,
+                                const Core::Span<float> left,
+                                const Core::Span<float> right,
+                                Core::Span<float> destination) noexcept;
+
+    //! MultiplyAddGEMV with right stored in half precision and widened to
+    //! fp32 as it is streamed.
+    static void MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                                std::size_t numColumn,
+                                const Core::Span<float> left,
+                                const Core::Span<Core::BFloat16> right,
+                                Core::Span<float> destination) noexcept;
+
+    static void MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                                std::size_t numColumn,
+                                const Core::Span<float> left,
+                                const Core::Span<Core::Float16> right,
+                                Core::Span<float> destination) noexcept;
+
+    //! The MultiplyAddGEMV overloads above, with epilogue applied to each
+    //! group of batch rows once it is accumulated.
+    static void MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                                std::size_t numColumn,
+                                const Core::Span<float> left,
+                                const Core::Span<float> right,
+                                Core::Span<float> destination,
+                                const Epilogue& epilogue) noexcept;
+
+    static void MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                                std::size_t numColumn,
+                                const Core::Span<float> left,
+                                const Core::Span<Core::BFloat16> right,
+                                Core::Span<float> destination,
+                                const Epilogue& epilogue) noexcept;
+
+    static void MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                                std::size_t numColumn,
+                                const Core::Span<float> left,
+                                const Core::Span<Core::Float16> right,
+                                Core::Span<float> destination,
+                                const Epilogue& epilogue) noexcept;
+
+    //! Applies epilogue to an m x n matrix c in one pass, for products
+    //! computed elsewhere, e.g. by Sparse::MultiplyAdd.
+    static void ApplyEpilogue(std::size_t m, std::size_t n,
+                              Core::Span<float> c, std::size_t ldc,
+                              const Epilogue& epilogue) noexcept;
+
+    //! Largest number of rows of left for which MultiplyAddGEMV beats
+    //! MultiplyAdd.
+    static constexpr std::size_t MaxGEMVBatch = 8;
+
+    static void dMultiplyLeft(std::size_t maxIndex, std::size_t numRow,
+                              std::size_t numColumn,
+                              const Core::Span<float> gradient,
+                              const Core::Span<float> right,
+                              Core::Span<float> destination) noexcept;
+
+    static void dMultiplyAddLeft(std::size_t maxIndex, std::size_t numRow,
+                                 std::size_t numColumn,
+                                 const Core::Span<float> gradient,
+                                 const Core::Span<float> right,
+                                 Core::Span<float> destination) noexcept;
+
+    static void dMultiplyRight(std::size_t maxIndex, std::size_t numRow,
+                               std::size_t numColumn,
+                               const Core::Span<float> gradient,
+                               const Core::Span<float> left,
+                               Core::Span<float> destination) noexcept;
+
+    static void dMultiplyAddRight(std::size_t maxIndex, std::size_t numRow,
+                                  std::size_t numColumn,
+                                  const Core::Span<float> gradient,
+                                  const Core::Span<float> left,
+                                  Core::Span<float> destination) noexcept;
 };
 }  // namespace CubbyDNN::Compute
 
@@ -0,0 +1,90 @@
+#ifndef CUBBYDNN_GEMM_TUNER_HPP
+#define CUBBYDNN_GEMM_TUNER_HPP
+
+#include <CubbyDNN/Compute/CPUInfo.hpp>
+#include <CubbyDNN/Compute/GEMM.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace CubbyDNN::Compute
+{
+//! Shape and operand layout of a GEMM::Gemm call; the key of the tuning
+//! cache.
+struct GEMMSignature
+{
+    GEMM::Transpose transA;
+    GEMM::Transpose transB;
+    std::size_t m;
+    std::size_t n;
+    std::size_t k;
+
+    bool operator==(const GEMMSignature& rhs) const noexcept;
+};
+
+//! Everything GEMM::Gemm decides on its own besides the operands: the kernel
+//! set, the cache blocking, the thread count and the split-K factor.
+struct GEMMConfig
+{
+    ISA isa;
+    std::size_t mc;
+    std::size_t kc;
+    std::size_t nc;
+    std::size_t numThread;
+    //! Number of K chunks reduced in parallel; 1 disables split-K.
+    std::size_t numSplit;
+
+    bool operator==(const GEMMConfig& rhs) const noexcept;
+};
+
+//! Per-signature cache of GEMM configurations. On first use it reads two
+//! environment variables:
+//!  - CUBBYDNN_GEMM_TUNING_FILE: tuning file loaded at startup; newly tuned
+//!    signatures are appended to it.
+//!  - CUBBYDNN_GEMM_AUTOTUNE: when set to anything but "0", signatures that
+//!    are not cached yet are tuned on their first call.
+class GEMMTuner final
+{
+ public:
+    GEMMTuner() = delete;
+    ~GEMMTuner() noexcept = delete;
+    GEMMTuner(const GEMMTuner& rhs) = delete;
+    GEMMTuner(GEMMTuner&& rhs) noexcept = delete;
+
+    GEMMTuner& operator=(const GEMMTuner& rhs) = delete;
+    GEMMTuner& operator=(GEMMTuner&& rhs) noexcept = delete;
+
+    //! Runs one call with the given configuration and returns its duration
+    //! in seconds.
+    using Measure = std::function<double(const GEMMConfig& config)>;
+
+    //! True when Find can return anything other than its fallback, i.e.
+    //! autotuning is on or the cache holds at least one entry.
+    static bool IsEnabled() noexcept;
+
+    static bool IsAutotune() noexcept;
+    static void SetAutotune(bool autotune) noexcept;
+
+    //! Returns the cached configuration for signature. On a miss with
+    //! autotuning on, candidates around fallback are measured one parameter
+    //! at a time, and the winner is cached and appended to the tuning file.
+    //! Otherwise fallback is returned unchanged.
+    static GEMMConfig Find(const GEMMSignature& signature,
+                           const GEMMConfig& fallback, const Measure& measure);
+
+    static bool Lookup(const GEMMSignature& signature, GEMMConfig& config);
+
+    //! Merges the entries of a tuning file into the cache. Entries for an
+    //! ISA this CPU does not support and malformed lines are skipped.
+    //! Returns false if the file cannot be opened.
+    static bool Load(const std::string& path);
+
+    //! Writes every cached entry to path, replacing its contents.
+    static void Save(const std::string& path);
+
+    static void Clear();
+};
+}  // namespace CubbyDNN::Compute
+
+#endif
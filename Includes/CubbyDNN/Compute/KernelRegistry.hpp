@@ -0,0 +1,203 @@
+#ifndef CUBBYDNN_KERNEL_REGISTRY_HPP
+#define CUBBYDNN_KERNEL_REGISTRY_HPP
+
+#include <CubbyDNN/Compute/CPUInfo.hpp>
+#include <CubbyDNN/Core/Half.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CubbyDNN::Compute
+{
+//! c(mr x nr) += a(mr x kc) * b(kc x nr), where a is packed in column order
+//! (mr floats per k) and b in row order (nr floats per k). c is row-major
+//! with leading dimension ldc. b lies in a Core::Memory packing buffer at a
+//! multiple of nr * kc floats, so every row of it is aligned to the vector
+//! width and kernels load it with aligned loads.
+using GEMMMicroKernel = void (*)(std::size_t kc, const float* a,
+                                 const float* b, float* c, std::size_t ldc);
+
+//! Returns the inner product of x and y of the given length.
+using DotKernel = float (*)(std::size_t length, const float* x,
+                            const float* y);
+
+//! y += alpha * x over length values.
+using AxpyKernel = void (*)(std::size_t length, float alpha, const float* x,
+                            float* y);
+
+//! y(length) += sum over k < count of alpha[k * alphaStride] * x_k, where
+//! x_k is the run of length values at x + index[k] * ldx. y is kept in
+//! registers across all count terms, a chunk at a time.
+using GatherAxpyKernel = void (*)(std::size_t count, const float* alpha,
+                                  std::size_t alphaStride,
+                                  const std::uint32_t* index, const float* x,
+                                  std::size_t ldx, std::size_t length,
+                                  float* y);
+
+//! y(numBatch x numRow) += x(numBatch x length) * w(numRow x length)^T for
+//! numBatch <= KernelTable::MaxGEMVBatch. x and w rows are contiguous, y has
+//! leading dimension ldy. Each row of w is read once for all batch vectors.
+using GEMVKernel = void (*)(std::size_t numBatch, std::size_t numRow,
+                            std::size_t length, const float* x,
+                            const float* w, float* y, std::size_t ldy);
+
+//! c(mr x nr) += a(mr x kc) * b(kc x nr) on 8-bit operands with 32-bit
+//! accumulation. kc is a multiple of 4. a is unsigned and packed in groups
+//! of four consecutive k per row (4 * mr bytes per group); b is signed and
+//! packed in groups of four consecutive k per column (4 * nr bytes per
+//! group). c is row-major with leading dimension ldc. b is aligned like the
+//! float kernel's.
+using Int8GEMMMicroKernel = void (*)(std::size_t kc,
+                                     const std::uint8_t* a,
+                                     const std::int8_t* b, std::int32_t* c,
+                                     std::size_t ldc);
+
+//! Widens length half-precision values (Core::BFloat16 or Core::Float16)
+//! to fp32.
+template <typename T>
+using HalfToFloatKernel = void (*)(std::size_t length, const T* x, float* y);
+
+//! Rounds length fp32 values to half precision, to nearest even.
+template <typename T>
+using FloatToHalfKernel = void (*)(std::size_t length, const float* x, T* y);
+
+//! Same contract as GEMVKernel with w stored in half precision. w is widened
+//! as it is loaded and every product is accumulated in fp32.
+template <typename T>
+using HalfGEMVKernel = void (*)(std::size_t numBatch, std::size_t numRow,
+                                std::size_t length, const float* x,
+                                const T* w, float* y, std::size_t ldy);
+
+//! y = f(x) over length values, for an element-wise activation f with the
+//! parameter alpha. x and y may be the same.
+using ActivationForwardKernel = void (*)(std::size_t length, float alpha,
+                                         const float* x, float* y);
+
+//! dx = f'(x) * dy over length values, or dx += f'(x) * dy when isAdd. dx
+//! may be dy when not isAdd.
+using ActivationBackwardKernel = void (*)(std::size_t length, float alpha,
+                                          const float* x, const float* dy,
+                                          float* dx, bool isAdd);
+
+//! Returns the largest of length values, or -infinity for none.
+using MaxKernel = float (*)(std::size_t length, const float* x);
+
+//! y = exp(x - shift) over length values, and returns the sum of y. x and y
+//! may be the same. Within a few ulp of std::exp for x - shift <= 88; below
+//! about -87.3, where floats turn subnormal, it may flush to zero.
+using ExpKernel = float (*)(std::size_t length, float shift, const float* x,
+                            float* y);
+
+struct GEMMKernel
+{
+    //! Upper bound of mr * nr over all implementations.
+    static constexpr std::size_t MaxTileSize = 512;
+
+    std::size_t mr;
+    std::size_t nr;
+    GEMMMicroKernel microKernel;
+};
+
+struct Int8GEMMKernel
+{
+    std::size_t mr;
+    std::size_t nr;
+    //! Largest |b| the kernel multiplies exactly. vpmaddubsw saturates the
+    //! sum of two adjacent u8 x s8 products to 16 bits, which is only exact
+    //! for |b| <= 64; VNNI and scalar kernels accept the full [-127, 127].
+    std::int32_t maxWeight;
+    Int8GEMMMicroKernel microKernel;
+};
+
+template <typename T>
+struct HalfKernel
+{
+    HalfToFloatKernel<T> toFloat;
+    FloatToHalfKernel<T> fromFloat;
+    HalfGEMVKernel<T> gemv;
+};
+
+//! An element-wise activation and its derivative, as Compute::Elementwise
+//! runs them.
+struct ActivationKernel
+{
+    ActivationForwardKernel forward;
+    ActivationBackwardKernel backward;
+};
+
+//! The reductions Compute::Softmax runs over the rows of a group.
+struct SoftmaxKernel
+{
+    MaxKernel reduceMax;
+    ExpKernel shiftedExp;
+};
+
+//! Set of kernels compiled for one instruction set.
+struct KernelTable
+{
+    ISA isa;
+    GEMMKernel gemm;
+    //! Tile for products narrower than gemm.nr, e.g. the small matrices of
+    //! a batched GEMM. Same as gemm where that tile is already narrow.
+    GEMMKernel narrowGemm;
+    DotKernel dot;
+    AxpyKernel axpy;
+    GatherAxpyKernel gatherAxpy;
+    GEMVKernel gemv;
+    Int8GEMMKernel int8Gemm;
+    HalfKernel<Core::BFloat16> bf16;
+    HalfKernel<Core::Float16> fp16;
+    //! x < 0 ? alpha * x : x, as Node::ReLU, whose gradient takes alpha at
+    //! x == 0 as well.
+    ActivationKernel leakyReLU;
+    SoftmaxKernel softmax;
+
+    //! Largest batch the gemv kernel accepts.
+    static constexpr std::size_t MaxGEMVBatch = 8;
+};
+
+class KernelRegistry final
+{
+ public:
+    KernelRegistry() = delete;
+    ~KernelRegistry() noexcept = delete;
+    KernelRegistry(const KernelRegistry& rhs) = delete;
+    KernelRegistry(KernelRegistry&& rhs) noexcept = delete;
+
+    KernelRegistry& operator=(const KernelRegistry& rhs) = delete;
+    KernelRegistry& operator=(KernelRegistry&& rhs) noexcept = delete;
+
+    //! Kernels every Compute entry point dispatches to. Bound to
+    //! CPUInfo::PreferredISA() on first use.
+    static const KernelTable& Active() noexcept;
+
+    //! Rebinds the active kernels to the given ISA, clamped to what the CPU
+    //! supports, and returns the ISA actually bound.
+    static ISA Bind(ISA isa) noexcept;
+
+    //! Kernels of the given ISA, or of CPUInfo::SupportedISA() when the CPU
+    //! lacks it. Each table is built on first use, and never for an ISA the
+    //! CPU does not support.
+    static const KernelTable& Get(ISA isa) noexcept;
+
+    //! Whether Get has built the table of the given ISA yet.
+    static bool IsBuilt(ISA isa) noexcept;
+
+    //! Builders of the tables. Each may run instructions of its ISA, so only
+    //! call one on a CPU that supports it.
+    static KernelTable ScalarKernelTable() noexcept;
+    static KernelTable SSE42KernelTable() noexcept;
+    static KernelTable AVX2KernelTable() noexcept;
+    static KernelTable AVX512KernelTable() noexcept;
+
+    //! Int8 kernel built on AVX-512 VNNI, compiled separately because plain
+    //! AVX-512 CPUs lack it. Only called after a CPUID check.
+    static Int8GEMMKernel AVX512VNNIInt8Kernel() noexcept;
+
+    //! fp32 to bfloat16 conversion built on AVX-512 BF16 (vcvtne2ps2bf16),
+    //! compiled separately for the same reason.
+    static FloatToHalfKernel<Core::BFloat16> AVX512BF16FromFloat() noexcept;
+};
+}  // namespace CubbyDNN::Compute
+
+#endif
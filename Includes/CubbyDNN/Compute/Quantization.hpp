@@ -0,0 +1,88 @@
+#ifndef CUBBYDNN_QUANTIZATION_HPP
+#define CUBBYDNN_QUANTIZATION_HPP
+
+#include <CubbyDNN/Core/Span.hpp>
+
+#include <cstdint>
+
+namespace CubbyDNN::Compute
+{
+//! Affine mapping real = scale * (quantized - zeroPoint).
+struct QuantizationParam
+{
+    float scale;
+    std::int32_t zeroPoint;
+};
+
+class Quantization final
+{
+ public:
+    Quantization() = delete;
+    ~Quantization() noexcept = delete;
+    Quantization(const Quantization& rhs) = delete;
+    Quantization(Quantization&& rhs) noexcept = delete;
+
+    Quantization& operator=(const Quantization& rhs) = delete;
+    Quantization& operator=(Quantization&& rhs) noexcept = delete;
+
+    //! Unsigned 8-bit parameters covering [min, max]. The range is widened
+    //! to contain zero so that zero is represented exactly.
+    static QuantizationParam ChooseUnsigned(float min, float max) noexcept;
+
+    //! Symmetric signed parameters (zero point 0) mapping [-absMax, absMax]
+    //! onto [-maxLevel, maxLevel].
+    static QuantizationParam ChooseSymmetric(float absMax,
+                                             std::int32_t maxLevel) noexcept;
+
+    static void Quantize(const Core::Span<float> input,
+                         const QuantizationParam& param,
+                         Core::Span<std::uint8_t> output) noexcept;
+
+    //! Quantizes to signed values clamped to [-maxLevel, maxLevel].
+    static void Quantize(const Core::Span<float> input,
+                         const QuantizationParam& param, std::int32_t maxLevel,
+                         Core::Span<std::int8_t> output) noexcept;
+
+    //! Symmetric per-row quantization of a numRow x rowSize matrix. Writes
+    //! the parameters and the sum of the quantized values of every row.
+    static void QuantizeRows(std::size_t numRow, std::size_t rowSize,
+                             const Core::Span<float> input,
+                             std::int32_t maxLevel,
+                             Core::Span<std::int8_t> output,
+                             Core::Span<QuantizationParam> param,
+                             Core::Span<std::int32_t> rowSum) noexcept;
+
+    static void RowSum(std::size_t numRow, std::size_t rowSize,
+                       const Core::Span<std::uint8_t> input,
+                       Core::Span<std::int32_t> rowSum) noexcept;
+
+    //! Epilogue of GEMM::GemmU8S8 / GemmS8S8 for c(m x n) = a * b^T:
+    //! output(i, j) = aParam.scale * bParam[j].scale * (acc(i, j)
+    //!     - za * bRowSum[j] - zb[j] * aRowSum[i] + k * za * zb[j]) + bias[j]
+    //! bParam holds either one entry (per tensor) or n (per row of b).
+    //! aRowSum is only read when a zero point of b is non-zero, and bias may
+    //! be empty.
+    static void Dequantize(std::size_t m, std::size_t n, std::size_t k,
+                           const Core::Span<std::int32_t> accumulator,
+                           const QuantizationParam& aParam,
+                           const Core::Span<std::int32_t> aRowSum,
+                           const Core::Span<QuantizationParam> bParam,
+                           const Core::Span<std::int32_t> bRowSum,
+                           const Core::Span<float> bias,
+                           Core::Span<float> output) noexcept;
+
+    //! Same as Dequantize, followed by quantization to outputParam so that
+    //! the result can feed the next int8 GEMM directly.
+    static void Requantize(std::size_t m, std::size_t n, std::size_t k,
+                           const Core::Span<std::int32_t> accumulator,
+                           const QuantizationParam& aParam,
+                           const Core::Span<std::int32_t> aRowSum,
+                           const Core::Span<QuantizationParam> bParam,
+                           const Core::Span<std::int32_t> bRowSum,
+                           const Core::Span<float> bias,
+                           const QuantizationParam& outputParam,
+                           Core::Span<std::uint8_t> output) noexcept;
+};
+}  // namespace CubbyDNN::Compute
+
+#endif
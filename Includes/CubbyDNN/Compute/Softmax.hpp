@@ -0,0 +1,65 @@
+#ifndef CUBBYDNN_COMPUTE_SOFTMAX_HPP
+#define CUBBYDNN_COMPUTE_SOFTMAX_HPP
+
+#include <CubbyDNN/Core/Shape.hpp>
+#include <CubbyDNN/Core/Span.hpp>
+
+#include <vector>
+
+namespace CubbyDNN::Compute
+{
+//! Where the groups of a softmax lie in a tensor, with axis 0 innermost.
+//! The tensor is cut into blocks at blockOffsetList, each made of the rows
+//! of rowLength contiguous values at rowOffsetList from it. When
+//! isRowGrouped, all the rows of a block form one group; otherwise every
+//! position along the rows is a group of its own, one value per row.
+struct SoftmaxLayout
+{
+    std::size_t rowLength = 0;
+    bool isRowGrouped = true;
+    std::vector<std::size_t> rowOffsetList;
+    std::vector<std::size_t> blockOffsetList;
+};
+
+//! Softmax over groups of values, computed group by group with strided loops
+//! rather than an index computed per value. Each group is shifted by its own
+//! maximum, and its exponentials are taken once and kept in the output while
+//! their sum is formed. Rows go through the SoftmaxKernel of the active
+//! instruction set, and work is split over the blocks, and over chunks of the
+//! rows when each position is a group of its own.
+class Softmax final
+{
+ public:
+    Softmax() = delete;
+    ~Softmax() noexcept = delete;
+    Softmax(const Softmax& rhs) = delete;
+    Softmax(Softmax&& rhs) noexcept = delete;
+
+    Softmax& operator=(const Softmax& rhs) = delete;
+    Softmax& operator=(Softmax&& rhs) noexcept = delete;
+
+    //! Number of positions taken at a time when each is a group of its own.
+    static constexpr std::size_t ChunkSize = 1024;
+
+    //! The layout of a softmax over shape that groups the values along every
+    //! axis flagged in groupAxis, one flag per axis. Neighbouring axes with
+    //! the same flag are merged, and axes of size 1 are left out.
+    static SoftmaxLayout Layout(const Core::Shape& shape,
+                                const std::vector<bool>& groupAxis);
+
+    //! output = exp(input - max) / (sum + epsilon) for each group, with max
+    //! and sum taken over the group.
+    static void Forward(const SoftmaxLayout& layout, float epsilon,
+                        const Core::Span<float> input,
+                        Core::Span<float> output);
+
+    //! inputGradient += output * (gradient - sum(gradient * output)) for
+    //! each group, with output as Forward computes it.
+    static void BackwardAdd(const SoftmaxLayout& layout,
+                            const Core::Span<float> output,
+                            const Core::Span<float> gradient,
+                            Core::Span<float> inputGradient);
+};
+}  // namespace CubbyDNN::Compute
+
+#endif
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef CUBBYDNN_SPARSE_HPP
+#define CUBBYDNN_SPARSE_HPP
+
+#include <CubbyDNN/Core/Memory.hpp>
+#include <CubbyDNN/Core/Span.hpp>
+
+#include <cstdint>
+
+namespace CubbyDNN::Compute
+{
+enum class SparseFormat
+{
+    //! One value per non-zero.
+    CSR,
+    //! 4 x 4 blocks: a block row of four outputs reads four inputs at once.
+    Block4x4,
+    //! 8 x 1 blocks: eight outputs share every input they read.
+    Block8x1,
+};
+
+//! Block compressed sparse row matrix; CSR is the 1 x 1 block case. Only
+//! blocks holding at least one non-zero are stored. Blocks on the bottom and
+//! right edge may overhang the matrix and are zero there.
+struct SparseMatrix
+{
+    SparseFormat format;
+    std::size_t numRow;
+    std::size_t numColumn;
+    std::size_t blockRow;
+    std::size_t blockColumn;
+
+    //! Index of the first block of every block row, plus the block count.
+    Core::Memory<std::size_t> rowOffset;
+    //! First matrix column of every block.
+    Core::Memory<std::uint32_t> columnIndex;
+    //! blockRow x blockColumn values of every block, row-major.
+    Core::Memory<float> values;
+};
+
+class Sparse final
+{
+ public:
+    Sparse() = delete;
+    ~Sparse() noexcept = delete;
+    Sparse(const Sparse& rhs) = delete;
+    Sparse(Sparse&& rhs) noexcept = delete;
+
+    Sparse& operator=(const Sparse& rhs) = delete;
+    Sparse& operator=(Sparse&& rhs) noexcept = delete;
+
+    //! Compresses a row-major numRow x numColumn matrix, dropping every
+    //! block that is all zero.
+    static SparseMatrix FromDense(SparseFormat format, std::size_t numRow,
+                                  std::size_t numColumn,
+                                  const Core::Span<float> dense);
+
+    static void ToDense(const SparseMatrix& matrix,
+                        Core::Span<float> dense) noexcept;
+
+    //! output(batchSize x numRow) += input(batchSize x numColumn) *
+    //! weight^T, the sparse counterpart of GEMM::MultiplyAdd. Work is split
+    //! over block rows.
+    static void MultiplyAdd(std::size_t batchSize,
+                            const Core::Span<float> input,
+                            const SparseMatrix& weight,
+                            Core::Span<float> output) noexcept;
+
+    //! destination(batchSize x numColumn) += gradient(batchSize x numRow) *
+    //! weight, the sparse counterpart of GEMM::dMultiplyAddLeft. Work is
+    //! split over the batch.
+    static void dMultiplyAddLeft(std::size_t batchSize,
+                                 const Core::Span<float> gradient,
+                                 const SparseMatrix& weight,
+                                 Core::Span<float> destination) noexcept;
+};
+}  // namespace CubbyDNN::Compute
+
+#endif
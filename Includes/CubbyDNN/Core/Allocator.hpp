@@ -0,0 +1,154 @@
+#ifndef CUBBYDNN_ALLOCATOR_HPP
+#define CUBBYDNN_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace CubbyDNN::Core
+{
+//! Every buffer a Memory allocates starts on a cache line, and its capacity
+//! is rounded up to whole cache lines.
+constexpr std::size_t CacheLineSize = 64;
+
+//! Source of the blocks behind every Memory. Blocks start on a cache line
+//! and are returned with the size they were requested with.
+class Allocator
+{
+ public:
+    Allocator() = default;
+    virtual ~Allocator() noexcept = default;
+
+    Allocator(const Allocator& rhs) = delete;
+    Allocator(Allocator&& rhs) noexcept = delete;
+
+    Allocator& operator=(const Allocator& rhs) = delete;
+    Allocator& operator=(Allocator&& rhs) noexcept = delete;
+
+    virtual void* Allocate(std::size_t numByte) = 0;
+    virtual void Deallocate(void* pointer, std::size_t numByte) noexcept = 0;
+};
+
+//! Goes to the aligned global operator new and delete every time.
+class SystemAllocator final : public Allocator
+{
+ public:
+    void* Allocate(std::size_t numByte) override;
+    void Deallocate(void* pointer, std::size_t numByte) noexcept override;
+};
+
+//! How the pages of a large buffer are backed.
+enum class HugePagePolicy
+{
+    //! The system page size.
+    None,
+    //! 2MB aligned and advised for transparent huge pages.
+    Transparent,
+    //! Reserved 2MB huge pages (MAP_HUGETLB), falling back to Transparent
+    //! when none are left.
+    Explicit,
+};
+
+//! Which NUMA nodes the pages of a large buffer are placed on.
+enum class NUMAPolicy
+{
+    //! Wherever they are first touched, which for a buffer zeroed on one
+    //! thread means the node of that thread.
+    FirstTouch,
+    //! Round-robin over every node, so that no single memory controller
+    //! serves all threads.
+    Interleave,
+    //! Touched first by the threads of the compute kernels' pool, in equal
+    //! contiguous shares like the ones the kernels split their loops into,
+    //! so that the pages are spread over the nodes those threads run on.
+    ParallelFirstTouch,
+};
+
+struct AllocationPolicy
+{
+    HugePagePolicy hugePage = HugePagePolicy::None;
+    NUMAPolicy numa = NUMAPolicy::FirstTouch;
+    //! Smaller buffers are not worth a mapping of their own and are
+    //! allocated normally.
+    std::size_t minMappedByte = std::size_t{ 1 } << 21;
+
+    bool IsDefault() const noexcept;
+};
+
+//! Maps buffers of at least policy.minMappedByte bytes directly from the
+//! system and applies the policy to them. The policies are hints: what the
+//! system cannot honor is skipped. Only Linux has mappings to apply them
+//! to; elsewhere every buffer is allocated normally.
+class PageAllocator final : public Allocator
+{
+ public:
+    explicit PageAllocator(const AllocationPolicy& policy);
+
+    void* Allocate(std::size_t numByte) override;
+    void Deallocate(void* pointer, std::size_t numByte) noexcept override;
+
+    const AllocationPolicy& Policy() const noexcept;
+
+ private:
+    bool IsMapped(std::size_t numByte) const noexcept;
+    std::size_t MappedLength(std::size_t numByte) const noexcept;
+
+    AllocationPolicy m_policy;
+    SystemAllocator m_system;
+};
+
+struct PoolStatistics
+{
+    //! Allocations served from a cached block.
+    std::size_t hitCount = 0;
+    //! Allocations that went to the upstream allocator.
+    std::size_t missCount = 0;
+    //! Bytes held in free blocks.
+    std::size_t cachedByte = 0;
+};
+
+//! Keeps freed blocks by size class and hands them out again instead of
+//! returning them upstream. Classes are four per power of two, so a block
+//! is at most 25% larger than asked for, and buffers that grow and shrink
+//! with the batch size land in the same few classes. Thread-safe.
+class PoolAllocator final : public Allocator
+{
+ public:
+    explicit PoolAllocator(Allocator& upstream);
+    ~PoolAllocator() noexcept override;
+
+    void* Allocate(std::size_t numByte) override;
+    void Deallocate(void* pointer, std::size_t numByte) noexcept override;
+
+    PoolStatistics Statistics() const;
+
+    //! Returns cached blocks upstream, largest first, until at most
+    //! maxCachedByte bytes stay cached. Returns the number of bytes released.
+    std::size_t Trim(std::size_t maxCachedByte = 0);
+
+    //! Size of the block handed out for numByte bytes.
+    static std::size_t ClassSize(std::size_t numByte) noexcept;
+
+ private:
+    Allocator& m_upstream;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::size_t, std::vector<void*>> m_freeListMap;
+    PoolStatistics m_statistics;
+};
+
+//! The allocator new Memory buffers come from. Initially a PoolAllocator
+//! over a SystemAllocator, see StandardPool().
+Allocator& DefaultAllocator() noexcept;
+
+//! Makes allocator the default for buffers allocated from now on, or the
+//! standard pool again if it is nullptr. Buffers go back to the allocator
+//! they came from, so it must outlive them.
+void SetDefaultAllocator(Allocator* allocator) noexcept;
+
+//! The pool that is the default allocator unless it was replaced.
+PoolAllocator& StandardPool() noexcept;
+}  // namespace CubbyDNN::Core
+
+#endif
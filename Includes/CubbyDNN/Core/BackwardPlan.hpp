@@ -0,0 +1,76 @@
+#ifndef CUBBYDNN_BACKWARD_PLAN_HPP
+#define CUBBYDNN_BACKWARD_PLAN_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace CubbyDNN::Node
+{
+class Node;
+class NodeInput;
+}
+
+namespace CubbyDNN::Core
+{
+//! The backward pass from a target to a set of sources (the parameters of
+//! an optimizer), compiled into the nodes in between in reverse
+//! topological order. Run() writes the gradient of every one of them with
+//! respect to the target in a single sweep: each node zeroes its gradient
+//! and runs the backward ops of the consumers it was attached to, whose
+//! gradients are already done. Which consumers those are is found once,
+//! here, instead of testing Node::HasRevDeps on every edge each time
+//! Node::EvalGradient is called for a source.
+//!
+//! Every gradient in the plan is written on each Run(), and left clean for
+//! Node::EvalGradient with the same target. Under gradient checkpointing,
+//! a consumer's output is released once the last of its inputs in the plan
+//! is done, and what was recomputed is released when Run() returns.
+//!
+//! The plan is of the graph as it was compiled, and is compiled again
+//! after inputs are attached or detached, as Graph::Fuse does; IsCurrent()
+//! tells whether any were.
+class BackwardPlan
+{
+ public:
+    BackwardPlan(Node::Node* target,
+                 const std::vector<Node::Node*>& sourceList);
+
+    BackwardPlan(const BackwardPlan& rhs) = delete;
+    BackwardPlan(BackwardPlan&& rhs) noexcept = delete;
+
+    BackwardPlan& operator=(const BackwardPlan& rhs) = delete;
+    BackwardPlan& operator=(BackwardPlan&& rhs) noexcept = delete;
+
+    //! Evaluates the gradient of every node in the plan, the sources
+    //! included. The outputs the backward ops read are evaluated as needed.
+    void Run();
+
+    const Node::Node* Target() const noexcept;
+
+    //! Whether the edges of the graph are still those it was compiled from.
+    bool IsCurrent() const noexcept;
+
+    //! Number of gradients evaluated, the target's and the sources'
+    //! included.
+    std::size_t StepCount() const noexcept;
+
+ private:
+    struct Step
+    {
+        Node::Node* node;
+        //! The inputs of consumers in the plan this node is attached at,
+        //! whose backward ops accumulate into its gradient.
+        std::vector<const Node::NodeInput*> revNodeInputList;
+        //! Consumers this node is the last input of in the plan. Their
+        //! outputs are not read again by the backward pass.
+        std::vector<Node::Node*> releaseList;
+    };
+
+    Node::Node* m_target;
+    //! Graph::Version() when the plan was compiled.
+    std::size_t m_graphVersion;
+    std::vector<Step> m_stepList;
+};
+}  // namespace CubbyDNN::Core
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef CUBBYDNN_EXECUTION_PLAN_HPP
+#define CUBBYDNN_EXECUTION_PLAN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace CubbyDNN::Node
+{
+class Node;
+}
+
+namespace CubbyDNN::Core
+{
+//! The forward pass of a set of targets, compiled into a flat list of the
+//! nodes they depend on in evaluation order, with shapes and output sizes
+//! evaluated ahead of time. Run() walks the list once and calls each dirty
+//! node's kernel directly, instead of recursing through Node::EvalOutput
+//! and re-checking every input of every node.
+//!
+//! Shapes are evaluated again only when a node the targets depend on had
+//! its shape changed, e.g. by feeding a different batch size. The nodes
+//! stay valid for lazy evaluation: a node Run() computed is clean, and one
+//! it skipped is evaluated as usual when read.
+class ExecutionPlan
+{
+ public:
+    explicit ExecutionPlan(const std::vector<Node::Node*>& targetList);
+
+    ExecutionPlan(const ExecutionPlan& rhs) = delete;
+    ExecutionPlan(ExecutionPlan&& rhs) noexcept = delete;
+
+    ExecutionPlan& operator=(const ExecutionPlan& rhs) = delete;
+    ExecutionPlan& operator=(ExecutionPlan&& rhs) noexcept = delete;
+
+    //! Evaluates the output of every target.
+    void Run();
+
+    //! Same as Run(), with every node started on Core::DefaultThreadPool()
+    //! as soon as its inputs are done, so that independent branches
+    //! overlap. Kernels run their own parallel loops on the same pool.
+    //! Runs one node at a time under gradient checkpointing, which drops
+    //! outputs depending on what else is evaluated.
+    void RunParallel();
+
+    //! Number of nodes evaluated, the targets included.
+    std::size_t StepCount() const noexcept;
+
+ private:
+    struct Step
+    {
+        Node::Node* node;
+        //! Output size under the current shapes.
+        std::size_t size;
+        //! Number of attached inputs. Inputs and parameters have none, and
+        //! no kernel to call either: their output is storage they were
+        //! given.
+        std::size_t numInput;
+        //! The steps that read the output, once per input they read it at.
+        std::vector<std::size_t> consumerList;
+    };
+
+    //! Evaluates the shapes again if one changed since the last run.
+    void UpdateShape();
+    void EvalShape();
+    static void RunStep(const Step& step);
+
+    std::vector<Node::Node*> m_targetList;
+    std::vector<Step> m_stepList;
+
+    //! Inputs each step still waits for during RunParallel().
+    std::unique_ptr<std::atomic<std::size_t>[]> m_numWaitingList;
+};
+}  // namespace CubbyDNN::Core
+
+#endif
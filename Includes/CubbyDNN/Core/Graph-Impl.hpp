@@ -55,12 +55,14 @@ T* Graph::CreateNode(const std::string& nodeName, P&&... params)
                             std::forward_as_tuple(new T(
                                 this, nodeName, std::forward<P>(params)...)))
                    .first->second.get();
+        node->m_id = m_nodeList.size();
+        m_nodeList.emplace_back(node);
     }
 
     for (const auto* nodeType = nodeTypeManager.Type<T>(); nodeType;
          nodeType = nodeType->baseType)
     {
-        m_nodeTypeMap.emplace(nodeType, node);
+        ++m_nodeCountMap[nodeType];
     }
 
     return static_cast<T*>(node);
@@ -1,7 +1,11 @@
 #ifndef CUBBYDNN_GRAPH_HPP
 #define CUBBYDNN_GRAPH_HPP
 
+#include <CubbyDNN/Core/Allocator.hpp>
+#include <CubbyDNN/Core/BackwardPlan.hpp>
+#include <CubbyDNN/Core/ExecutionPlan.hpp>
 #include <CubbyDNN/Core/GraphBuilder.hpp>
+#include <CubbyDNN/Core/MemoryPlan.hpp>
 #include <CubbyDNN/Node/Node.hpp>
 #include <CubbyDNN/Node/NodeType.hpp>
 #include <CubbyDNN/Node/NodeTypeManager.hpp>
@@ -9,19 +13,38 @@
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace CubbyDNN::Core
 {
 class Graph
 {
  public:
+    friend Node::Node;
+    friend Node::NodeInput;
+
     Graph();
+    //! Node outputs, gradients and parameters of this graph are allocated
+    //! under allocationPolicy, from a pool of its own.
+    explicit Graph(const AllocationPolicy& allocationPolicy);
 
     GraphBuilder& Builder() noexcept;
 
+    const AllocationPolicy& GetAllocationPolicy() const noexcept;
+
+    //! Where the buffers of the nodes come from.
+    Allocator& BufferAllocator() const noexcept;
+
     void Feed(const std::vector<std::tuple<std::string, Shape, Span<float>>>&
                   feedDataList) const;
 
+    //! Number of nodes; their ids run from 0 to NodeCount() - 1.
+    std::size_t NodeCount() const noexcept;
+
+    //! Changes whenever an input is attached or detached, so that what was
+    //! compiled from the edges can tell it is out of date.
+    std::size_t Version() const noexcept;
+
     std::size_t NodeCount(const Node::NodeType* nodeType) const;
 
     Node::Node* Node(const std::string& nodeName) const;
@@ -38,15 +61,108 @@ class Graph
     template <typename T, typename... P>
     T* CreateInitializer(P&&... params);
 
+    //! The targets and every node they depend on, each after its inputs:
+    //! an order the forward pass can be evaluated in.
+    std::vector<Node::Node*> SortDeps(
+        const std::vector<Node::Node*>& targetList) const;
+
+    //! The sources and every node that depends on one of them, each after
+    //! the nodes that read it: an order the backward pass can be evaluated
+    //! in.
+    std::vector<Node::Node*> SortRevDeps(
+        const std::vector<Node::Node*>& sourceList) const;
+
+    //! Whether node depends on dep, directly or through other nodes. What
+    //! node depends on is found once, as a bitset over the node ids, and
+    //! kept until another node is asked about or an input is attached, so
+    //! asking about one node for every edge of a backward pass is a lookup
+    //! each.
+    bool IsDependOn(const Node::Node* node, const Node::Node* dep) const;
+
+    //! Compiles the forward pass of the targets. See ExecutionPlan.
+    ExecutionPlan Compile(
+        const std::vector<Node::NodeWrapper>& targetList) const;
+
+    //! Compiles the backward pass from target to the sources. See
+    //! BackwardPlan.
+    BackwardPlan CompileBackward(
+        const Node::NodeWrapper& target,
+        const std::vector<Node::NodeWrapper>& sourceList) const;
+
+    //! Rewrites chains of nodes the targets depend on into fused nodes that
+    //! make fewer passes over memory:
+    //!  - a Dense whose only consumer is a ReLU with a non-negative alpha
+    //!    into a Node::FusedDense;
+    //!  - a Softmax whose only consumer is a SoftmaxCE, at 'prob', into a
+    //!    Node::FusedSoftmaxCE, when its grouped axes come first;
+    //!  - a chain of two or more ReLUs, each the only consumer of the one
+    //!    before, into a Node::FusedElementwise, once a ReLU over a Dense is
+    //!    fused with it as above.
+    //! The consumers of the last node of a chain are attached to the fused
+    //! node instead. The chain is detached, its buffers are released, and
+    //! it stays in the graph under its names, unused. A target is only
+    //! fused as the last node of a chain, and its fused node takes its place
+    //! in the returned list, which is targetList after the rewrite.
+    //!
+    //! Plans, memory plans and checkpoints are made for the nodes they
+    //! were given: fuse first.
+    std::vector<Node::Node*> Fuse(
+        const std::vector<Node::NodeWrapper>& targetList);
+
+    //! Shares the buffers of the nodes the targets depend on, replacing the
+    //! previous plan. See MemoryPlan.
+    const MemoryPlan& PlanMemory(
+        const std::vector<Node::NodeWrapper>& targetList, PlanMode mode);
+
+    //! Gives every planned node its own buffers again.
+    void ClearMemoryPlan();
+
+    //! Gradient checkpointing: the outputs of the nodes target depends on
+    //! are dropped once the forward pass is done with them, and the
+    //! backward pass recomputes them from the nearest checkpoint as it
+    //! needs them. Inputs, parameters, target and the checkpoints keep
+    //! their outputs. Replaces the previous checkpoints.
+    void EnableCheckpointing(
+        const Node::NodeWrapper& target,
+        const std::vector<Node::NodeWrapper>& checkpointList);
+
+    //! Same as above, with every ceil(sqrt(n))-th of the n nodes in
+    //! between, in evaluation order, as a checkpoint, which bounds both the
+    //! kept outputs and the recomputed segments to about sqrt(n).
+    void EnableCheckpointing(const Node::NodeWrapper& target);
+
+    void DisableCheckpointing();
+
+    bool IsCheckpointing() const noexcept;
+
     Node::NodeTypeManager nodeTypeManager;
 
  private:
+    // Declared first so that they outlive every buffer of the nodes.
+    AllocationPolicy m_allocationPolicy;
+    std::unique_ptr<PageAllocator> m_pageAllocator;
+    std::unique_ptr<PoolAllocator> m_bufferPool;
+
     GraphBuilder m_graphBuilder;
 
     std::unordered_map<std::string, std::unique_ptr<Node::Node>> m_nodeMap;
-    std::unordered_multimap<const Node::NodeType*, Node::Node*> m_nodeTypeMap;
+    std::unordered_map<const Node::NodeType*, std::size_t> m_nodeCountMap;
+    // Indexed by Node::Id().
+    std::vector<Node::Node*> m_nodeList;
     std::unordered_set<std::unique_ptr<Initializer::Initializer>>
         m_intializerSet;
+    std::vector<Node::Node*> m_recomputableList;
+
+    // The node IsDependOn was last asked about, and the ids of the nodes it
+    // depends on.
+    mutable const Node::Node* m_depsNode;
+    mutable std::vector<bool> m_depsMask;
+
+    std::size_t m_version;
+
+    // Declared last so that it releases its nodes' buffers before the nodes
+    // are destroyed.
+    std::unique_ptr<MemoryPlan> m_memoryPlan;
 };
 }  // namespace CubbyDNN::Core
 
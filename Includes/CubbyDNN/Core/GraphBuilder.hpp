@@ -1,6 +1,8 @@
 #ifndef CUBBYDNN_GRAPH_BUILDER_HPP
 #define CUBBYDNN_GRAPH_BUILDER_HPP
 
+#include <CubbyDNN/Compute/Elementwise.hpp>
+#include <CubbyDNN/Core/Half.hpp>
 #include <CubbyDNN/Core/Shape.hpp>
 #include <CubbyDNN/Initializer/InitializerWrapper.hpp>
 #include <CubbyDNN/Node/NodeWrapper.hpp>
@@ -20,8 +22,10 @@ class GraphBuilder
     void RegisterStandardNodeType();
 
     Node::NodeWrapper Input(const std::string& nodeName);
-    Node::NodeWrapper Parameter(const std::string& nodeName, const Shape& shape,
-                                Initializer::InitializerWrapper initializer);
+    Node::NodeWrapper Parameter(
+        const std::string& nodeName, const Shape& shape,
+        Initializer::InitializerWrapper initializer,
+        Precision precision = Precision::Float32);
 
     Node::NodeWrapper ReLU(Node::NodeWrapper logit, float alpha = 0.0f);
     Node::NodeWrapper Softmax(Node::NodeWrapper logit,
@@ -29,10 +33,31 @@ class GraphBuilder
 
     Node::NodeWrapper Dense(Node::NodeWrapper input, Node::NodeWrapper weight,
                             Node::NodeWrapper bias);
+    Node::NodeWrapper QuantizedDense(Node::NodeWrapper input,
+                                     Node::NodeWrapper weight,
+                                     Node::NodeWrapper bias);
 
     Node::NodeWrapper SoftmaxCE(Node::NodeWrapper label,
                                 Node::NodeWrapper prob);
 
+    //! ReLU(Dense(input, weight, bias), alpha) as one node; bias may be
+    //! nullptr for none. See Node::FusedDense.
+    Node::NodeWrapper FusedDense(Node::NodeWrapper input,
+                                 Node::NodeWrapper weight,
+                                 Node::NodeWrapper bias, float alpha = 0.0f);
+
+    //! SoftmaxCE(label, Softmax(logit, reduceAxis)) as one node. See
+    //! Node::FusedSoftmaxCE.
+    Node::NodeWrapper FusedSoftmaxCE(Node::NodeWrapper label,
+                                     Node::NodeWrapper logit,
+                                     const std::vector<bool>& reduceAxis);
+
+    //! The element-wise steps of opList over input as one node. See
+    //! Node::FusedElementwise.
+    Node::NodeWrapper FusedElementwise(
+        Node::NodeWrapper input,
+        const std::vector<Compute::ElementwiseOp>& opList);
+
     Initializer::InitializerWrapper InitConstant(float constant = 0.0f);
     Initializer::InitializerWrapper InitXavier(
         std::mt19937_64::result_type seed, std::size_t fanIn,
@@ -0,0 +1,134 @@
+#ifndef CUBBYDNN_HALF_HPP
+#define CUBBYDNN_HALF_HPP
+
+#include <cstdint>
+#include <cstring>
+
+namespace CubbyDNN::Core
+{
+//! Element type a tensor is stored in. Arithmetic always runs in fp32;
+//! half-precision values are widened when they are loaded.
+enum class Precision
+{
+    Float32,
+    BFloat16,
+    Float16,
+};
+
+//! bfloat16: the upper 16 bits of an IEEE binary32, i.e. the full fp32 range
+//! with an 8-bit significand.
+struct BFloat16
+{
+    std::uint16_t bits;
+
+    //! Rounds to nearest even; NaN stays NaN.
+    static BFloat16 FromFloat(float value) noexcept;
+    float ToFloat() const noexcept;
+};
+
+//! IEEE binary16: 5-bit exponent and 11-bit significand. Values beyond
+//! 65504 become infinity.
+struct Float16
+{
+    std::uint16_t bits;
+
+    //! Rounds to nearest even; NaN stays NaN.
+    static Float16 FromFloat(float value) noexcept;
+    float ToFloat() const noexcept;
+};
+
+static_assert(sizeof(BFloat16) == 2 && sizeof(Float16) == 2);
+
+inline BFloat16 BFloat16::FromFloat(float value) noexcept
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    // Rounding could carry a NaN payload into infinity; quiet it instead.
+    if ((bits & 0x7FFFFFFFu) > 0x7F800000u)
+    {
+        return BFloat16{ static_cast<std::uint16_t>((bits >> 16) | 0x40u) };
+    }
+
+    bits += 0x7FFFu + ((bits >> 16) & 1u);
+
+    return BFloat16{ static_cast<std::uint16_t>(bits >> 16) };
+}
+
+inline float BFloat16::ToFloat() const noexcept
+{
+    const std::uint32_t widened = static_cast<std::uint32_t>(bits) << 16;
+    float value;
+    std::memcpy(&value, &widened, sizeof(value));
+
+    return value;
+}
+
+inline Float16 Float16::FromFloat(float value) noexcept
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const std::uint32_t sign = (bits >> 16) & 0x8000u;
+    bits &= 0x7FFFFFFFu;
+
+    std::uint32_t result;
+
+    if (bits >= 0x47800000u)
+    {
+        // Too large for binary16, infinity or NaN.
+        result = bits > 0x7F800000u ? 0x7E00u : 0x7C00u;
+    }
+    else if (bits < 0x38800000u)
+    {
+        // Subnormal or zero: adding 0.5f lines the binary16 subnormal up
+        // with the low significand bits and lets the FPU do the rounding.
+        float magnitude;
+        std::memcpy(&magnitude, &bits, sizeof(magnitude));
+        magnitude += 0.5f;
+        std::memcpy(&result, &magnitude, sizeof(result));
+        result -= 0x3F000000u;
+    }
+    else
+    {
+        // Rebias the exponent and round the 13 dropped bits to nearest even.
+        const std::uint32_t isOdd = (bits >> 13) & 1u;
+        result = (bits + 0xC8000FFFu + isOdd) >> 13;
+    }
+
+    return Float16{ static_cast<std::uint16_t>(result | sign) };
+}
+
+inline float Float16::ToFloat() const noexcept
+{
+    std::uint32_t widened = (static_cast<std::uint32_t>(bits) & 0x7FFFu)
+                            << 13;
+    const std::uint32_t exponent = widened & 0x0F800000u;
+
+    widened += 0x38000000u;
+
+    if (exponent == 0x0F800000u)
+    {
+        // Infinity or NaN.
+        widened += 0x38000000u;
+    }
+    else if (exponent == 0)
+    {
+        // Subnormal: let the FPU normalize it.
+        widened += 0x00800000u;
+        float value;
+        std::memcpy(&value, &widened, sizeof(value));
+        value -= 6.103515625e-05f;
+        std::memcpy(&widened, &value, sizeof(widened));
+    }
+
+    widened |= (static_cast<std::uint32_t>(bits) & 0x8000u) << 16;
+
+    float value;
+    std::memcpy(&value, &widened, sizeof(value));
+
+    return value;
+}
+}  // namespace CubbyDNN::Core
+
+#endif
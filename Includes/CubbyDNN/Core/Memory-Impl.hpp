@@ -1,6 +1,12 @@
 #ifndef CUBBYDNN_MEMORY_IMPL_HPP
 #define CUBBYDNN_MEMORY_IMPL_HPP
 
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
 namespace CubbyDNN::Core
 {
 template <typename T>
@@ -10,8 +16,16 @@ Memory<T>::Memory() : m_size(0), m_capacity(0), m_pointer()
 }
 
 template <typename T>
-Memory<T>::Memory(std::size_t size)
-    : m_size(size), m_capacity(size), m_pointer(std::make_unique<T[]>(size))
+Memory<T>::Memory(std::size_t size) : Memory(size, DefaultAllocator())
+{
+    // Do nothing
+}
+
+template <typename T>
+Memory<T>::Memory(std::size_t size, Allocator& allocator)
+    : m_size(size),
+      m_capacity(PaddedCapacity(size)),
+      m_pointer(Allocate(m_capacity, allocator))
 {
     // Do nothing
 }
@@ -20,7 +34,7 @@ template <typename T>
 Memory<T>::Memory(const Memory& rhs)
     : m_size(rhs.m_size),
       m_capacity(rhs.m_capacity),
-      m_pointer(std::make_unique<T[]>(rhs.m_capacity))
+      m_pointer(Allocate(rhs.m_capacity, DefaultAllocator()))
 {
     std::memcpy(m_pointer.get(), rhs.m_pointer.get(), sizeof(T) * rhs.m_size);
 }
@@ -37,7 +51,8 @@ Memory<T>::Memory(Memory&& rhs) noexcept
 template <typename T>
 Memory<T>& Memory<T>::operator=(const Memory& rhs)
 {
-    Swap(*this, rhs);
+    Memory copy(rhs);
+    Swap(*this, copy);
 
     return *this;
 }
@@ -70,6 +85,12 @@ Span<T> Memory<T>::GetSpan() const noexcept
 
 template <typename T>
 void Memory<T>::Resize(std::size_t size)
+{
+    Resize(size, DefaultAllocator());
+}
+
+template <typename T>
+void Memory<T>::Resize(std::size_t size, Allocator& allocator)
 {
     m_size = size;
 
@@ -78,8 +99,8 @@ void Memory<T>::Resize(std::size_t size)
         return;
     }
 
-    m_capacity = size;
-    m_pointer = std::make_unique<T[]>(m_capacity);
+    m_capacity = PaddedCapacity(size);
+    m_pointer = Allocate(m_capacity, allocator);
 }
 
 template <typename T>
@@ -90,8 +111,59 @@ void Memory<T>::Reserve(std::size_t capacity)
         return;
     }
 
-    m_capacity = capacity;
-    m_pointer = std::make_unique<T[]>(m_capacity);
+    m_capacity = PaddedCapacity(capacity);
+    m_pointer = Allocate(m_capacity, DefaultAllocator());
+}
+
+template <typename T>
+Memory<T> Memory<T>::View(T* base, std::size_t size) noexcept
+{
+    Memory view;
+
+    view.m_size = size;
+    view.m_capacity = size;
+    view.m_pointer = Pointer(base, Deleter{});
+
+    return view;
+}
+
+template <typename T>
+void Memory<T>::Deleter::operator()(T* pointer) const noexcept
+{
+    if (allocator)
+    {
+        allocator->Deallocate(pointer, numByte);
+    }
+}
+
+template <typename T>
+std::size_t Memory<T>::PaddedCapacity(std::size_t capacity) noexcept
+{
+    const std::size_t numByte =
+        (capacity * sizeof(T) + CacheLineSize - 1) / CacheLineSize *
+        CacheLineSize;
+
+    return numByte / sizeof(T);
+}
+
+template <typename T>
+typename Memory<T>::Pointer Memory<T>::Allocate(std::size_t capacity,
+                                                 Allocator& allocator)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Memory copies its elements with memcpy");
+
+    if (!capacity)
+    {
+        return Pointer();
+    }
+
+    const std::size_t numByte = capacity * sizeof(T);
+
+    void* pointer = allocator.Allocate(numByte);
+    std::memset(pointer, 0, numByte);
+
+    return Pointer(static_cast<T*>(pointer), Deleter{ &allocator, numByte });
 }
 
 template <typename T>
@@ -103,6 +175,57 @@ void Swap(Memory<T>& left, Memory<T>& right) noexcept
     swap(left.m_capacity, right.m_capacity);
     swap(left.m_pointer, right.m_pointer);
 }
+
+template <typename T>
+ScratchMemory<T>::ScratchMemory(std::size_t size)
+{
+    Stack& stack = ThreadStack();
+
+    if (stack.bufferList.size() == stack.depth)
+    {
+        stack.bufferList.emplace_back();
+    }
+
+    // Moving the buffers as the list grows keeps their elements in place.
+    Memory<T>& buffer = stack.bufferList[stack.depth];
+    buffer.Resize(size);
+
+    m_data = buffer.GetSpan().begin();
+    ++stack.depth;
+}
+
+template <typename T>
+ScratchMemory<T>::~ScratchMemory() noexcept
+{
+    --ThreadStack().depth;
+}
+
+template <typename T>
+T* ScratchMemory<T>::Data() const noexcept
+{
+    return m_data;
+}
+
+template <typename T>
+typename ScratchMemory<T>::Stack& ScratchMemory<T>::ThreadStack() noexcept
+{
+    static thread_local Stack stack;
+
+    return stack;
+}
+
+template <typename T>
+void CheckAlignment([[maybe_unused]] const Span<T>& span) noexcept
+{
+#if defined(CUBBYDNN_CHECK_ALIGNMENT)
+    if (reinterpret_cast<std::uintptr_t>(span.begin()) % CacheLineSize != 0)
+    {
+        std::fprintf(stderr, "CubbyDNN: span at %p is not cache-line aligned\n",
+                     static_cast<const void*>(span.begin()));
+        std::abort();
+    }
+#endif
+}
 }  // namespace CubbyDNN::Core
 
 #endif
\ No newline at end of file
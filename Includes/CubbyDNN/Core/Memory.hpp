@@ -1,18 +1,23 @@
 #ifndef CUBBYDNN_MEMORY_HPP
 #define CUBBYDNN_MEMORY_HPP
 
+#include <CubbyDNN/Core/Allocator.hpp>
 #include <CubbyDNN/Core/Span.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace CubbyDNN::Core
 {
+//! Holds a zero-initialized buffer of trivially copyable T, allocated from
+//! DefaultAllocator() unless an allocator is given.
 template <typename T>
 class Memory
 {
  public:
     Memory();
     Memory(std::size_t size);
+    Memory(std::size_t size, Allocator& allocator);
     Memory(const Memory& rhs);
     Memory(Memory&& rhs) noexcept;
     ~Memory() noexcept = default;
@@ -24,16 +29,79 @@ class Memory
     std::size_t Capacity() const noexcept;
     Span<T> GetSpan() const noexcept;
     void Resize(std::size_t size);
+    //! Same as above, taking a new buffer from allocator if it grows.
+    void Resize(std::size_t size, Allocator& allocator);
     void Reserve(std::size_t capacity);
 
-    template <typename T>
-    friend void Swap(Memory<T>& left, Memory<T>& right) noexcept;
+    //! Uses size elements at base without owning them. Resizing it past size
+    //! moves it to an allocation of its own.
+    static Memory View(T* base, std::size_t size) noexcept;
+
+    template <typename U>
+    friend void Swap(Memory<U>& left, Memory<U>& right) noexcept;
 
  private:
+    struct Deleter
+    {
+        void operator()(T* pointer) const noexcept;
+
+        //! Where the buffer goes back to, or nullptr for a view.
+        Allocator* allocator = nullptr;
+        std::size_t numByte = 0;
+    };
+
+    using Pointer = std::unique_ptr<T[], Deleter>;
+
+    //! Rounds capacity up to whole cache lines.
+    static std::size_t PaddedCapacity(std::size_t capacity) noexcept;
+    //! Allocates capacity zeroed elements on a cache line.
+    static Pointer Allocate(std::size_t capacity, Allocator& allocator);
+
     std::size_t m_size;
     std::size_t m_capacity;
-    std::unique_ptr<T[]> m_pointer;
+    Pointer m_pointer;
 };
+
+//! Scratch of size elements from a stack of buffers that the calling thread
+//! keeps from one call to the next, so that only a call needing more than
+//! any before it allocates. A thread waiting on the pool may run a task that
+//! takes scratch of its own: that task gets the next buffer of the stack,
+//! and gives it back when its ScratchMemory goes out of scope. Each must
+//! therefore be destroyed on the thread that made it, in reverse order, as
+//! locals are. The contents are left over from earlier use.
+template <typename T>
+class ScratchMemory
+{
+ public:
+    explicit ScratchMemory(std::size_t size);
+    ~ScratchMemory() noexcept;
+
+    ScratchMemory(const ScratchMemory& rhs) = delete;
+    ScratchMemory(ScratchMemory&& rhs) noexcept = delete;
+
+    ScratchMemory& operator=(const ScratchMemory& rhs) = delete;
+    ScratchMemory& operator=(ScratchMemory&& rhs) noexcept = delete;
+
+    T* Data() const noexcept;
+
+ private:
+    struct Stack
+    {
+        //! Number of buffers in use, from the front of bufferList.
+        std::size_t depth = 0;
+        std::vector<Memory<T>> bufferList;
+    };
+
+    static Stack& ThreadStack() noexcept;
+
+    T* m_data;
+};
+
+//! Aborts when span does not start on a cache line. Every node checks its
+//! output and gradient before they are handed to Compute; the check
+//! compiles to nothing unless CUBBYDNN_CHECK_ALIGNMENT is defined.
+template <typename T>
+void CheckAlignment(const Span<T>& span) noexcept;
 }  // namespace CubbyDNN::Core
 
 #include <CubbyDNN/Core/Memory-Impl.hpp>
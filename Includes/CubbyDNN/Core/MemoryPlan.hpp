@@ -0,0 +1,75 @@
+#ifndef CUBBYDNN_MEMORY_PLAN_HPP
+#define CUBBYDNN_MEMORY_PLAN_HPP
+
+#include <CubbyDNN/Core/Memory.hpp>
+
+#include <vector>
+
+namespace CubbyDNN::Node
+{
+class Node;
+}
+
+namespace CubbyDNN::Core
+{
+enum class PlanMode
+{
+    //! Forward outputs share memory. Gradients cannot be evaluated through
+    //! the planned nodes.
+    Inference,
+    //! Gradients share memory. Forward outputs keep their own buffers, as
+    //! the backward pass reads them.
+    Training,
+};
+
+//! Places the output (or gradient) buffers of every node the targets depend
+//! on in one arena. Two buffers overlap only when, in any order the graph
+//! can be evaluated in, every reader of one is done before the other is
+//! written: for outputs, when one node depends on every consumer of the
+//! other. A node whose buffer is overwritten is marked dirty and recomputed
+//! if it is read again. Targets, inputs and parameters keep their own
+//! buffers.
+//!
+//! Sizes are taken from the shapes at the time the plan is made. A buffer
+//! that later outgrows its slot moves to an allocation of its own.
+class MemoryPlan
+{
+ public:
+    MemoryPlan(const std::vector<Node::Node*>& targetList, PlanMode mode);
+    ~MemoryPlan() noexcept;
+
+    MemoryPlan(const MemoryPlan& rhs) = delete;
+    MemoryPlan(MemoryPlan&& rhs) noexcept = delete;
+
+    MemoryPlan& operator=(const MemoryPlan& rhs) = delete;
+    MemoryPlan& operator=(MemoryPlan&& rhs) noexcept = delete;
+
+    PlanMode Mode() const noexcept;
+
+    //! Number of buffers placed in the arena.
+    std::size_t BufferCount() const noexcept;
+
+    //! Bytes the planned buffers take with one allocation each.
+    std::size_t NaiveSize() const noexcept;
+
+    //! Bytes of the arena they share instead.
+    std::size_t PlannedSize() const noexcept;
+
+ private:
+    struct Buffer
+    {
+        Node::Node* node;
+        std::size_t size;
+        std::size_t offset;
+    };
+
+    Memory<float>& PlannedMemory(Node::Node* node) const noexcept;
+
+    PlanMode m_mode;
+    std::vector<Buffer> m_bufferList;
+    std::size_t m_naiveSize;
+    Memory<float> m_arena;
+};
+}  // namespace CubbyDNN::Core
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 
 namespace CubbyDNN::Core
 {
@@ -115,7 +116,8 @@ Span<T> Span<T>::SubSpan(std::size_t offset) const noexcept
 template <typename T>
 Span<T> Span<T>::SubSpan(std::size_t offset, std::size_t length) const noexcept
 {
-    return Span(m_base + offset, m_base + std::min(m_length, length));
+    return Span(m_base + offset,
+                m_base + offset + std::min(m_length - offset, length));
 }
 
 template <typename T>
@@ -0,0 +1,130 @@
+#ifndef CUBBYDNN_THREAD_POOL_HPP
+#define CUBBYDNN_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CubbyDNN::Core
+{
+class TaskGroup;
+
+//! A fixed set of threads that run tasks from per-thread deques. A thread
+//! runs its newest task first and, when it has none, steals the oldest task
+//! of another thread. A thread waiting for a TaskGroup runs tasks in the
+//! meantime, so parallel loops started from inside a task (kernels of
+//! nodes that are themselves evaluated in parallel) are shared out over the
+//! same threads instead of starting threads of their own.
+class ThreadPool
+{
+ public:
+    //! numThread threads run tasks, the one waiting for them included, so
+    //! numThread - 1 workers are started.
+    explicit ThreadPool(std::size_t numThread);
+    ~ThreadPool() noexcept;
+
+    ThreadPool(const ThreadPool& rhs) = delete;
+    ThreadPool(ThreadPool&& rhs) noexcept = delete;
+
+    ThreadPool& operator=(const ThreadPool& rhs) = delete;
+    ThreadPool& operator=(ThreadPool&& rhs) noexcept = delete;
+
+    std::size_t ThreadCount() const noexcept;
+
+    //! Calls body(begin, end) over [0, count) cut into ranges of grain
+    //! indices, on at most numThread threads at once, the calling one
+    //! included. Ranges are handed out in order as threads become free, so
+    //! a grain of count / numThread shares the indices out as
+    //! schedule(static) would and a smaller one balances like
+    //! schedule(dynamic, grain). Returns once every range is done.
+    void ParallelFor(
+        std::size_t count, std::size_t grain, std::size_t numThread,
+        const std::function<void(std::size_t, std::size_t)>& body);
+
+ private:
+    friend TaskGroup;
+
+    struct Task
+    {
+        std::function<void()> function;
+        TaskGroup* group;
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> taskList;
+    };
+
+    //! The queue of the calling thread: its own for a worker, one shared by
+    //! every other thread otherwise.
+    std::size_t QueueIndex() const noexcept;
+
+    void Push(Task task);
+    bool Pop(Task& task);
+
+    //! Runs one task, if any is left. Returns whether one was run.
+    bool RunOne();
+
+    void WorkerLoop(std::size_t index);
+
+    std::vector<std::unique_ptr<Queue>> m_queueList;
+    std::vector<std::thread> m_workerList;
+
+    std::atomic<std::size_t> m_numTask;
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeCondition;
+    bool m_isStopping;
+};
+
+//! Tasks run on a pool and waited for together. The first exception a
+//! task throws is rethrown by Wait().
+class TaskGroup
+{
+ public:
+    explicit TaskGroup(ThreadPool& pool);
+    //! Waits for the tasks left, dropping any exception.
+    ~TaskGroup() noexcept;
+
+    TaskGroup(const TaskGroup& rhs) = delete;
+    TaskGroup(TaskGroup&& rhs) noexcept = delete;
+
+    TaskGroup& operator=(const TaskGroup& rhs) = delete;
+    TaskGroup& operator=(TaskGroup&& rhs) noexcept = delete;
+
+    //! Queues task on the calling thread's deque. It may be called from
+    //! other tasks of the group.
+    void Run(std::function<void()> task);
+
+    //! Runs tasks of the pool until every task of the group is done.
+    void Wait();
+
+ private:
+    friend ThreadPool;
+
+    void Finish(std::exception_ptr exception) noexcept;
+
+    ThreadPool& m_pool;
+    std::atomic<std::size_t> m_numPending;
+
+    std::mutex m_exceptionMutex;
+    std::exception_ptr m_exception;
+};
+
+//! The pool the compute kernels and ExecutionPlan::RunParallel() run on.
+//! Initially one of std::thread::hardware_concurrency() threads.
+ThreadPool& DefaultThreadPool() noexcept;
+
+//! Makes pool the default from now on, or the standard one again if it is
+//! nullptr. It must outlive every use through DefaultThreadPool().
+void SetDefaultThreadPool(ThreadPool* pool) noexcept;
+}  // namespace CubbyDNN::Core
+
+#endif
@@ -1,12 +1,13 @@
 #ifndef CUBBYDNN_DENSE_HPP
 #define CUBBYDNN_DENSE_HPP
 
+#include <CubbyDNN/Compute/GEMM.hpp>
 #include <CubbyDNN/Core/Graph.hpp>
 #include <CubbyDNN/Node/Node.hpp>
 
 namespace CubbyDNN::Node
 {
-class Dense final : public Node
+class Dense : public Node
 {
  public:
     Dense(Core::Graph* graph, std::string_view name);
@@ -21,10 +22,17 @@ class Dense final : public Node
     const NodeType* Type() const override;
     static std::string_view TypeName();
 
- private:
+ protected:
+    //! A Dense whose output goes through the activation of epilogue, which
+    //! is applied to each tile of the product as it is finished. Its bias
+    //! is ignored; the one attached at "bias" is used.
+    Dense(Core::Graph* graph, std::string_view name,
+          const Compute::GEMM::Epilogue& epilogue);
+
     void EvalShapeInternal() override;
     void EvalOutputInternal() override;
 
+ private:
     void BackwardOpInput(const Node* dy);
     void BackwardOpWeight(const Node* dy);
     void BackwardOpBias(const Node* dy);
@@ -32,6 +40,10 @@ class Dense final : public Node
     NodeInput m_input;
     NodeInput m_inputWeight;
     NodeInput m_inputBias;
+
+    const Compute::GEMM::Epilogue m_epilogue;
+
+    Core::Memory<float> m_ones;
 };
 }  // namespace CubbyDNN::Node
 
@@ -0,0 +1,40 @@
+#ifndef CUBBYDNN_FUSED_DENSE_HPP
+#define CUBBYDNN_FUSED_DENSE_HPP
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Dense.hpp>
+
+namespace CubbyDNN::Node
+{
+//! A Dense followed by a ReLU with the given alpha, as Core::Graph::Fuse
+//! rewrites them. The bias and the activation are applied by the GEMM
+//! epilogue, so the product is written once and never read back. The
+//! gradient of this node, once evaluated, is the one before the activation,
+//! which the three inputs share.
+//!
+//! The activation is undone from the output, so alpha must not be negative.
+//! As for Node::ReLU, a product of exactly zero passes alpha times its
+//! gradient on.
+class FusedDense final : public Dense
+{
+ public:
+    FusedDense(Core::Graph* graph, std::string_view name, float _alpha);
+    FusedDense(const FusedDense& rhs) = delete;
+    FusedDense(FusedDense&& rhs) noexcept = delete;
+
+    virtual ~FusedDense() noexcept = default;
+
+    FusedDense& operator=(const FusedDense& rhs) = delete;
+    FusedDense& operator=(FusedDense&& rhs) noexcept = delete;
+
+    const NodeType* Type() const override;
+    static std::string_view TypeName();
+
+    const float alpha = 0.0;
+
+ private:
+    void EvalGradientInternal() override;
+};
+}  // namespace CubbyDNN::Node
+
+#endif
\ No newline at end of file
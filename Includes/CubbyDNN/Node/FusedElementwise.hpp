@@ -0,0 +1,42 @@
+#ifndef CUBBYDNN_FUSED_ELEMENTWISE_HPP
+#define CUBBYDNN_FUSED_ELEMENTWISE_HPP
+
+#include <CubbyDNN/Compute/Elementwise.hpp>
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Node.hpp>
+
+namespace CubbyDNN::Node
+{
+//! A chain of element-wise nodes, as Core::Graph::Fuse rewrites them, run
+//! by Compute::Elementwise: only the output of the last step is kept, and
+//! the backward pass recomputes the others from 'input'.
+class FusedElementwise final : public Node
+{
+ public:
+    FusedElementwise(Core::Graph* graph, std::string_view name,
+                     const std::vector<Compute::ElementwiseOp>& _opList);
+    FusedElementwise(const FusedElementwise& rhs) = delete;
+    FusedElementwise(FusedElementwise&& rhs) noexcept = delete;
+
+    virtual ~FusedElementwise() noexcept = default;
+
+    FusedElementwise& operator=(const FusedElementwise& rhs) = delete;
+    FusedElementwise& operator=(FusedElementwise&& rhs) noexcept = delete;
+
+    const NodeType* Type() const override;
+    static std::string_view TypeName();
+
+    //! The steps, first to last.
+    const std::vector<Compute::ElementwiseOp> opList;
+
+ private:
+    void EvalShapeInternal() override;
+    void EvalOutputInternal() override;
+
+    void BackwardOp(const Node* dy);
+
+    NodeInput m_input;
+};
+}  // namespace CubbyDNN::Node
+
+#endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef CUBBYDNN_FUSED_SOFTMAX_CE_HPP
+#define CUBBYDNN_FUSED_SOFTMAX_CE_HPP
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Node.hpp>
+
+namespace CubbyDNN::Node
+{
+//! A Softmax over groupAxis followed by a SoftmaxCE, as Core::Graph::Fuse
+//! rewrites them: the cross entropy between 'label' and the softmax of
+//! 'logit'. It is computed in log space from the logits, without the 1e-4
+//! the two nodes guard their divisions and logarithms with. The
+//! probabilities are kept from the forward pass, so the gradient of 'logit'
+//! is prob - label per element, scaled, with no logarithm or division; labels
+//! that do not sum to one over a group scale prob by their sum. Like
+//! Compute::Softmax, the forward pass runs on the SoftmaxKernel of the
+//! active instruction set, with the groups split over the default pool.
+//!
+//! groupAxis must list the grouped axes first, so that every group is a
+//! contiguous run of values, as with { true, false } for logits of
+//! [classes, batch].
+class FusedSoftmaxCE final : public Node
+{
+ public:
+    FusedSoftmaxCE(Core::Graph* graph, std::string_view name,
+                   const std::vector<bool>& _groupAxis);
+    FusedSoftmaxCE(const FusedSoftmaxCE& rhs) = delete;
+    FusedSoftmaxCE(FusedSoftmaxCE&& rhs) noexcept = delete;
+
+    virtual ~FusedSoftmaxCE() noexcept = default;
+
+    FusedSoftmaxCE& operator=(const FusedSoftmaxCE& rhs) = delete;
+    FusedSoftmaxCE& operator=(FusedSoftmaxCE&& rhs) noexcept = delete;
+
+    const NodeType* Type() const override;
+    static std::string_view TypeName();
+
+    //! Whether a Softmax over groupAxis can be fused.
+    static bool IsFusable(const std::vector<bool>& groupAxis);
+
+    //! The softmax of 'logit', once the output is evaluated.
+    Core::Span<float> Probability() const noexcept;
+
+    const std::vector<bool> groupAxis;
+
+ private:
+    void EvalShapeInternal() override;
+    void EvalOutputInternal() override;
+
+    void BackwardOpLabel(const Node* dy);
+    void BackwardOpLogit(const Node* dy);
+
+    NodeInput m_inputLabel;
+    NodeInput m_inputLogit;
+
+    //! Number of values in a group.
+    std::size_t m_groupSize;
+    Core::Memory<float> m_probability;
+    //! Per group, the log of the softmax denominator, max included, the sum
+    //! of the labels, and the sum of label * log(prob).
+    Core::Memory<float> m_logSummation;
+    Core::Memory<float> m_labelSummation;
+    Core::Memory<float> m_logLikelihood;
+};
+}  // namespace CubbyDNN::Node
+
+#endif
\ No newline at end of file
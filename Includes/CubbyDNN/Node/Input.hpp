@@ -21,11 +21,14 @@ class Input final : public Node
     const NodeType* Type() const override;
     static std::string_view TypeName();
 
+    //! The output is a view of span, not a copy, so span has to stay valid
+    //! and unchanged until the next Feed.
     void Feed(const Core::Shape& shape, Core::Span<float> span);
 
  private:
     void EvalShapeInternal() override;
     void EvalOutputInternal() override;
+    Core::Span<float> OutputStorage() const noexcept override;
 
     Core::Shape m_inputShape;
     Core::Span<float> m_inputSpan;
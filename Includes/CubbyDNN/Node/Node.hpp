@@ -6,11 +6,14 @@
 #include <CubbyDNN/Node/NodeInput.hpp>
 #include <CubbyDNN/Node/NodeType.hpp>
 
-#include <unordered_set>
+#include <unordered_map>
 
 namespace CubbyDNN::Core
 {
+class BackwardPlan;
+class ExecutionPlan;
 class Graph;
+class MemoryPlan;
 }
 
 namespace CubbyDNN::Node
@@ -19,6 +22,10 @@ class Node
 {
  public:
     friend NodeInput;
+    friend Core::BackwardPlan;
+    friend Core::ExecutionPlan;
+    friend Core::Graph;
+    friend Core::MemoryPlan;
 
     Node(Core::Graph* _graph, std::string_view _name);
     virtual ~Node() noexcept = default;
@@ -34,10 +41,19 @@ class Node
     virtual const NodeType* Type() const;
     static std::string_view TypeName();
 
+    //! Index of the node in its graph, in order of creation.
+    std::size_t Id() const noexcept;
+
     const Core::Shape& Shape() const noexcept;
     Core::Span<float> Output() const noexcept;
     Core::Span<float> Gradient() const noexcept;
 
+    //! Changes whenever the output is evaluated again after being marked
+    //! dirty, so that a consumer can tell whether what it derived from the
+    //! output is still current. 0 until the first evaluation.
+    std::size_t OutputVersion() const noexcept;
+
+    //! Whether revDep depends on this node. See Core::Graph::IsDependOn.
     bool HasRevDeps(const Node* revDep) const;
 
     Node& MarkDirty(bool dirtyShape = true);
@@ -53,18 +69,72 @@ class Node
     virtual void EvalShapeInternal() = 0;
     virtual void EvalOutputInternal() = 0;
 
+    //! Storage that already holds the output. When it is at least as long
+    //! as the shape, the output is a read-only view of it and
+    //! EvalOutputInternal is not called. The default, an empty span, means
+    //! the node computes its output into a buffer of its own.
+    virtual Core::Span<float> OutputStorage() const noexcept;
+
+    //! Called once the gradient is accumulated from the consumers, or filled
+    //! with ones for the target, and before any backward op of this node
+    //! reads it. A fused node that ends in an activation turns it into the
+    //! gradient before the activation here, once for all its inputs. The
+    //! default does nothing.
+    virtual void EvalGradientInternal();
+
     Core::Shape m_shape;
     Core::Memory<float> m_output;
     Core::Memory<float> m_gradient;
     std::vector<NodeInput*> m_revNodeInputList;
-    std::unordered_set<Node*> m_deps;
-    std::unordered_set<Node*> m_revDeps;
     std::unordered_map<std::string, NodeInput*> m_nodeInputMap;
 
  private:
+    std::size_t m_id;
     bool m_isShapeDirty;
     bool m_isOutputDirty;
+    bool m_isOutputView;
+    std::size_t m_outputVersion;
     const Node* m_gradientDirty;
+
+    // Set by Core::MemoryPlan: the nodes whose buffers share memory with
+    // this node's output or gradient, and whether a gradient would read an
+    // output the plan lets other nodes overwrite.
+    std::vector<Node*> m_outputAliasList;
+    std::vector<Node*> m_gradientAliasList;
+    bool m_isForwardOnly;
+
+    // Set by Core::Graph under gradient checkpointing.
+    bool m_isRecomputable;
+
+    //! Marks the lifetime of a backward pass. Outputs recomputed during it
+    //! are kept until the outermost one ends, and released then.
+    class GradientScope
+    {
+     public:
+        explicit GradientScope(Core::Graph* _graph) noexcept;
+        ~GradientScope() noexcept;
+
+        GradientScope(const GradientScope& rhs) = delete;
+        GradientScope(GradientScope&& rhs) noexcept = delete;
+
+        GradientScope& operator=(const GradientScope& rhs) = delete;
+        GradientScope& operator=(GradientScope&& rhs) noexcept = delete;
+
+     private:
+        Core::Graph* m_graph;
+    };
+
+    //! Computes the output into a buffer of size elements and marks it
+    //! clean, once the inputs are evaluated.
+    void ComputeOutput(std::size_t size);
+
+    //! Sizes the gradient buffer for the current shape, before it is
+    //! written.
+    void PrepareGradient();
+
+    //! Drops the output of a recomputable node. It is computed again the
+    //! next time it is evaluated.
+    void ReleaseOutput() noexcept;
 };
 }  // namespace CubbyDNN::Node
 
@@ -1,9 +1,8 @@
 #ifndef CUBBYDNN_NODE_INPUT_HPP
 #define CUBBYDNN_NODE_INPUT_HPP
 
-#include <functional>
 #include <string>
-#include <unordered_set>
+#include <string_view>
 
 namespace CubbyDNN::Node
 {
@@ -12,25 +11,44 @@ class Node;
 class NodeInput
 {
  public:
-    NodeInput(Node* _node, std::string_view _name,
-              std::function<void(const Node*)> _backwardOp);
+    //! Accumulates into the gradient of the attached node what owner, the
+    //! node the input belongs to, passes back through it with respect to dy.
+    //! A plain function rather than std::function, as backward passes call
+    //! it on every edge.
+    using BackwardOp = void (*)(Node* owner, const Node* dy);
+
+    NodeInput(Node* _node, std::string_view _name, BackwardOp _backwardOp);
+
+    //! The BackwardOp that calls Member on the owner, a T.
+    template <typename T, void (T::*Member)(const Node*)>
+    static void Call(Node* owner, const Node* dy);
 
     operator bool() const;
 
     Node* InputNode() noexcept;
     const Node* InputNode() const noexcept;
 
+    //! Whether the attached node is _node or depends on it.
     bool IsDependOn(const Node* _node) const;
     void Attach(Node* inputNode);
 
+    //! Removes the edge to the attached node, if there is one, and marks
+    //! node dirty.
+    void Detach();
+
     Node* const node;
     const std::string name;
-    const std::function<void(const Node*)> backwardOp;
+    const BackwardOp backwardOp;
 
  private:
     Node* m_inputNode;
-    std::unordered_set<Node*> m_depsSet;
 };
+
+template <typename T, void (T::*Member)(const Node*)>
+void NodeInput::Call(Node* owner, const Node* dy)
+{
+    (static_cast<T*>(owner)->*Member)(dy);
+}
 }  // namespace CubbyDNN::Node
 
 #endif
\ No newline at end of file
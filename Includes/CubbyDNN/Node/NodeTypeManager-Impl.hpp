@@ -1,6 +1,8 @@
 #ifndef CUBBYDNN_NODE_TYPE_MANAGER_IMPL_HPP
 #define CUBBYDNN_NODE_TYPE_MANAGER_IMPL_HPP
 
+#include <stdexcept>
+
 namespace CubbyDNN::Node
 {
 template <class T>
@@ -27,13 +29,13 @@ void NodeTypeManager::RegisterNode()
 
     if (Type<T>())
     {
-        throw std::exception("already registered node type.");
+        throw std::runtime_error("already registered node type.");
     }
 
     const auto* baseType(Type<B>());
     if (!baseType)
     {
-        throw std::exception("base type not registered.");
+        throw std::runtime_error("base type not registered.");
     }
 
     auto typeName(T::TypeName());
@@ -1,17 +1,24 @@
 #ifndef CUBBYDNN_PARAMETER_HPP
 #define CUBBYDNN_PARAMETER_HPP
 
+#include <CubbyDNN/Compute/Sparse.hpp>
+#include <CubbyDNN/Core/Half.hpp>
 #include <CubbyDNN/Core/Shape.hpp>
 #include <CubbyDNN/Initializer/Initializer.hpp>
 #include <CubbyDNN/Node/Node.hpp>
 
+#include <memory>
+
 namespace CubbyDNN::Node
 {
 class Parameter final : public Node
 {
  public:
+    //! A half-precision parameter keeps only its half-width values: it can
+    //! be read and fed forward, e.g. for inference, but not trained.
     Parameter(Core::Graph* _graph, std::string_view _name, Core::Shape _shape,
-              Initializer::Initializer* _initializer);
+              Initializer::Initializer* _initializer,
+              Core::Precision _precision = Core::Precision::Float32);
     Parameter(const Parameter& rhs) = delete;
     Parameter(Parameter&& rhs) noexcept = delete;
 
@@ -23,16 +30,33 @@ class Parameter final : public Node
     const NodeType* Type() const override;
     static std::string_view TypeName();
 
+    //! Empty unless precision is Float32; likewise for the other two.
     Core::Span<float> GetParameter() const noexcept;
+    Core::Span<Core::BFloat16> GetBFloat16Parameter() const noexcept;
+    Core::Span<Core::Float16> GetFloat16Parameter() const noexcept;
+
+    //! Compresses the parameter, e.g. once pruned weights are in place:
+    //! all-zero blocks are dropped and the dense values are released. Only
+    //! rank-2 Float32 parameters can be sparsified, and a sparse parameter
+    //! cannot be trained.
+    void Sparsify(Compute::SparseFormat format);
+    //! nullptr unless the parameter has been sparsified.
+    const Compute::SparseMatrix* GetSparseParameter() const noexcept;
 
     const Core::Shape parameterShape;
     Initializer::Initializer* const initializer;
+    const Core::Precision precision;
 
  private:
     void EvalShapeInternal() override;
     void EvalOutputInternal() override;
+    //! The Float32 values themselves; the other forms are converted.
+    Core::Span<float> OutputStorage() const noexcept override;
 
     Core::Memory<float> m_parameter;
+    Core::Memory<Core::BFloat16> m_bf16Parameter;
+    Core::Memory<Core::Float16> m_fp16Parameter;
+    std::unique_ptr<Compute::SparseMatrix> m_sparseParameter;
 };
 }  // namespace CubbyDNN::Node
 
@@ -0,0 +1,55 @@
+#ifndef CUBBYDNN_QUANTIZED_DENSE_HPP
+#define CUBBYDNN_QUANTIZED_DENSE_HPP
+
+#include <CubbyDNN/Compute/Quantization.hpp>
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Node.hpp>
+
+#include <cstdint>
+
+namespace CubbyDNN::Node
+{
+//! Inference-only Dense on int8 arithmetic. Takes the same float inputs as
+//! Dense and produces the same float output. The weight is quantized per
+//! output row to signed 8 bits, and kept until the output of the weight node
+//! is evaluated again (see Node::OutputVersion), so a weight that changes
+//! has to be marked dirty as optimizers do. The input is quantized per
+//! tensor to unsigned 8 bits on every evaluation. Backpropagating through
+//! this node throws.
+class QuantizedDense final : public Node
+{
+ public:
+    QuantizedDense(Core::Graph* graph, std::string_view name);
+    QuantizedDense(const QuantizedDense& rhs) = delete;
+    QuantizedDense(QuantizedDense&& rhs) noexcept = delete;
+
+    virtual ~QuantizedDense() noexcept = default;
+
+    QuantizedDense& operator=(const QuantizedDense& rhs) = delete;
+    QuantizedDense& operator=(QuantizedDense&& rhs) noexcept = delete;
+
+    const NodeType* Type() const override;
+    static std::string_view TypeName();
+
+ private:
+    void EvalShapeInternal() override;
+    void EvalOutputInternal() override;
+
+    void QuantizeWeight();
+
+    NodeInput m_input;
+    NodeInput m_inputWeight;
+    NodeInput m_inputBias;
+
+    //! OutputVersion() of the weight node m_weight was quantized from, or 0.
+    std::size_t m_weightVersion;
+    Core::Memory<std::int8_t> m_weight;
+    Core::Memory<Compute::QuantizationParam> m_weightParam;
+    Core::Memory<std::int32_t> m_weightRowSum;
+
+    Core::Memory<std::uint8_t> m_quantizedInput;
+    Core::Memory<std::int32_t> m_accumulator;
+};
+}  // namespace CubbyDNN::Node
+
+#endif
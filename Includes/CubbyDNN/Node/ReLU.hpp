@@ -1,11 +1,16 @@
 #ifndef CUBBYDNN_RELU_HPP
 #define CUBBYDNN_RELU_HPP
 
+#include <CubbyDNN/Compute/Elementwise.hpp>
 #include <CubbyDNN/Core/Graph.hpp>
 #include <CubbyDNN/Node/Node.hpp>
 
 namespace CubbyDNN::Node
 {
+//! x < 0 ? alpha * x : x. At x == 0, where either slope would do, the
+//! gradient is alpha times the incoming one. For alpha >= 0 those are the
+//! values whose output is not positive, which is how FusedDense tells them
+//! apart without the input.
 class ReLU final : public Node
 {
  public:
@@ -30,6 +35,9 @@ class ReLU final : public Node
     void BackwardOp(const Node* dy);
 
     NodeInput m_inputLogit;
+
+    //! This node as a chain of one op, as Compute::Elementwise runs it.
+    const std::vector<Compute::ElementwiseOp> m_opList;
 };
 }  // namespace CubbyDNN::Node
 
@@ -1,6 +1,7 @@
 #ifndef CUBBYDNN_SOFTMAX_HPP
 #define CUBBYDNN_SOFTMAX_HPP
 
+#include <CubbyDNN/Compute/Softmax.hpp>
 #include <CubbyDNN/Core/Graph.hpp>
 #include <CubbyDNN/Node/Node.hpp>
 
@@ -30,10 +31,9 @@ class Softmax final : public Node
 
     void BackwardOp(const Node* dy);
 
-    Core::Memory<float> m_summation;
     NodeInput m_inputLogit;
-    std::vector<std::tuple<std::size_t, std::size_t, std::size_t>>
-        m_indexFactorList;
+    Compute::SoftmaxLayout m_layout;
+    float m_epsilon;
 };
 }  // namespace CubbyDNN::Node
 
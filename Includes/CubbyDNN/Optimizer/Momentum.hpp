@@ -1,9 +1,12 @@
 #ifndef CUBBYDNN_MOMENTUM_HPP
 #define CUBBYDNN_MOMENTUM_HPP
 
+#include <CubbyDNN/Core/BackwardPlan.hpp>
 #include <CubbyDNN/Core/Memory.hpp>
 #include <CubbyDNN/Node/Parameter.hpp>
 
+#include <memory>
+
 namespace CubbyDNN::Optimizer
 {
 class Momentum
@@ -19,6 +22,8 @@ class Momentum
     Momentum& operator=(const Momentum& rhs) = delete;
     Momentum& operator=(Momentum&& rhs) noexcept = delete;
 
+    //! Evaluates the gradient of every parameter with respect to target in
+    //! one backward pass, then updates them all.
     void Reduce(float learningRate, Node::Node* target);
 
     const float momentum = 0.0f;
@@ -26,6 +31,11 @@ class Momentum
  private:
     std::vector<Node::Parameter*> m_parameterList;
     std::vector<Core::Memory<float>> m_momentumGradientList;
+
+    // Compiled on the first Reduce, and again when the target or the edges
+    // of the graph change.
+    // Copies share it: running it leaves the plan as it is.
+    std::shared_ptr<Core::BackwardPlan> m_backwardPlan;
 };
 }  // namespace CubbyDNN::Optimizer
 
@@ -0,0 +1,275 @@
+#include <CubbyDNN/Compute/CPUInfo.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#if defined(CUBBYDNN_ARCH_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+#if defined(CUBBYDNN_ARCH_X86)
+void CPUID(std::uint32_t leaf, std::uint32_t subLeaf,
+           std::uint32_t (&registers)[4]) noexcept
+{
+#if defined(_MSC_VER)
+    int result[4];
+    __cpuidex(result, static_cast<int>(leaf), static_cast<int>(subLeaf));
+
+    for (int index = 0; index < 4; ++index)
+    {
+        registers[index] = static_cast<std::uint32_t>(result[index]);
+    }
+#else
+    __cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2],
+                  registers[3]);
+#endif
+}
+
+std::uint64_t XGETBV() noexcept
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    std::uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+    return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+ISA DetectISA() noexcept
+{
+    std::uint32_t registers[4];
+
+    CPUID(0, 0, registers);
+    const std::uint32_t maxLeaf = registers[0];
+
+    if (maxLeaf < 1)
+    {
+        return ISA::Scalar;
+    }
+
+    CPUID(1, 0, registers);
+    const std::uint32_t ecx1 = registers[2];
+
+    const bool hasSSE42 = ecx1 & (1u << 20);
+    const bool hasFMA = ecx1 & (1u << 12);
+    const bool hasOSXSAVE = ecx1 & (1u << 27);
+    const bool hasAVX = ecx1 & (1u << 28);
+
+    if (!hasSSE42)
+    {
+        return ISA::Scalar;
+    }
+
+    // The OS has to save the ymm (and zmm) state on context switches.
+    const std::uint64_t xcr0 = hasOSXSAVE ? XGETBV() : 0;
+    const bool hasYMMState = (xcr0 & 0x6) == 0x6;
+    const bool hasZMMState = (xcr0 & 0xE6) == 0xE6;
+
+    if (!hasAVX || !hasFMA || !hasYMMState || maxLeaf < 7)
+    {
+        return ISA::SSE42;
+    }
+
+    CPUID(7, 0, registers);
+    const std::uint32_t ebx7 = registers[1];
+
+    const bool hasAVX2 = ebx7 & (1u << 5);
+    const bool hasAVX512F = ebx7 & (1u << 16);
+    const bool hasAVX512DQ = ebx7 & (1u << 17);
+    const bool hasAVX512BW = ebx7 & (1u << 30);
+    const bool hasAVX512VL = ebx7 & (1u << 31);
+
+    if (!hasAVX2)
+    {
+        return ISA::SSE42;
+    }
+
+    if (hasAVX512F && hasAVX512DQ && hasAVX512BW && hasAVX512VL &&
+        hasZMMState)
+    {
+        return ISA::AVX512;
+    }
+
+    return ISA::AVX2;
+}
+
+bool DetectExtension(Extension extension) noexcept
+{
+    std::uint32_t registers[4];
+
+    switch (extension)
+    {
+        case Extension::AVX512VNNI:
+            if (!CPUInfo::IsSupported(ISA::AVX512))
+            {
+                return false;
+            }
+
+            CPUID(7, 0, registers);
+
+            return registers[2] & (1u << 11);
+
+        case Extension::AVX512BF16:
+            if (!CPUInfo::IsSupported(ISA::AVX512))
+            {
+                return false;
+            }
+
+            CPUID(7, 0, registers);
+
+            if (registers[0] < 1)
+            {
+                return false;
+            }
+
+            CPUID(7, 1, registers);
+
+            return registers[0] & (1u << 5);
+
+        case Extension::F16C:
+            if (!CPUInfo::IsSupported(ISA::AVX2))
+            {
+                return false;
+            }
+
+            CPUID(1, 0, registers);
+
+            return registers[2] & (1u << 29);
+    }
+
+    return false;
+}
+#else
+ISA DetectISA() noexcept
+{
+    return ISA::Scalar;
+}
+
+bool DetectExtension(Extension) noexcept
+{
+    return false;
+}
+#endif
+}  // namespace
+
+ISA CPUInfo::SupportedISA() noexcept
+{
+    static const ISA isa = DetectISA();
+
+    return isa;
+}
+
+ISA CPUInfo::PreferredISA() noexcept
+{
+    static const ISA isa = [] {
+        const char* value = std::getenv("CUBBYDNN_ISA");
+        ISA requested;
+
+        if (!value)
+        {
+            return SupportedISA();
+        }
+
+        // A silent fallback would mislabel A/B runs, so say what is used.
+        if (!Parse(value, requested))
+        {
+            std::cerr << "CubbyDNN: unknown CUBBYDNN_ISA '" << value
+                      << "', using " << Name(SupportedISA()) << '\n';
+
+            return SupportedISA();
+        }
+
+        if (!IsSupported(requested))
+        {
+            std::cerr << "CubbyDNN: CUBBYDNN_ISA '" << value
+                      << "' is not supported by this CPU, using "
+                      << Name(SupportedISA()) << '\n';
+
+            return SupportedISA();
+        }
+
+        return requested;
+    }();
+
+    return isa;
+}
+
+bool CPUInfo::IsSupported(ISA isa) noexcept
+{
+    return static_cast<int>(isa) <= static_cast<int>(SupportedISA());
+}
+
+bool CPUInfo::HasExtension(Extension extension) noexcept
+{
+    static const bool hasAVX512VNNI = DetectExtension(Extension::AVX512VNNI);
+    static const bool hasAVX512BF16 = DetectExtension(Extension::AVX512BF16);
+    static const bool hasF16C = DetectExtension(Extension::F16C);
+
+    switch (extension)
+    {
+        case Extension::AVX512VNNI:
+            return hasAVX512VNNI;
+        case Extension::AVX512BF16:
+            return hasAVX512BF16;
+        case Extension::F16C:
+            return hasF16C;
+    }
+
+    return false;
+}
+
+std::string_view CPUInfo::Name(ISA isa) noexcept
+{
+    switch (isa)
+    {
+        case ISA::Scalar:
+            return "scalar";
+        case ISA::SSE42:
+            return "sse4.2";
+        case ISA::AVX2:
+            return "avx2";
+        case ISA::AVX512:
+            return "avx512";
+    }
+
+    return "unknown";
+}
+
+bool CPUInfo::Parse(std::string_view name, ISA& isa) noexcept
+{
+    // Case-insensitive, and the dot in "sse4.2" may be left out.
+    const auto isEqual = [](std::string_view lhs, std::string_view rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                          [](char left, char right) {
+                              return std::tolower(static_cast<unsigned char>(
+                                         left)) == right;
+                          });
+    };
+
+    for (const auto candidate :
+         { ISA::Scalar, ISA::SSE42, ISA::AVX2, ISA::AVX512 })
+    {
+        if (isEqual(name, Name(candidate)) ||
+            (candidate == ISA::SSE42 && isEqual(name, "sse42")))
+        {
+            isa = candidate;
+            return true;
+        }
+    }
+
+    return false;
+}
+}  // namespace CubbyDNN::Compute
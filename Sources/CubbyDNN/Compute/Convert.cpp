@@ -0,0 +1,33 @@
+#include <CubbyDNN/Compute/Convert.hpp>
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+namespace CubbyDNN::Compute
+{
+void Convert::ToFloat(const Core::Span<Core::BFloat16> source,
+                      Core::Span<float> destination) noexcept
+{
+    KernelRegistry::Active().bf16.toFloat(source.Length(), source.begin(),
+                                          destination.begin());
+}
+
+void Convert::ToFloat(const Core::Span<Core::Float16> source,
+                      Core::Span<float> destination) noexcept
+{
+    KernelRegistry::Active().fp16.toFloat(source.Length(), source.begin(),
+                                          destination.begin());
+}
+
+void Convert::FromFloat(const Core::Span<float> source,
+                        Core::Span<Core::BFloat16> destination) noexcept
+{
+    KernelRegistry::Active().bf16.fromFloat(source.Length(), source.begin(),
+                                            destination.begin());
+}
+
+void Convert::FromFloat(const Core::Span<float> source,
+                        Core::Span<Core::Float16> destination) noexcept
+{
+    KernelRegistry::Active().fp16.fromFloat(source.Length(), source.begin(),
+                                            destination.begin());
+}
+}  // namespace CubbyDNN::Compute
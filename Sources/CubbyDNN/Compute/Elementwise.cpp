@@ -0,0 +1,147 @@
+#include <CubbyDNN/Compute/Elementwise.hpp>
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+#include <CubbyDNN/Core/Memory.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <functional>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+// Calls body(begin, end) over [0, size) cut into chunks. A template rather
+// than a std::function, so that a tensor run on this thread costs no more
+// than a call.
+template <typename Body>
+void ForEachChunk(std::size_t size, const Body& body)
+{
+    const std::size_t numChunk =
+        (size + Elementwise::ChunkSize - 1) / Elementwise::ChunkSize;
+    const std::size_t numThread = Elementwise::ThreadCount(size);
+
+    const auto runChunk = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t numK = begin; numK < end; ++numK)
+        {
+            const std::size_t offset = numK * Elementwise::ChunkSize;
+
+            body(offset, std::min(offset + Elementwise::ChunkSize, size));
+        }
+    };
+
+    if (numThread == 1)
+    {
+        runChunk(0, numChunk);
+        return;
+    }
+
+    Core::DefaultThreadPool().ParallelFor(
+        numChunk, (numChunk + numThread - 1) / numThread, numThread,
+        runChunk);
+}
+
+// The kernels of the active instruction set for op.
+const ActivationKernel& Kernel(const ElementwiseOp& op) noexcept
+{
+    switch (op.type)
+    {
+        case ElementwiseType::ReLU:
+        default:
+            return KernelRegistry::Active().leakyReLU;
+    }
+}
+}  // namespace
+
+std::size_t Elementwise::ThreadCount(std::size_t size) noexcept
+{
+    // One thread per 64K values; fewer are not worth waking a thread for.
+    return std::max<std::size_t>(
+        1u, std::min<std::size_t>(size / 65536u,
+                                  Core::DefaultThreadPool().ThreadCount()));
+}
+
+void Elementwise::Forward(const std::vector<ElementwiseOp>& opList,
+                          const Core::Span<float> input,
+                          Core::Span<float> output)
+{
+    const float* source = input.begin();
+    float* destination = output.begin();
+
+    ForEachChunk(output.Length(), [&](std::size_t begin, std::size_t end) {
+        const float* chunk = source + begin;
+
+        for (const auto& op : opList)
+        {
+            Kernel(op).forward(end - begin, op.alpha, chunk,
+                               destination + begin);
+            chunk = destination + begin;
+        }
+
+        if (opList.empty() && chunk != destination + begin)
+        {
+            std::copy(chunk, chunk + (end - begin), destination + begin);
+        }
+    });
+}
+
+void Elementwise::BackwardAdd(const std::vector<ElementwiseOp>& opList,
+                              const Core::Span<float> input,
+                              const Core::Span<float> gradient,
+                              Core::Span<float> inputGradient)
+{
+    const float* source = input.begin();
+    const float* sourceGradient = gradient.begin();
+    float* destination = inputGradient.begin();
+
+    ForEachChunk(input.Length(), [&](std::size_t begin, std::size_t end) {
+        const std::size_t numStep = opList.size();
+        const std::size_t size = end - begin;
+
+        if (!numStep)
+        {
+            for (std::size_t index = begin; index < end; ++index)
+            {
+                destination[index] += sourceGradient[index];
+            }
+
+            return;
+        }
+
+        // The inputs of the steps after the first, then the gradient between
+        // two steps.
+        static thread_local Core::Memory<float> scratchMemory;
+        scratchMemory.Resize(numStep * ChunkSize);
+
+        float* scratch = scratchMemory.GetSpan().begin();
+        float* chunkGradient = scratch + (numStep - 1) * ChunkSize;
+
+        const auto stepInput = [&](std::size_t numS) -> const float* {
+            return numS ? scratch + (numS - 1) * ChunkSize : source + begin;
+        };
+
+        for (std::size_t numS = 1; numS < numStep; ++numS)
+        {
+            const auto& op = opList[numS - 1];
+
+            Kernel(op).forward(size, op.alpha, stepInput(numS - 1),
+                               scratch + (numS - 1) * ChunkSize);
+        }
+
+        // The last step reads the gradient and the first adds to the input's,
+        // so that a single step makes no copy.
+        const float* stepGradient = sourceGradient + begin;
+
+        for (std::size_t numS = numStep; numS > 0; --numS)
+        {
+            const auto& op = opList[numS - 1];
+            const bool isFirst = numS == 1;
+
+            Kernel(op).backward(size, op.alpha, stepInput(numS - 1),
+                                stepGradient,
+                                isFirst ? destination + begin : chunkGradient,
+                                isFirst);
+            stepGradient = chunkGradient;
+        }
+    });
+}
+}  // namespace CubbyDNN::Compute
\ No newline at end of file
@@ -1,234 +1,1191 @@
 #include <CubbyDNN/Compute/GEMM.hpp>
+#include <CubbyDNN/Compute/GEMMTuner.hpp>
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+#include <CubbyDNN/Core/Memory.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
 
-#include <vector>
-
-#include <immintrin.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 namespace CubbyDNN::Compute
 {
-void __vectorcall GEMM::Multiply(std::size_t maxIndex, std::size_t numRow,
-                                 std::size_t numColumn,
-                                 const Core::Span<float> left,
-                                 const Core::Span<float> right,
-                                 Core::Span<float> destination) noexcept
+namespace
 {
-    destination.FillZero();
+// Default cache blocking: a packed KC x nr sliver of B stays in L1, a packed
+// MC x KC block of A stays in L2 and a packed KC x NC panel of B stays in L3.
+// The register tile (mr x nr) comes from the kernel set of the configuration.
+// GEMMTuner may replace all of these per signature.
+constexpr std::size_t MC = 144;
+constexpr std::size_t KC = 256;
+constexpr std::size_t NC = 3072;
 
-    MultiplyAdd(maxIndex, numRow, numColumn, left, right, destination);
-}
+// Int8 blocking. Packed 8-bit panels are a quarter of their float size, so
+// the K block covers four times as many values for the same cache footprint.
+constexpr std::size_t Int8MC = 144;
+constexpr std::size_t Int8KC = 1024;
+constexpr std::size_t Int8NC = 256;
 
-void __vectorcall GEMM::MultiplyAdd(std::size_t maxIndex, std::size_t numRow,
-                                    std::size_t numColumn,
-                                    const Core::Span<float> left,
-                                    const Core::Span<float> right,
-                                    Core::Span<float> destination) noexcept
+template <typename T>
+T* AcquireBuffer(Core::Memory<T>& buffer, std::size_t size)
 {
-    const auto* l = left.begin();
-    const auto* r = right.begin();
-    auto* __restrict d = destination.begin();
+    buffer.Resize(size);
+
+    return buffer.GetSpan().begin();
+}
 
-#pragma omp parallel for schedule(guided) default(shared)                    \
-    num_threads(static_cast <int>(std::max <std::size_t>(                    \
-        1u, std::min <std::size_t>(maxIndex * numRow * numColumn / 1600000u, \
-                                   std::thread::hardware_concurrency()))))
+// Packs alpha * an mc x kc block of A into row panels of mr, k-major inside a
+// panel. Rows beyond mc are zero padded so the micro-kernel never needs a
+// fringe case. Folding alpha in here keeps the micro-kernel a pure update.
+void PackA(const GEMMKernel& kernel, std::size_t mc, std::size_t kc,
+           float alpha, const float* a, std::size_t rowStride,
+           std::size_t colStride, float* __restrict packed) noexcept
+{
+    const std::size_t mr = kernel.mr;
 
-    for (std::int64_t numR = 0; numR < static_cast<std::int64_t>(numRow);
-         ++numR)
+    for (std::size_t numR = 0; numR < mc; numR += mr)
     {
-        for (std::size_t numC = 0; numC < numColumn; ++numC)
+        const std::size_t numValid = std::min(mr, mc - numR);
+        const float* panel = a + numR * rowStride;
+
+        if (numValid < mr)
         {
-            std::size_t numIndex = 0;
-            auto sum = _mm256_setzero_ps();
+            std::fill(packed, packed + kc * mr, 0.0f);
+        }
 
-            for (; numIndex + 8 <= maxIndex; numIndex += 8)
+        // Read along the contiguous direction of a; the scattered side is
+        // the small packed panel.
+        if (colStride == 1)
+        {
+            for (std::size_t numI = 0; numI < numValid; ++numI)
             {
-                sum = _mm256_fmadd_ps(
-                    _mm256_loadu_ps(l + numR * maxIndex + numIndex),
-                    _mm256_loadu_ps(r + numC * maxIndex + numIndex), sum);
+                const float* row = panel + numI * rowStride;
+
+                for (std::size_t numK = 0; numK < kc; ++numK)
+                {
+                    packed[numK * mr + numI] = alpha * row[numK];
+                }
             }
+        }
+        else
+        {
+            for (std::size_t numK = 0; numK < kc; ++numK)
+            {
+                const float* column = panel + numK * colStride;
+
+                for (std::size_t numI = 0; numI < numValid; ++numI)
+                {
+                    packed[numK * mr + numI] = alpha * column[numI * rowStride];
+                }
+            }
+        }
+
+        packed += kc * mr;
+    }
+}
 
-            const auto sum128 = _mm_add_ps(_mm256_extractf128_ps(sum, 1),
-                                           _mm256_castps256_ps128(sum));
-            const auto sum64 =
-                _mm_add_ps(sum128, _mm_movehl_ps(sum128, sum128));
-            const auto sum32 =
-                _mm_add_ss(sum64, _mm_shuffle_ps(sum64, sum64, 0x55));
-            auto numSum = _mm_cvtss_f32(sum32);
+template <typename T>
+const HalfKernel<T>& GetHalfKernel(const KernelTable& kernels) noexcept
+{
+    if constexpr (std::is_same_v<T, Core::BFloat16>)
+    {
+        return kernels.bf16;
+    }
+    else
+    {
+        return kernels.fp16;
+    }
+}
+
+// Packs a kc x numValid sliver of B into nr columns, k-major, zero padding
+// the columns beyond numValid. A half-precision B is first widened into fp32
+// scratch one contiguous run at a time (rows when colStride is 1, columns
+// when rowStride is 1), and then packed from there.
+template <typename T>
+void PackBSliver(const KernelTable& kernels, std::size_t nr, std::size_t kc,
+                 std::size_t numValid, const T* b, std::size_t rowStride,
+                 std::size_t colStride, float* __restrict packed) noexcept
+{
+    const float* sliver;
 
-            for (; numIndex < maxIndex; ++numIndex)
+    if constexpr (std::is_same_v<T, float>)
+    {
+        sliver = b;
+    }
+    else
+    {
+        static thread_local Core::Memory<float> scratchMemory;
+        float* scratch = AcquireBuffer(scratchMemory, kc * nr);
+        const auto toFloat = GetHalfKernel<T>(kernels).toFloat;
+
+        if (colStride == 1)
+        {
+            for (std::size_t numK = 0; numK < kc; ++numK)
+            {
+                toFloat(numValid, b + numK * rowStride, scratch + numK * nr);
+            }
+
+            rowStride = nr;
+        }
+        else
+        {
+            for (std::size_t numJ = 0; numJ < numValid; ++numJ)
             {
-                numSum += l[numR * maxIndex + numIndex] *
-                          r[numC * maxIndex + numIndex];
+                toFloat(kc, b + numJ * colStride, scratch + numJ * kc);
             }
 
-            d[numR * numColumn + numC] += numSum;
+            rowStride = 1;
+            colStride = kc;
+        }
+
+        sliver = scratch;
+    }
+
+    if (numValid < nr)
+    {
+        std::fill(packed, packed + kc * nr, 0.0f);
+    }
+
+    // A transposed B is read column by column, an untransposed one row by
+    // row.
+    if (rowStride == 1)
+    {
+        for (std::size_t numJ = 0; numJ < numValid; ++numJ)
+        {
+            const float* column = sliver + numJ * colStride;
+
+            for (std::size_t numK = 0; numK < kc; ++numK)
+            {
+                packed[numK * nr + numJ] = column[numK];
+            }
+        }
+    }
+    else
+    {
+        // colStride is 1 here: one of the two strides always is.
+        for (std::size_t numK = 0; numK < kc; ++numK)
+        {
+            std::copy(sliver + numK * rowStride,
+                      sliver + numK * rowStride + numValid,
+                      packed + numK * nr);
         }
     }
 }
 
-void __vectorcall GEMM::dMultiplyLeft(std::size_t maxIndex, std::size_t numRow,
-                                      std::size_t numColumn,
-                                      const Core::Span<float> gradient,
-                                      const Core::Span<float> right,
-                                      Core::Span<float> destination) noexcept
+// Packs a kc x nc panel of B into column slivers of nr, shared out over
+// numThread threads.
+template <typename T>
+void PackB(const KernelTable& kernels, std::size_t numThread, std::size_t kc,
+           std::size_t nc, const T* b, std::size_t rowStride,
+           std::size_t colStride, float* __restrict packed)
 {
-    destination.FillZero();
+    const std::size_t nr = kernels.gemm.nr;
+    const std::size_t numSliver = (nc + nr - 1) / nr;
+
+    Core::DefaultThreadPool().ParallelFor(
+        numSliver, (numSliver + numThread - 1) / numThread, numThread,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t numS = begin; numS < end; ++numS)
+            {
+                const std::size_t numC = numS * nr;
 
-    dMultiplyAddLeft(maxIndex, numRow, numColumn, gradient, right, destination);
+                PackBSliver(kernels, nr, kc, std::min(nr, nc - numC),
+                            b + numC * colStride, rowStride, colStride,
+                            packed + numC * kc);
+            }
+        });
+}
+
+// c = beta * c on one row of n values. beta == 0 must not propagate NaN or
+// Inf from c.
+void ScaleRow(float beta, float* row, std::size_t n) noexcept
+{
+    if (beta == 0.0f)
+    {
+        std::fill(row, row + n, 0.0f);
+    }
+    else if (beta != 1.0f)
+    {
+        std::transform(row, row + n, row,
+                       [beta](float value) { return beta * value; });
+    }
 }
 
-void __vectorcall GEMM::dMultiplyAddLeft(std::size_t maxIndex,
-                                         std::size_t numRow,
-                                         std::size_t numColumn,
-                                         const Core::Span<float> gradient,
-                                         const Core::Span<float> right,
-                                         Core::Span<float> destination) noexcept
+bool IsEmpty(const GEMM::Epilogue& epilogue) noexcept
 {
-    const auto* g = gradient.begin();
-    const auto* r = right.begin();
-    auto* __restrict d = destination.begin();
+    return !epilogue.bias && !epilogue.isReLU;
+}
 
-    std::vector<float> rightTransposed(maxIndex * numColumn);
-    auto* __restrict rTransposed = rightTransposed.data();
+// Applies epilogue to a numRow x numColumn block of c whose first column is
+// column numC of the product.
+void ApplyEpilogue(const GEMM::Epilogue& epilogue, std::size_t numC,
+                   std::size_t numRow, std::size_t numColumn, float* c,
+                   std::size_t ldc) noexcept
+{
+    const float* bias = epilogue.bias ? epilogue.bias + numC : nullptr;
+    const float alpha = epilogue.isReLU ? epilogue.alpha : 1.0f;
 
-#pragma omp parallel default(shared)                                \
-    num_threads(static_cast <int>(std::max <std::size_t>(           \
-        1u, std::min <std::size_t>(maxIndex * numColumn / 1600000u, \
-                                   std::thread::hardware_concurrency()))))
+    for (std::size_t numI = 0; numI < numRow; ++numI)
     {
-#pragma omp for schedule(guided)
-        for (std::int64_t numR = 0; numR < static_cast<std::int64_t>(numColumn);
-             ++numR)
+        float* __restrict row = c + numI * ldc;
+
+        if (bias)
         {
-            for (std::size_t numC = 0; numC < maxIndex; ++numC)
+            for (std::size_t numJ = 0; numJ < numColumn; ++numJ)
             {
-                rTransposed[numC * numColumn + numR] =
-                    r[numR * maxIndex + numC];
+                row[numJ] += bias[numJ];
             }
         }
 
-#pragma omp for schedule(guided)
-        for (std::int64_t numR = 0; numR < static_cast<std::int64_t>(numRow);
-             ++numR)
+        if (epilogue.isReLU)
         {
-            for (std::size_t numC = 0; numC < maxIndex; ++numC)
+            for (std::size_t numJ = 0; numJ < numColumn; ++numJ)
             {
-                std::size_t numIndex = 0;
-                auto sum = _mm256_setzero_ps();
+                row[numJ] = row[numJ] < 0.0f ? alpha * row[numJ] : row[numJ];
+            }
+        }
+    }
+}
 
-                for (; numIndex + 8 <= numColumn; numIndex += 8)
+// Runs the micro-kernel over an mc x nc block of c from packed A and B. Fringe
+// tiles are computed into a scratch tile and only the valid part is added.
+// With isOverwrite, the block is overwritten instead of added to: each tile
+// is zeroed right before its micro-kernel, so c is not swept beforehand.
+// epilogue, when given, is applied to each tile right after it; its bias
+// starts at column numJC of c.
+void MacroKernel(const GEMMKernel& kernel, std::size_t mc, std::size_t nc,
+                 std::size_t kc, const float* packedA, const float* packedB,
+                 float* c, std::size_t ldc, bool isOverwrite,
+                 const GEMM::Epilogue* epilogue, std::size_t numJC) noexcept
+{
+    const std::size_t mr = kernel.mr;
+    const std::size_t nr = kernel.nr;
+    alignas(Core::CacheLineSize) float tile[GEMMKernel::MaxTileSize];
+
+    for (std::size_t numC = 0; numC < nc; numC += nr)
+    {
+        const std::size_t numValidC = std::min(nr, nc - numC);
+
+        for (std::size_t numR = 0; numR < mc; numR += mr)
+        {
+            const std::size_t numValidR = std::min(mr, mc - numR);
+            const float* a = packedA + numR * kc;
+            const float* b = packedB + numC * kc;
+            float* cTile = c + numR * ldc + numC;
+
+            if (numValidR == mr && numValidC == nr)
+            {
+                if (isOverwrite)
                 {
-                    sum = _mm256_fmadd_ps(
-                        _mm256_loadu_ps(g + numR * numColumn + numIndex),
-                        _mm256_loadu_ps(rTransposed + numC * numColumn +
-                                        numIndex),
-                        sum);
+                    for (std::size_t numI = 0; numI < mr; ++numI)
+                    {
+                        std::fill(cTile + numI * ldc, cTile + numI * ldc + nr,
+                                  0.0f);
+                    }
                 }
 
-                const auto sum128 = _mm_add_ps(_mm256_extractf128_ps(sum, 1),
-                                               _mm256_castps256_ps128(sum));
-                const auto sum64 =
-                    _mm_add_ps(sum128, _mm_movehl_ps(sum128, sum128));
-                const auto sum32 =
-                    _mm_add_ss(sum64, _mm_shuffle_ps(sum64, sum64, 0x55));
-                auto numSum = _mm_cvtss_f32(sum32);
+                kernel.microKernel(kc, a, b, cTile, ldc);
+            }
+            else
+            {
+                std::fill(tile, tile + mr * nr, 0.0f);
+                kernel.microKernel(kc, a, b, tile, nr);
 
-                for (; numIndex < numColumn; ++numIndex)
+                for (std::size_t numI = 0; numI < numValidR; ++numI)
                 {
-                    numSum += g[numR * numColumn + numIndex] *
-                              rTransposed[numC * numColumn + numIndex];
+                    for (std::size_t numJ = 0; numJ < numValidC; ++numJ)
+                    {
+                        cTile[numI * ldc + numJ] =
+                            (isOverwrite ? 0.0f : cTile[numI * ldc + numJ]) +
+                            tile[numI * nr + numJ];
+                    }
                 }
+            }
 
-                d[numR * maxIndex + numC] += numSum;
+            if (epilogue)
+            {
+                ApplyEpilogue(*epilogue, numJC + numC, numValidR, numValidC,
+                              cTile, ldc);
             }
         }
     }
 }
 
-void __vectorcall GEMM::dMultiplyRight(std::size_t maxIndex, std::size_t numRow,
-                                       std::size_t numColumn,
-                                       const Core::Span<float> gradient,
-                                       const Core::Span<float> left,
-                                       Core::Span<float> destination) noexcept
+// c(m x n) = alpha * A(m x k) * B(k x n) + beta * c where A(i, p) =
+// a[i * aRowStride + p * aColStride] and B(p, j) = b[p * bRowStride + j *
+// bColStride]. Either operand layout is read directly by the packing
+// routines, so transposed operands never need a temporary copy. b is fp32,
+// Core::BFloat16 or Core::Float16; see PackB.
+//
+// The N dimension is blocked by config.nc and K by config.kc; each panel of B
+// is packed once, cooperatively, into Core::ScratchMemory of the calling
+// thread. The M x nc block is then split into (mc rows) x (column chunk)
+// work items so that even small batches keep every thread busy; each work
+// item packs its own A block into a thread-local buffer. Every parallel loop
+// runs on Core::DefaultThreadPool(), so a product inside a node that is
+// evaluated in parallel with others shares their threads.
+//
+// With beta == 0 the first K block overwrites c instead of c being zeroed in
+// a pass of its own, and the epilogue is applied along with the last one, so
+// c is only ever touched a tile at a time while the tile is in cache.
+template <typename T>
+void BlockedGemm(const GEMMConfig& config, std::size_t m, std::size_t n,
+                 std::size_t k, float alpha, const float* a,
+                 std::size_t aRowStride, std::size_t aColStride, const T* b,
+                 std::size_t bRowStride, std::size_t bColStride, float beta,
+                 float* c, std::size_t ldc, const GEMM::Epilogue& epilogue)
 {
-    destination.FillZero();
+    const auto& kernels = KernelRegistry::Get(config.isa);
+    const auto& kernel = kernels.gemm;
+    const std::size_t mr = kernel.mr;
+    const std::size_t nr = kernel.nr;
+    const std::size_t numThread = config.numThread;
+    auto& pool = Core::DefaultThreadPool();
 
-    dMultiplyAddRight(maxIndex, numRow, numColumn, gradient, left, destination);
+    // Scratch rather than thread-local: a thread waiting for the work items
+    // below may run another product in the meantime.
+    const std::size_t panelWidth = (std::min(n, config.nc) + nr - 1) / nr * nr;
+    const Core::ScratchMemory<float> packedBMemory(config.kc * panelWidth);
+    float* packedB = packedBMemory.Data();
+
+    // Shrink the row block when there are too few rows to go around.
+    const std::size_t mc = std::min(
+        std::max(mr, config.mc / mr * mr),
+        std::max(mr, (m + mr * numThread - 1) / (mr * numThread) * mr));
+    const std::size_t numRowBlock = (m + mc - 1) / mc;
+
+    const bool isOverwrite = beta == 0.0f && k;
+
+    if (beta != 1.0f && !isOverwrite)
+    {
+        pool.ParallelFor(m, (m + numThread - 1) / numThread, numThread,
+                         [&](std::size_t begin, std::size_t end) {
+                             for (std::size_t numR = begin; numR < end; ++numR)
+                             {
+                                 ScaleRow(beta, c + numR * ldc, n);
+
+                                 // Nothing is accumulated after this.
+                                 if (!k && !IsEmpty(epilogue))
+                                 {
+                                     ApplyEpilogue(epilogue, 0, 1, n,
+                                                   c + numR * ldc, ldc);
+                                 }
+                             }
+                         });
+    }
+    else if (!k && !IsEmpty(epilogue))
+    {
+        ApplyEpilogue(epilogue, 0, m, n, c, ldc);
+    }
+
+    for (std::size_t numJC = 0; numJC < n; numJC += config.nc)
+    {
+        const std::size_t nc = std::min(config.nc, n - numJC);
+
+        // Split the columns only as much as needed to feed all threads.
+        const std::size_t numSliver = (nc + nr - 1) / nr;
+        const std::size_t numColumnBlock = std::min(
+            numSliver, std::max<std::size_t>(
+                           1u, (numThread + numRowBlock - 1) / numRowBlock));
+        const std::size_t columnBlock =
+            (numSliver + numColumnBlock - 1) / numColumnBlock * nr;
+        const std::size_t numWork = numRowBlock * numColumnBlock;
+
+        for (std::size_t numPC = 0; numPC < k; numPC += config.kc)
+        {
+            const std::size_t kc = std::min(config.kc, k - numPC);
+
+            // Returns once packedB is complete.
+            PackB(kernels, numThread, kc, nc,
+                  b + numPC * bRowStride + numJC * bColStride, bRowStride,
+                  bColStride, packedB);
+
+            const auto runWork = [&](std::size_t numW, std::size_t) {
+                static thread_local Core::Memory<float> packedAMemory;
+
+                const std::size_t numIC = numW / numColumnBlock * mc;
+                const std::size_t numJR = numW % numColumnBlock * columnBlock;
+
+                if (numJR >= nc)
+                {
+                    return;
+                }
+
+                const std::size_t mcBlock = std::min(mc, m - numIC);
+                float* packedA = AcquireBuffer(
+                    packedAMemory, (mcBlock + mr - 1) / mr * mr * kc);
+
+                PackA(kernel, mcBlock, kc, alpha,
+                      a + numIC * aRowStride + numPC * aColStride, aRowStride,
+                      aColStride, packedA);
+
+                MacroKernel(kernel, mcBlock, std::min(columnBlock, nc - numJR),
+                            kc, packedA, packedB + numJR * kc,
+                            c + numIC * ldc + numJC + numJR, ldc,
+                            isOverwrite && numPC == 0,
+                            numPC + kc == k && !IsEmpty(epilogue) ? &epilogue
+                                                                 : nullptr,
+                            numJC + numJR);
+            };
+
+            // One work item at a time, as schedule(dynamic) would.
+            pool.ParallelFor(numWork, 1, numThread, runWork);
+        }
+    }
 }
 
-void __vectorcall GEMM::dMultiplyAddRight(
-    std::size_t maxIndex, std::size_t numRow, std::size_t numColumn,
-    const Core::Span<float> gradient, const Core::Span<float> left,
-    Core::Span<float> destination) noexcept
+// Split-K variant of BlockedGemm for outputs with fewer register tiles than
+// threads, e.g. weight gradients that reduce over a large batch into a
+// handful of output rows. The K range is cut into numSplit contiguous chunks,
+// each computed single-threaded into its own m x n partial buffer, and the
+// partials are then summed into c in ascending chunk order. The order of the
+// additions only depends on numSplit, so the result is reproducible run to
+// run regardless of how the threads were scheduled.
+template <typename T>
+void SplitKGemm(const GEMMConfig& config, std::size_t m, std::size_t n,
+                std::size_t k, float alpha, const float* a,
+                std::size_t aRowStride, std::size_t aColStride, const T* b,
+                std::size_t bRowStride, std::size_t bColStride, float beta,
+                float* c, std::size_t ldc, const GEMM::Epilogue& epilogue)
 {
-    const auto* g = gradient.begin();
-    const auto* l = left.begin();
-    auto* __restrict d = destination.begin();
+    const std::size_t numSplit = config.numSplit;
+    GEMMConfig chunkConfig = config;
+    chunkConfig.numThread = 1;
+    chunkConfig.numSplit = 1;
+
+    const Core::ScratchMemory<float> partialMemory(numSplit * m * n);
+    float* partial = partialMemory.Data();
+
+    const std::size_t chunk = (k + numSplit - 1) / numSplit;
+    auto& pool = Core::DefaultThreadPool();
 
-    std::vector<float> gradientTransposed(numRow * numColumn);
-    std::vector<float> leftTransposed(numRow * maxIndex);
-    auto* __restrict gTransposed = gradientTransposed.data();
-    auto* __restrict lTransposed = leftTransposed.data();
+    pool.ParallelFor(numSplit, 1, numSplit,
+                     [&](std::size_t numS, std::size_t) {
+                         const std::size_t begin = numS * chunk;
+                         const std::size_t end = std::min(k, begin + chunk);
+
+                         BlockedGemm(chunkConfig, m, n,
+                                     end > begin ? end - begin : 0, alpha,
+                                     a + begin * aColStride, aRowStride,
+                                     aColStride, b + begin * bRowStride,
+                                     bRowStride, bColStride, 0.0f,
+                                     partial + numS * m * n, n,
+                                     GEMM::Epilogue{});
+                     });
+
+    pool.ParallelFor(
+        m, (m + numSplit - 1) / numSplit, numSplit,
+        [&](std::size_t first, std::size_t last) {
+            for (std::size_t numR = first; numR < last; ++numR)
+            {
+                float* row = c + numR * ldc;
+
+                for (std::size_t numC = 0; numC < n; ++numC)
+                {
+                    float sum = 0.0f;
+
+                    for (std::size_t numS = 0; numS < numSplit; ++numS)
+                    {
+                        sum += partial[(numS * m + numR) * n + numC];
+                    }
+
+                    row[numC] = beta == 0.0f ? sum : beta * row[numC] + sum;
+                }
+
+                if (!IsEmpty(epilogue))
+                {
+                    ApplyEpilogue(epilogue, 0, 1, n, row, ldc);
+                }
+            }
+        });
+}
+
+// A product that fits one cache block (m, n <= MC and k <= KC), computed on
+// the calling thread: A and B are packed whole and handed straight to the
+// register kernel. Nothing on this path waits for other threads, so its
+// thread-local buffers are safe inside a parallel loop over a batch. The
+// tile is whichever of gemm and narrowGemm pads c the least.
+void SmallGemm(const GEMMConfig& config, std::size_t m, std::size_t n,
+               std::size_t k, float alpha, const float* a,
+               std::size_t aRowStride, std::size_t aColStride, const float* b,
+               std::size_t bRowStride, std::size_t bColStride, float beta,
+               float* c, std::size_t ldc, const GEMM::Epilogue& epilogue)
+{
+    const auto& kernels = KernelRegistry::Get(config.isa);
+    const auto paddedSize = [m, n](const GEMMKernel& kernel) {
+        return (m + kernel.mr - 1) / kernel.mr * kernel.mr *
+               ((n + kernel.nr - 1) / kernel.nr * kernel.nr);
+    };
+    const auto& kernel =
+        paddedSize(kernels.narrowGemm) < paddedSize(kernels.gemm)
+            ? kernels.narrowGemm
+            : kernels.gemm;
+    const std::size_t mr = kernel.mr;
+    const std::size_t nr = kernel.nr;
 
-#pragma omp parallel default(shared)                                         \
-    num_threads(static_cast <int>(std::max <std::size_t>(                    \
-        1u, std::min <std::size_t>(maxIndex * numRow * numColumn / 1600000u, \
-                                   std::thread::hardware_concurrency()))))
+    if (beta != 0.0f || !k)
     {
-#pragma omp for schedule(guided) nowait
-        for (std::int64_t numR = 0; numR < static_cast<std::int64_t>(numRow);
-             ++numR)
+        for (std::size_t numR = 0; numR < m; ++numR)
         {
-            for (std::size_t numC = 0; numC < numColumn; ++numC)
+            ScaleRow(beta, c + numR * ldc, n);
+        }
+    }
+
+    if (!k)
+    {
+        if (!IsEmpty(epilogue))
+        {
+            ApplyEpilogue(epilogue, 0, m, n, c, ldc);
+        }
+
+        return;
+    }
+
+    static thread_local Core::Memory<float> packedAMemory;
+    static thread_local Core::Memory<float> packedBMemory;
+    float* packedA = AcquireBuffer(packedAMemory, (m + mr - 1) / mr * mr * k);
+    float* packedB = AcquireBuffer(packedBMemory, (n + nr - 1) / nr * nr * k);
+
+    PackA(kernel, m, k, alpha, a, aRowStride, aColStride, packedA);
+
+    for (std::size_t numC = 0; numC < n; numC += nr)
+    {
+        PackBSliver(kernels, nr, k, std::min(nr, n - numC),
+                    b + numC * bColStride, bRowStride, bColStride,
+                    packedB + numC * k);
+    }
+
+    MacroKernel(kernel, m, n, k, packedA, packedB, c, ldc, beta == 0.0f,
+                IsEmpty(epilogue) ? nullptr : &epilogue, 0);
+}
+
+// Copies kc values of one row into groups of four, zero padding the last
+// group. Signed values are shifted into unsigned ones; flipping the sign bit
+// is the same as adding 128.
+template <typename T, typename U>
+void PackInt8Row(std::size_t kc, const T* row, std::size_t groupStride,
+                 U* __restrict packed) noexcept
+{
+    const std::size_t numFullK = kc / 4 * 4;
+    const std::uint32_t flip = std::is_signed_v<T> != std::is_signed_v<U>
+                                   ? 0x80808080u
+                                   : 0u;
+
+    for (std::size_t numK = 0; numK < numFullK; numK += 4)
+    {
+        std::uint32_t group;
+        std::memcpy(&group, row + numK, 4);
+        group ^= flip;
+        std::memcpy(packed, &group, 4);
+        packed += groupStride;
+    }
+
+    if (numFullK < kc)
+    {
+        std::uint32_t group = 0;
+        std::memcpy(&group, row + numFullK, kc - numFullK);
+        group ^= flip >> (8 * (4 - (kc - numFullK)));
+        std::memcpy(packed, &group, 4);
+    }
+}
+
+// Packs count rows of source (k contiguous each) into panels of width rows
+// in groups of four k, as the int8 micro-kernels expect: row numI of a panel
+// owns bytes [4 * numI, 4 * numI + 4) of every 4 * width byte group. Rows
+// beyond count and k beyond kc are zero padded, so the padding contributes
+// nothing whatever the other operand holds there.
+template <typename T, typename U>
+void PackInt8Panels(std::size_t width, std::size_t count, std::size_t kc,
+                    const T* source, std::size_t ld,
+                    U* __restrict packed) noexcept
+{
+    const std::size_t kcPadded = (kc + 3) / 4 * 4;
+
+    for (std::size_t numR = 0; numR < count; numR += width)
+    {
+        const std::size_t numValid = std::min(width, count - numR);
+
+        for (std::size_t numI = 0; numI < width; ++numI)
+        {
+            U* column = packed + numI * 4;
+
+            if (numI < numValid)
             {
-                gTransposed[numC * numRow + numR] = g[numR * numColumn + numC];
+                PackInt8Row(kc, source + (numR + numI) * ld, width * 4,
+                            column);
+            }
+            else
+            {
+                for (std::size_t numK = 0; numK < kcPadded; numK += 4)
+                {
+                    std::memset(column + numK * width, 0, 4);
+                }
             }
         }
 
-#pragma omp for schedule(guided)
-        for (std::int64_t numR = 0; numR < static_cast<std::int64_t>(numRow);
-             ++numR)
+        packed += width * kcPadded;
+    }
+}
+
+void Int8MacroKernel(const Int8GEMMKernel& kernel, std::size_t mc,
+                     std::size_t nc, std::size_t kc,
+                     const std::uint8_t* packedA, const std::int8_t* packedB,
+                     std::int32_t* c, std::size_t ldc) noexcept
+{
+    const std::size_t mr = kernel.mr;
+    const std::size_t nr = kernel.nr;
+    alignas(Core::CacheLineSize) std::int32_t tile[GEMMKernel::MaxTileSize];
+
+    for (std::size_t numC = 0; numC < nc; numC += nr)
+    {
+        const std::size_t numValidC = std::min(nr, nc - numC);
+
+        for (std::size_t numR = 0; numR < mc; numR += mr)
+        {
+            const std::size_t numValidR = std::min(mr, mc - numR);
+            const std::uint8_t* a = packedA + numR * kc;
+            const std::int8_t* b = packedB + numC * kc;
+            std::int32_t* cTile = c + numR * ldc + numC;
+
+            if (numValidR == mr && numValidC == nr)
+            {
+                kernel.microKernel(kc, a, b, cTile, ldc);
+                continue;
+            }
+
+            std::fill(tile, tile + mr * nr, 0);
+            kernel.microKernel(kc, a, b, tile, nr);
+
+            for (std::size_t numI = 0; numI < numValidR; ++numI)
+            {
+                for (std::size_t numJ = 0; numJ < numValidC; ++numJ)
+                {
+                    cTile[numI * ldc + numJ] += tile[numI * nr + numJ];
+                }
+            }
+        }
+    }
+}
+
+// c(m x n) = a(m x k) * b(n x k)^T in int32. The columns of c are split into
+// one block per work item; each item packs its own slice of b and walks all
+// rows of a, so no synchronization is needed within a call. For a signed a
+// the +128 shift applied while packing is removed once the block is done.
+template <typename T>
+void Int8Gemm(std::size_t m, std::size_t n, std::size_t k, const T* a,
+              std::size_t lda, const std::int8_t* b, std::size_t ldb,
+              std::int32_t* c, std::size_t ldc)
+{
+    const auto& kernel = KernelRegistry::Active().int8Gemm;
+    const std::size_t mr = kernel.mr;
+    const std::size_t nr = kernel.nr;
+
+    const std::size_t numThread = std::max<std::size_t>(
+        1u, std::min<std::size_t>(m * n * std::max<std::size_t>(k, 1u) /
+                                      1600000u,
+                                  Core::DefaultThreadPool().ThreadCount()));
+    const std::size_t columnBlock = std::min(
+        Int8NC, ((n + numThread - 1) / numThread + nr - 1) / nr * nr);
+    const std::size_t numColumnBlock = (n + columnBlock - 1) / columnBlock;
+
+    const auto runBlock = [&](std::size_t numB, std::size_t) {
+        static thread_local Core::Memory<std::uint8_t> packedAMemory;
+        static thread_local Core::Memory<std::int8_t> packedBMemory;
+
+        const std::size_t numJC = numB * columnBlock;
+        const std::size_t nc = std::min(columnBlock, n - numJC);
+
+        for (std::size_t numR = 0; numR < m; ++numR)
+        {
+            std::fill(c + numR * ldc + numJC, c + numR * ldc + numJC + nc, 0);
+        }
+
+        for (std::size_t numPC = 0; numPC < k; numPC += Int8KC)
         {
-            for (std::size_t numC = 0; numC < maxIndex; ++numC)
+            const std::size_t kc = std::min(Int8KC, k - numPC);
+            const std::size_t kcPadded = (kc + 3) / 4 * 4;
+
+            std::int8_t* packedB = AcquireBuffer(
+                packedBMemory, (nc + nr - 1) / nr * nr * kcPadded);
+            PackInt8Panels(nr, nc, kc, b + numJC * ldb + numPC, ldb,
+                           packedB);
+
+            for (std::size_t numIC = 0; numIC < m; numIC += Int8MC)
             {
-                lTransposed[numC * numRow + numR] = l[numR * maxIndex + numC];
+                const std::size_t mc = std::min(Int8MC, m - numIC);
+
+                std::uint8_t* packedA = AcquireBuffer(
+                    packedAMemory, (mc + mr - 1) / mr * mr * kcPadded);
+                PackInt8Panels(mr, mc, kc, a + numIC * lda + numPC, lda,
+                               packedA);
+
+                Int8MacroKernel(kernel, mc, nc, kcPadded, packedA, packedB,
+                                c + numIC * ldc + numJC, ldc);
             }
         }
 
-#pragma omp for schedule(guided)
-        for (std::int64_t numR = 0; numR < static_cast<std::int64_t>(numColumn);
-             ++numR)
+        if constexpr (std::is_signed_v<T>)
         {
-            for (std::size_t numC = 0; numC < maxIndex; ++numC)
+            for (std::size_t numC = 0; numC < nc; ++numC)
             {
-                std::size_t numIndex = 0;
-                auto sum = _mm256_setzero_ps();
+                const std::int8_t* row = b + (numJC + numC) * ldb;
+                std::int32_t sum = 0;
 
-                for (; numIndex + 8 <= numRow; numIndex += 8)
+                for (std::size_t numK = 0; numK < k; ++numK)
                 {
-                    sum = _mm256_fmadd_ps(
-                        _mm256_loadu_ps(gTransposed + numR * numRow + numIndex),
-                        _mm256_loadu_ps(lTransposed + numC * numRow + numIndex),
-                        sum);
+                    sum += row[numK];
                 }
 
-                const auto sum128 = _mm_add_ps(_mm256_extractf128_ps(sum, 1),
-                                               _mm256_castps256_ps128(sum));
-                const auto sum64 =
-                    _mm_add_ps(sum128, _mm_movehl_ps(sum128, sum128));
-                const auto sum32 =
-                    _mm_add_ss(sum64, _mm_shuffle_ps(sum64, sum64, 0x55));
-                auto numSum = _mm_cvtss_f32(sum32);
-
-                for (; numIndex < numRow; ++numIndex)
+                for (std::size_t numR = 0; numR < m; ++numR)
                 {
-                    numSum += gTransposed[numR * numRow + numIndex] *
-                              lTransposed[numC * numRow + numIndex];
+                    c[numR * ldc + numJC + numC] -= 128 * sum;
                 }
+            }
+        }
+    };
+
+    // One column block at a time, as schedule(dynamic) would.
+    Core::DefaultThreadPool().ParallelFor(numColumnBlock, 1, numThread,
+                                          runBlock);
+}
+
+// Heuristic used for signatures the tuner has no entry for.
+GEMMConfig DefaultConfig(std::size_t m, std::size_t n, std::size_t k)
+{
+    const auto& kernels = KernelRegistry::Active();
+
+    const std::size_t numThread = std::max<std::size_t>(
+        1u, std::min<std::size_t>(m * n * std::max<std::size_t>(k, 1u) /
+                                      1600000u,
+                                  Core::DefaultThreadPool().ThreadCount()));
+
+    // Too few output tiles to go around: parallelize the reduction instead,
+    // as long as every split still gets at least one full KC block.
+    const std::size_t numTile = (m + kernels.gemm.mr - 1) / kernels.gemm.mr *
+                                ((n + kernels.gemm.nr - 1) / kernels.gemm.nr);
+    const std::size_t numSplit = std::min(numThread, k / KC);
+
+    return GEMMConfig{ kernels.isa, MC, KC, NC, numThread,
+                       numTile < numThread && numSplit > 1 ? numSplit : 1 };
+}
+
+// Shared body of the GEMM::Gemm overloads.
+template <typename T>
+void RunGemm(GEMM::Transpose transA, GEMM::Transpose transB, std::size_t m,
+             std::size_t n, std::size_t k, float alpha, const float* a,
+             std::size_t lda, const T* b, std::size_t ldb, float beta,
+             float* c, std::size_t ldc, const GEMM::Epilogue& epilogue)
+{
+    if (!m || !n)
+    {
+        return;
+    }
 
-                d[numR * maxIndex + numC] += numSum;
+    // With alpha == 0 only the beta * c part remains.
+    if (alpha == 0.0f)
+    {
+        k = 0;
+    }
+
+    const bool isTransA = transA == GEMM::Transpose::Trans;
+    const bool isTransB = transB == GEMM::Transpose::Trans;
+
+    const auto run = [&](const GEMMConfig& config, float* destination) {
+        (config.numSplit > 1 ? SplitKGemm<T> : BlockedGemm<T>)(
+            config, m, n, k, alpha, a, isTransA ? 1 : lda, isTransA ? lda : 1,
+            b, isTransB ? 1 : ldb, isTransB ? ldb : 1, beta, destination,
+            ldc, epilogue);
+    };
+
+    GEMMConfig config = DefaultConfig(m, n, k);
+
+    // The tuning cache is keyed on the shape only, so it is reserved for
+    // fp32 operands.
+    if (std::is_same_v<T, float> && GEMMTuner::IsEnabled())
+    {
+        // Candidates write to a copy of c so that beta keeps applying to the
+        // caller's values in the final run. The copy is scratch rather than
+        // thread-local, as the thread may run other products while it waits
+        // for a candidate.
+        const auto measure = [&](const GEMMConfig& candidate) {
+            const std::size_t size = (m - 1) * ldc + n;
+            const Core::ScratchMemory<float> scratchMemory(size);
+            float* scratch = scratchMemory.Data();
+            std::copy(c, c + size, scratch);
+
+            const auto begin = std::chrono::steady_clock::now();
+            run(candidate, scratch);
+            const auto end = std::chrono::steady_clock::now();
+
+            return std::chrono::duration<double>(end - begin).count();
+        };
+
+        config = GEMMTuner::Find({ transA, transB, m, n, k }, config, measure);
+    }
+
+    run(config, c);
+}
+
+// Body of GEMM::GemmStridedBatched. The batch is shared out over one
+// parallel loop with every product on a single thread, so the threads are
+// started once per call rather than once per product. Only when there are
+// fewer products than threads does each product get spread over the
+// threads instead.
+void RunBatchedGemm(GEMM::Transpose transA, GEMM::Transpose transB,
+                    std::size_t m, std::size_t n, std::size_t k, float alpha,
+                    const float* a, std::size_t lda, std::size_t strideA,
+                    const float* b, std::size_t ldb, std::size_t strideB,
+                    float beta, float* c, std::size_t ldc,
+                    std::size_t strideC, std::size_t batchCount)
+{
+    if (!m || !n || !batchCount)
+    {
+        return;
+    }
+
+    const std::size_t numThread = std::max<std::size_t>(
+        1u, std::min<std::size_t>(batchCount * m * n *
+                                      std::max<std::size_t>(k, 1u) /
+                                      1600000u,
+                                  Core::DefaultThreadPool().ThreadCount()));
+
+    if (batchCount < numThread)
+    {
+        for (std::size_t numB = 0; numB < batchCount; ++numB)
+        {
+            RunGemm(transA, transB, m, n, k, alpha, a + numB * strideA, lda,
+                    b + numB * strideB, ldb, beta, c + numB * strideC, ldc,
+                    GEMM::Epilogue{});
+        }
+
+        return;
+    }
+
+    if (alpha == 0.0f)
+    {
+        k = 0;
+    }
+
+    const bool isTransA = transA == GEMM::Transpose::Trans;
+    const bool isTransB = transB == GEMM::Transpose::Trans;
+    const std::size_t aRowStride = isTransA ? 1 : lda;
+    const std::size_t aColStride = isTransA ? lda : 1;
+    const std::size_t bRowStride = isTransB ? 1 : ldb;
+    const std::size_t bColStride = isTransB ? ldb : 1;
+
+    const auto& kernels = KernelRegistry::Active();
+    const GEMMConfig config{ kernels.isa, MC, KC, NC, 1, 1 };
+    const bool isSmall = m <= MC && n <= MC && k <= KC;
+
+    Core::DefaultThreadPool().ParallelFor(
+        batchCount, (batchCount + numThread - 1) / numThread, numThread,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t index = begin; index < end; ++index)
+            {
+                (isSmall ? SmallGemm : BlockedGemm<float>)(
+                    config, m, n, k, alpha, a + index * strideA, aRowStride,
+                    aColStride, b + index * strideB, bRowStride, bColStride,
+                    beta, c + index * strideC, ldc, GEMM::Epilogue{});
             }
+        });
+}
+
+template <typename T, typename GEMV>
+void RunGEMV(GEMV gemv, std::size_t maxIndex, std::size_t numRow,
+             std::size_t numColumn, const float* left, const T* right,
+             float* destination, const GEMM::Epilogue& epilogue) noexcept
+{
+    for (std::size_t numR = 0; numR < numRow;
+         numR += KernelTable::MaxGEMVBatch)
+    {
+        const auto numBatch =
+            std::min(KernelTable::MaxGEMVBatch, numRow - numR);
+
+        gemv(numBatch, numColumn, maxIndex, left + numR * maxIndex, right,
+             destination + numR * numColumn, numColumn);
+
+        if (!IsEmpty(epilogue))
+        {
+            ApplyEpilogue(epilogue, 0, numBatch, numColumn,
+                          destination + numR * numColumn, numColumn);
         }
     }
 }
-}  // namespace CubbyDNN::Compute
\ No newline at end of file
+}  // namespace
+
+void GEMM::Gemm(Transpose transA, Transpose transB, std::size_t m,
+                std::size_t n, std::size_t k, float alpha,
+                const Core::Span<float> a, std::size_t lda,
+                const Core::Span<float> b, std::size_t ldb, float beta,
+                Core::Span<float> c, std::size_t ldc) noexcept
+{
+    RunGemm(transA, transB, m, n, k, alpha, a.begin(), lda, b.begin(), ldb,
+            beta, c.begin(), ldc, Epilogue{});
+}
+
+void GEMM::Gemm(Transpose transA, Transpose transB, std::size_t m,
+                std::size_t n, std::size_t k, float alpha,
+                const Core::Span<float> a, std::size_t lda,
+                const Core::Span<float> b, std::size_t ldb, float beta,
+                Core::Span<float> c, std::size_t ldc,
+                const Epilogue& epilogue) noexcept
+{
+    RunGemm(transA, transB, m, n, k, alpha, a.begin(), lda, b.begin(), ldb,
+            beta, c.begin(), ldc, epilogue);
+}
+
+void GEMM::Gemm(Transpose transA, Transpose transB, std::size_t m,
+                std::size_t n, std::size_t k, float alpha,
+                const Core::Span<float> a, std::size_t lda,
+                const Core::Span<Core::BFloat16> b, std::size_t ldb,
+                float beta, Core::Span<float> c, std::size_t ldc) noexcept
+{
+    RunGemm(transA, transB, m, n, k, alpha, a.begin(), lda, b.begin(), ldb,
+            beta, c.begin(), ldc, Epilogue{});
+}
+
+void GEMM::Gemm(Transpose transA, Transpose transB, std::size_t m,
+                std::size_t n, std::size_t k, float alpha,
+                const Core::Span<float> a, std::size_t lda,
+                const Core::Span<Core::BFloat16> b, std::size_t ldb,
+                float beta, Core::Span<float> c, std::size_t ldc,
+                const Epilogue& epilogue) noexcept
+{
+    RunGemm(transA, transB, m, n, k, alpha, a.begin(), lda, b.begin(), ldb,
+            beta, c.begin(), ldc, epilogue);
+}
+
+void GEMM::Gemm(Transpose transA, Transpose transB, std::size_t m,
+                std::size_t n, std::size_t k, float alpha,
+                const Core::Span<float> a, std::size_t lda,
+                const Core::Span<Core::Float16> b, std::size_t ldb,
+                float beta, Core::Span<float> c, std::size_t ldc) noexcept
+{
+    RunGemm(transA, transB, m, n, k, alpha, a.begin(), lda, b.begin(), ldb,
+            beta, c.begin(), ldc, Epilogue{});
+}
+
+void GEMM::Gemm(Transpose transA, Transpose transB, std::size_t m,
+                std::size_t n, std::size_t k, float alpha,
+                const Core::Span<float> a, std::size_t lda,
+                const Core::Span<Core::Float16> b, std::size_t ldb,
+                float beta, Core::Span<float> c, std::size_t ldc,
+                const Epilogue& epilogue) noexcept
+{
+    RunGemm(transA, transB, m, n, k, alpha, a.begin(), lda, b.begin(), ldb,
+            beta, c.begin(), ldc, epilogue);
+}
+
+void GEMM::GemmStridedBatched(Transpose transA, Transpose transB,
+                              std::size_t m, std::size_t n, std::size_t k,
+                              float alpha, const Core::Span<float> a,
+                              std::size_t lda, std::size_t strideA,
+                              const Core::Span<float> b, std::size_t ldb,
+                              std::size_t strideB, float beta,
+                              Core::Span<float> c, std::size_t ldc,
+                              std::size_t strideC,
+                              std::size_t batchCount) noexcept
+{
+    RunBatchedGemm(transA, transB, m, n, k, alpha, a.begin(), lda, strideA,
+                   b.begin(), ldb, strideB, beta, c.begin(), ldc, strideC,
+                   batchCount);
+}
+
+void GEMM::GemmU8S8(std::size_t m, std::size_t n, std::size_t k,
+                    const Core::Span<std::uint8_t> a, std::size_t lda,
+                    const Core::Span<std::int8_t> b, std::size_t ldb,
+                    Core::Span<std::int32_t> c, std::size_t ldc) noexcept
+{
+    if (!m || !n)
+    {
+        return;
+    }
+
+    Int8Gemm(m, n, k, a.begin(), lda, b.begin(), ldb, c.begin(), ldc);
+}
+
+void GEMM::GemmS8S8(std::size_t m, std::size_t n, std::size_t k,
+                    const Core::Span<std::int8_t> a, std::size_t lda,
+                    const Core::Span<std::int8_t> b, std::size_t ldb,
+                    Core::Span<std::int32_t> c, std::size_t ldc) noexcept
+{
+    if (!m || !n)
+    {
+        return;
+    }
+
+    Int8Gemm(m, n, k, a.begin(), lda, b.begin(), ldb, c.begin(), ldc);
+}
+
+std::int32_t GEMM::Int8MaxWeight() noexcept
+{
+    return KernelRegistry::Active().int8Gemm.maxWeight;
+}
+
+void GEMM::Multiply(std::size_t maxIndex, std::size_t numRow,
+                    std::size_t numColumn, const Core::Span<float> left,
+                    const Core::Span<float> right,
+                    Core::Span<float> destination) noexcept
+{
+    Gemm(Transpose::NoTrans, Transpose::Trans, numRow, numColumn, maxIndex,
+         1.0f, left, maxIndex, right, maxIndex, 0.0f, destination, numColumn);
+}
+
+void GEMM::MultiplyBatched(std::size_t batchCount, std::size_t maxIndex,
+                           std::size_t numRow, std::size_t numColumn,
+                           const Core::Span<float> left,
+                           const Core::Span<float> right,
+                           Core::Span<float> destination) noexcept
+{
+    GemmStridedBatched(Transpose::NoTrans, Transpose::Trans, numRow,
+                       numColumn, maxIndex, 1.0f, left, maxIndex,
+                       numRow * maxIndex, right, maxIndex,
+                       numColumn * maxIndex, 0.0f, destination, numColumn,
+                       numRow * numColumn, batchCount);
+}
+
+void GEMM::MultiplyAdd(std::size_t maxIndex, std::size_t numRow,
+                       std::size_t numColumn, const Core::Span<float> left,
+                       const Core::Span<float> right,
+                       Core::Span<float> destination) noexcept
+{
+    Gemm(Transpose::NoTrans, Transpose::Trans, numRow, numColumn, maxIndex,
+         1.0f, left, maxIndex, right, maxIndex, 1.0f, destination, numColumn);
+}
+
+void GEMM::MultiplyAdd(std::size_t maxIndex, std::size_t numRow,
+                       std::size_t numColumn, const Core::Span<float> left,
+                       const Core::Span<Core::BFloat16> right,
+                       Core::Span<float> destination) noexcept
+{
+    Gemm(Transpose::NoTrans, Transpose::Trans, numRow, numColumn, maxIndex,
+         1.0f, left, maxIndex, right, maxIndex, 1.0f, destination, numColumn);
+}
+
+void GEMM::MultiplyAdd(std::size_t maxIndex, std::size_t numRow,
+                       std::size_t numColumn, const Core::Span<float> left,
+                       const Core::Span<Core::Float16> right,
+                       Core::Span<float> destination) noexcept
+{
+    Gemm(Transpose::NoTrans, Transpose::Trans, numRow, numColumn, maxIndex,
+         1.0f, left, maxIndex, right, maxIndex, 1.0f, destination, numColumn);
+}
+
+void GEMM::MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                           std::size_t numColumn,
+                           const Core::Span<float> left,
+                           const Core::Span<float> right,
+                           Core::Span<float> destination) noexcept
+{
+    RunGEMV(KernelRegistry::Active().gemv, maxIndex, numRow, numColumn,
+            left.begin(), right.begin(), destination.begin(), Epilogue{});
+}
+
+void GEMM::MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                           std::size_t numColumn,
+                           const Core::Span<float> left,
+                           const Core::Span<float> right,
+                           Core::Span<float> destination,
+                           const Epilogue& epilogue) noexcept
+{
+    RunGEMV(KernelRegistry::Active().gemv, maxIndex, numRow, numColumn,
+            left.begin(), right.begin(), destination.begin(), epilogue);
+}
+
+void GEMM::MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                           std::size_t numColumn,
+                           const Core::Span<float> left,
+                           const Core::Span<Core::BFloat16> right,
+                           Core::Span<float> destination) noexcept
+{
+    RunGEMV(KernelRegistry::Active().bf16.gemv, maxIndex, numRow, numColumn,
+            left.begin(), right.begin(), destination.begin(), Epilogue{});
+}
+
+void GEMM::MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                           std::size_t numColumn,
+                           const Core::Span<float> left,
+                           const Core::Span<Core::BFloat16> right,
+                           Core::Span<float> destination,
+                           const Epilogue& epilogue) noexcept
+{
+    RunGEMV(KernelRegistry::Active().bf16.gemv, maxIndex, numRow, numColumn,
+            left.begin(), right.begin(), destination.begin(), epilogue);
+}
+
+void GEMM::MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                           std::size_t numColumn,
+                           const Core::Span<float> left,
+                           const Core::Span<Core::Float16> right,
+                           Core::Span<float> destination) noexcept
+{
+    RunGEMV(KernelRegistry::Active().fp16.gemv, maxIndex, numRow, numColumn,
+            left.begin(), right.begin(), destination.begin(), Epilogue{});
+}
+
+void GEMM::MultiplyAddGEMV(std::size_t maxIndex, std::size_t numRow,
+                           std::size_t numColumn,
+                           const Core::Span<float> left,
+                           const Core::Span<Core::Float16> right,
+                           Core::Span<float> destination,
+                           const Epilogue& epilogue) noexcept
+{
+    RunGEMV(KernelRegistry::Active().fp16.gemv, maxIndex, numRow, numColumn,
+            left.begin(), right.begin(), destination.begin(), epilogue);
+}
+
+void GEMM::ApplyEpilogue(std::size_t m, std::size_t n, Core::Span<float> c,
+                         std::size_t ldc, const Epilogue& epilogue) noexcept
+{
+    if (!IsEmpty(epilogue))
+    {
+        Compute::ApplyEpilogue(epilogue, 0, m, n, c.begin(), ldc);
+    }
+}
+
+void GEMM::dMultiplyLeft(std::size_t maxIndex, std::size_t numRow,
+                         std::size_t numColumn,
+                         const Core::Span<float> gradient,
+                         const Core::Span<float> right,
+                         Core::Span<float> destination) noexcept
+{
+    Gemm(Transpose::NoTrans, Transpose::NoTrans, numRow, maxIndex, numColumn,
+         1.0f, gradient, numColumn, right, maxIndex, 0.0f, destination,
+         maxIndex);
+}
+
+void GEMM::dMultiplyAddLeft(std::size_t maxIndex, std::size_t numRow,
+                            std::size_t numColumn,
+                            const Core::Span<float> gradient,
+                            const Core::Span<float> right,
+                            Core::Span<float> destination) noexcept
+{
+    Gemm(Transpose::NoTrans, Transpose::NoTrans, numRow, maxIndex, numColumn,
+         1.0f, gradient, numColumn, right, maxIndex, 1.0f, destination,
+         maxIndex);
+}
+
+void GEMM::dMultiplyRight(std::size_t maxIndex, std::size_t numRow,
+                          std::size_t numColumn,
+                          const Core::Span<float> gradient,
+                          const Core::Span<float> left,
+                          Core::Span<float> destination) noexcept
+{
+    Gemm(Transpose::Trans, Transpose::NoTrans, numColumn, maxIndex, numRow,
+         1.0f, gradient, numColumn, left, maxIndex, 0.0f, destination,
+         maxIndex);
+}
+
+void GEMM::dMultiplyAddRight(std::size_t maxIndex, std::size_t numRow,
+                             std::size_t numColumn,
+                             const Core::Span<float> gradient,
+                             const Core::Span<float> left,
+                             Core::Span<float> destination) noexcept
+{
+    Gemm(Transpose::Trans, Transpose::NoTrans, numColumn, maxIndex, numRow,
+         1.0f, gradient, numColumn, left, maxIndex, 1.0f, destination,
+         maxIndex);
+}
+}  // namespace CubbyDNN::Compute
@@ -0,0 +1,381 @@
+#include <CubbyDNN/Compute/GEMMTuner.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <initializer_list>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+struct SignatureHash
+{
+    std::size_t operator()(const GEMMSignature& signature) const noexcept
+    {
+        std::size_t seed = static_cast<std::size_t>(signature.transA) * 2 +
+                           static_cast<std::size_t>(signature.transB);
+
+        for (const auto value : { signature.m, signature.n, signature.k })
+        {
+            seed ^= std::hash<std::size_t>()(value) + 0x9e3779b9 +
+                    (seed << 6) + (seed >> 2);
+        }
+
+        return seed;
+    }
+};
+
+struct TunerState
+{
+    std::mutex mutex;
+    std::unordered_map<GEMMSignature, GEMMConfig, SignatureHash> cache;
+    std::string path;
+    std::atomic<bool> isAutotune{ false };
+    std::atomic<bool> isEmpty{ true };
+};
+
+// One line per signature:
+// <transA> <transB> <m> <n> <k> <isa> <mc> <kc> <nc> <numThread> <numSplit>
+std::string FormatEntry(const GEMMSignature& signature,
+                        const GEMMConfig& config)
+{
+    std::ostringstream stream;
+
+    stream << (signature.transA == GEMM::Transpose::Trans ? 'T' : 'N') << ' '
+           << (signature.transB == GEMM::Transpose::Trans ? 'T' : 'N') << ' '
+           << signature.m << ' ' << signature.n << ' ' << signature.k << ' '
+           << CPUInfo::Name(config.isa) << ' ' << config.mc << ' '
+           << config.kc << ' ' << config.nc << ' ' << config.numThread << ' '
+           << config.numSplit;
+
+    return stream.str();
+}
+
+bool ParseTranspose(char value, GEMM::Transpose& transpose) noexcept
+{
+    if (value != 'N' && value != 'T')
+    {
+        return false;
+    }
+
+    transpose = value == 'T' ? GEMM::Transpose::Trans
+                             : GEMM::Transpose::NoTrans;
+
+    return true;
+}
+
+bool ParseEntry(const std::string& line, GEMMSignature& signature,
+                GEMMConfig& config)
+{
+    std::istringstream stream(line);
+    char transA = 0, transB = 0;
+    std::string isaName;
+
+    if (!(stream >> transA >> transB >> signature.m >> signature.n >>
+          signature.k >> isaName >> config.mc >> config.kc >> config.nc >>
+          config.numThread >> config.numSplit))
+    {
+        return false;
+    }
+
+    return ParseTranspose(transA, signature.transA) &&
+           ParseTranspose(transB, signature.transB) &&
+           CPUInfo::Parse(isaName, config.isa) &&
+           CPUInfo::IsSupported(config.isa) && config.mc && config.kc &&
+           config.nc && config.numThread && config.numSplit;
+}
+
+bool LoadFile(TunerState& state, const std::string& path)
+{
+    std::ifstream file(path);
+
+    if (!file)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        GEMMSignature signature{};
+        GEMMConfig config{};
+
+        if (ParseEntry(line, signature, config))
+        {
+            state.cache[signature] = config;
+        }
+    }
+
+    state.isEmpty = state.cache.empty();
+
+    return true;
+}
+
+TunerState& State()
+{
+    static TunerState state;
+    static const bool isInitialized = [] {
+        const char* autotune = std::getenv("CUBBYDNN_GEMM_AUTOTUNE");
+        state.isAutotune = autotune && *autotune &&
+                           std::string_view(autotune) != "0";
+
+        if (const char* path = std::getenv("CUBBYDNN_GEMM_TUNING_FILE"))
+        {
+            state.path = path;
+            LoadFile(state, state.path);
+        }
+
+        return true;
+    }();
+
+    static_cast<void>(isInitialized);
+
+    return state;
+}
+
+// Keeps the fastest of a few runs so that one preempted run does not decide
+// the winner. Slow shapes are only measured once.
+double Benchmark(const GEMMTuner::Measure& measure, const GEMMConfig& config)
+{
+    double best = measure(config);
+
+    for (int repeat = 1; repeat < 3 && best < 0.05; ++repeat)
+    {
+        best = std::min(best, measure(config));
+    }
+
+    return best;
+}
+
+// Ascending block sizes up to the first one that covers the whole dimension;
+// anything larger behaves the same.
+std::vector<std::size_t> Candidates(std::initializer_list<std::size_t> values,
+                                    std::size_t limit)
+{
+    std::vector<std::size_t> result;
+
+    for (const auto value : values)
+    {
+        result.push_back(value);
+
+        if (value >= limit)
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+// Coordinate descent starting from fallback: the kernel set, the thread
+// count, split-K and then each blocking parameter are varied one at a time
+// while the others keep their best value so far.
+GEMMConfig Tune(const GEMMSignature& signature, const GEMMConfig& fallback,
+                const GEMMTuner::Measure& measure)
+{
+    GEMMConfig best = fallback;
+    double bestTime = Benchmark(measure, best);
+
+    const auto tryCandidate = [&](const GEMMConfig& candidate) {
+        if (candidate == best)
+        {
+            return;
+        }
+
+        const double time = Benchmark(measure, candidate);
+
+        if (time < bestTime)
+        {
+            best = candidate;
+            bestTime = time;
+        }
+    };
+
+    for (const auto isa : { ISA::SSE42, ISA::AVX2, ISA::AVX512 })
+    {
+        if (CPUInfo::IsSupported(isa))
+        {
+            auto candidate = best;
+            candidate.isa = isa;
+            tryCandidate(candidate);
+        }
+    }
+
+    const std::size_t maxThread =
+        Core::DefaultThreadPool().ThreadCount();
+
+    for (std::size_t numThread = 1;; numThread *= 2)
+    {
+        auto candidate = best;
+        candidate.numThread = std::min(numThread, maxThread);
+        candidate.numSplit = 1;
+        tryCandidate(candidate);
+
+        if (numThread >= maxThread)
+        {
+            break;
+        }
+    }
+
+    // Every split still has to get at least one full kc block.
+    for (std::size_t numSplit = 2;
+         numSplit <= maxThread && numSplit * best.kc <= signature.k;
+         numSplit *= 2)
+    {
+        auto candidate = best;
+        candidate.numThread = numSplit;
+        candidate.numSplit = numSplit;
+        tryCandidate(candidate);
+    }
+
+    for (const auto kc : Candidates({ 128, 192, 256, 384, 512 }, signature.k))
+    {
+        auto candidate = best;
+        candidate.kc = kc;
+        tryCandidate(candidate);
+    }
+
+    for (const auto mc : Candidates({ 48, 96, 144, 192, 288 }, signature.m))
+    {
+        auto candidate = best;
+        candidate.mc = mc;
+        tryCandidate(candidate);
+    }
+
+    for (const auto nc : Candidates({ 1024, 2048, 3072, 4096 }, signature.n))
+    {
+        auto candidate = best;
+        candidate.nc = nc;
+        tryCandidate(candidate);
+    }
+
+    return best;
+}
+}  // namespace
+
+bool GEMMSignature::operator==(const GEMMSignature& rhs) const noexcept
+{
+    return transA == rhs.transA && transB == rhs.transB && m == rhs.m &&
+           n == rhs.n && k == rhs.k;
+}
+
+bool GEMMConfig::operator==(const GEMMConfig& rhs) const noexcept
+{
+    return isa == rhs.isa && mc == rhs.mc && kc == rhs.kc && nc == rhs.nc &&
+           numThread == rhs.numThread && numSplit == rhs.numSplit;
+}
+
+bool GEMMTuner::IsEnabled() noexcept
+{
+    const auto& state = State();
+
+    return state.isAutotune || !state.isEmpty;
+}
+
+bool GEMMTuner::IsAutotune() noexcept
+{
+    return State().isAutotune;
+}
+
+void GEMMTuner::SetAutotune(bool autotune) noexcept
+{
+    State().isAutotune = autotune;
+}
+
+GEMMConfig GEMMTuner::Find(const GEMMSignature& signature,
+                           const GEMMConfig& fallback, const Measure& measure)
+{
+    auto& state = State();
+
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        const auto iter = state.cache.find(signature);
+
+        if (iter != state.cache.end())
+        {
+            return iter->second;
+        }
+    }
+
+    if (!state.isAutotune)
+    {
+        return fallback;
+    }
+
+    const auto config = Tune(signature, fallback, measure);
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.cache[signature] = config;
+    state.isEmpty = false;
+
+    if (!state.path.empty())
+    {
+        std::ofstream file(state.path, std::ios::app);
+        file << FormatEntry(signature, config) << '\n';
+    }
+
+    return config;
+}
+
+bool GEMMTuner::Lookup(const GEMMSignature& signature, GEMMConfig& config)
+{
+    auto& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    const auto iter = state.cache.find(signature);
+
+    if (iter == state.cache.end())
+    {
+        return false;
+    }
+
+    config = iter->second;
+
+    return true;
+}
+
+bool GEMMTuner::Load(const std::string& path)
+{
+    return LoadFile(State(), path);
+}
+
+void GEMMTuner::Save(const std::string& path)
+{
+    auto& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    std::ofstream file(path, std::ios::trunc);
+
+    if (!file)
+    {
+        throw std::runtime_error("Cannot open the GEMM tuning file");
+    }
+
+    file << "# transA transB m n k isa mc kc nc numThread numSplit\n";
+
+    for (const auto& [signature, config] : state.cache)
+    {
+        file << FormatEntry(signature, config) << '\n';
+    }
+}
+
+void GEMMTuner::Clear()
+{
+    auto& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    state.cache.clear();
+    state.isEmpty = true;
+}
+}  // namespace CubbyDNN::Compute
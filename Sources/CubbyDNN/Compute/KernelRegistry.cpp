@@ -0,0 +1,75 @@
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#include <atomic>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+std::atomic<bool>& IsBuiltFlag(ISA isa) noexcept
+{
+    static std::atomic<bool> flagList[4] = {};
+
+    return flagList[static_cast<std::size_t>(isa)];
+}
+
+// The table of Isa, built by builder on first use.
+template <ISA Isa>
+const KernelTable& BuiltTable(KernelTable (*builder)() noexcept) noexcept
+{
+    static const KernelTable table = [builder] {
+        IsBuiltFlag(Isa).store(true, std::memory_order_release);
+
+        return builder();
+    }();
+
+    return table;
+}
+
+std::atomic<const KernelTable*>& ActiveTable() noexcept
+{
+    static std::atomic<const KernelTable*> table{ &KernelRegistry::Get(
+        CPUInfo::PreferredISA()) };
+
+    return table;
+}
+}  // namespace
+
+const KernelTable& KernelRegistry::Active() noexcept
+{
+    return *ActiveTable().load(std::memory_order_acquire);
+}
+
+ISA KernelRegistry::Bind(ISA isa) noexcept
+{
+    const ISA bound = CPUInfo::IsSupported(isa) ? isa : CPUInfo::SupportedISA();
+
+    ActiveTable().store(&Get(bound), std::memory_order_release);
+
+    return bound;
+}
+
+const KernelTable& KernelRegistry::Get(ISA isa) noexcept
+{
+    // The builders live in translation units compiled for their ISA and may
+    // use its instructions themselves, so each table is only built once the
+    // CPU is known to run it.
+    switch (CPUInfo::IsSupported(isa) ? isa : CPUInfo::SupportedISA())
+    {
+        case ISA::SSE42:
+            return BuiltTable<ISA::SSE42>(SSE42KernelTable);
+        case ISA::AVX2:
+            return BuiltTable<ISA::AVX2>(AVX2KernelTable);
+        case ISA::AVX512:
+            return BuiltTable<ISA::AVX512>(AVX512KernelTable);
+        case ISA::Scalar:
+        default:
+            return BuiltTable<ISA::Scalar>(ScalarKernelTable);
+    }
+}
+
+bool KernelRegistry::IsBuilt(ISA isa) noexcept
+{
+    return IsBuiltFlag(isa).load(std::memory_order_acquire);
+}
+}  // namespace CubbyDNN::Compute
@@ -0,0 +1,664 @@
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#if defined(CUBBYDNN_ARCH_X86)
+
+#include <cstring>
+#include <immintrin.h>
+#include <limits>
+#include <utility>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+// 6 x 16 tile: 12 ymm accumulators, 2 for the b row and 1 broadcast.
+constexpr std::size_t MR = 6;
+constexpr std::size_t NR = 16;
+
+// 6 x 16 int32 tile, laid out like the float one. One ymm of b holds four k
+// for eight columns.
+constexpr std::size_t Int8MR = 6;
+constexpr std::size_t Int8NR = 16;
+
+void MicroKernel(std::size_t kc, const float* __restrict a,
+                 const float* __restrict b, float* c,
+                 std::size_t ldc) noexcept
+{
+    auto c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    auto c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    auto c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    auto c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    auto c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    auto c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+    for (std::size_t numK = 0; numK < kc; ++numK)
+    {
+        const auto b0 = _mm256_load_ps(b);
+        const auto b1 = _mm256_load_ps(b + 8);
+
+        auto ai = _mm256_broadcast_ss(a);
+        c00 = _mm256_fmadd_ps(ai, b0, c00);
+        c01 = _mm256_fmadd_ps(ai, b1, c01);
+
+        ai = _mm256_broadcast_ss(a + 1);
+        c10 = _mm256_fmadd_ps(ai, b0, c10);
+        c11 = _mm256_fmadd_ps(ai, b1, c11);
+
+        ai = _mm256_broadcast_ss(a + 2);
+        c20 = _mm256_fmadd_ps(ai, b0, c20);
+        c21 = _mm256_fmadd_ps(ai, b1, c21);
+
+        ai = _mm256_broadcast_ss(a + 3);
+        c30 = _mm256_fmadd_ps(ai, b0, c30);
+        c31 = _mm256_fmadd_ps(ai, b1, c31);
+
+        ai = _mm256_broadcast_ss(a + 4);
+        c40 = _mm256_fmadd_ps(ai, b0, c40);
+        c41 = _mm256_fmadd_ps(ai, b1, c41);
+
+        ai = _mm256_broadcast_ss(a + 5);
+        c50 = _mm256_fmadd_ps(ai, b0, c50);
+        c51 = _mm256_fmadd_ps(ai, b1, c51);
+
+        a += MR;
+        b += NR;
+    }
+
+    const auto store = [](float* row, __m256 lo, __m256 hi) {
+        _mm256_storeu_ps(row, _mm256_add_ps(_mm256_loadu_ps(row), lo));
+        _mm256_storeu_ps(row + 8, _mm256_add_ps(_mm256_loadu_ps(row + 8), hi));
+    };
+
+    store(c, c00, c01);
+    store(c + ldc, c10, c11);
+    store(c + 2 * ldc, c20, c21);
+    store(c + 3 * ldc, c30, c31);
+    store(c + 4 * ldc, c40, c41);
+    store(c + 5 * ldc, c50, c51);
+}
+
+// Four consecutive k of one row of a, broadcast to every 32-bit lane.
+__m256i BroadcastGroup(const std::uint8_t* a) noexcept
+{
+    std::int32_t group;
+    std::memcpy(&group, a, sizeof(group));
+
+    return _mm256_set1_epi32(group);
+}
+
+// vpmaddubsw forms u8 x s8 pair sums in 16 bits, vpmaddwd by one widens and
+// adds the pairs into the four-k dot product per 32-bit lane.
+__m256i DotGroup(__m256i a, __m256i b, __m256i ones) noexcept
+{
+    return _mm256_madd_epi16(_mm256_maddubs_epi16(a, b), ones);
+}
+
+void Int8MicroKernel(std::size_t kc, const std::uint8_t* __restrict a,
+                     const std::int8_t* __restrict b, std::int32_t* c,
+                     std::size_t ldc) noexcept
+{
+    const auto ones = _mm256_set1_epi16(1);
+
+    auto c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+    auto c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+    auto c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+    auto c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+    auto c40 = _mm256_setzero_si256(), c41 = _mm256_setzero_si256();
+    auto c50 = _mm256_setzero_si256(), c51 = _mm256_setzero_si256();
+
+    for (std::size_t numK = 0; numK < kc; numK += 4)
+    {
+        const auto b0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(b));
+        const auto b1 =
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(b + 32));
+
+        auto ai = BroadcastGroup(a);
+        c00 = _mm256_add_epi32(c00, DotGroup(ai, b0, ones));
+        c01 = _mm256_add_epi32(c01, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 4);
+        c10 = _mm256_add_epi32(c10, DotGroup(ai, b0, ones));
+        c11 = _mm256_add_epi32(c11, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 8);
+        c20 = _mm256_add_epi32(c20, DotGroup(ai, b0, ones));
+        c21 = _mm256_add_epi32(c21, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 12);
+        c30 = _mm256_add_epi32(c30, DotGroup(ai, b0, ones));
+        c31 = _mm256_add_epi32(c31, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 16);
+        c40 = _mm256_add_epi32(c40, DotGroup(ai, b0, ones));
+        c41 = _mm256_add_epi32(c41, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 20);
+        c50 = _mm256_add_epi32(c50, DotGroup(ai, b0, ones));
+        c51 = _mm256_add_epi32(c51, DotGroup(ai, b1, ones));
+
+        a += Int8MR * 4;
+        b += Int8NR * 4;
+    }
+
+    const auto store = [](std::int32_t* row, __m256i lo, __m256i hi) {
+        auto* lower = reinterpret_cast<__m256i*>(row);
+        auto* upper = reinterpret_cast<__m256i*>(row + 8);
+
+        _mm256_storeu_si256(lower,
+                            _mm256_add_epi32(_mm256_loadu_si256(lower), lo));
+        _mm256_storeu_si256(upper,
+                            _mm256_add_epi32(_mm256_loadu_si256(upper), hi));
+    };
+
+    store(c, c00, c01);
+    store(c + ldc, c10, c11);
+    store(c + 2 * ldc, c20, c21);
+    store(c + 3 * ldc, c30, c31);
+    store(c + 4 * ldc, c40, c41);
+    store(c + 5 * ldc, c50, c51);
+}
+
+float HorizontalSum(__m256 sum) noexcept
+{
+    const auto sum128 = _mm_add_ps(_mm256_extractf128_ps(sum, 1),
+                                   _mm256_castps256_ps128(sum));
+    const auto sum64 = _mm_add_ps(sum128, _mm_movehl_ps(sum128, sum128));
+    const auto sum32 = _mm_add_ss(sum64, _mm_shuffle_ps(sum64, sum64, 0x55));
+
+    return _mm_cvtss_f32(sum32);
+}
+
+float Dot(std::size_t length, const float* __restrict x,
+          const float* __restrict y) noexcept
+{
+    std::size_t index = 0;
+    auto sum = _mm256_setzero_ps();
+
+    for (; index + 8 <= length; index += 8)
+    {
+        sum = _mm256_fmadd_ps(_mm256_loadu_ps(x + index),
+                              _mm256_loadu_ps(y + index), sum);
+    }
+
+    auto result = HorizontalSum(sum);
+
+    for (; index < length; ++index)
+    {
+        result += x[index] * y[index];
+    }
+
+    return result;
+}
+
+void Axpy(std::size_t length, float alpha, const float* __restrict x,
+          float* __restrict y) noexcept
+{
+    std::size_t index = 0;
+    const auto a = _mm256_set1_ps(alpha);
+
+    for (; index + 8 <= length; index += 8)
+    {
+        _mm256_storeu_ps(y + index,
+                         _mm256_fmadd_ps(a, _mm256_loadu_ps(x + index),
+                                         _mm256_loadu_ps(y + index)));
+    }
+
+    for (; index < length; ++index)
+    {
+        y[index] += alpha * x[index];
+    }
+}
+
+// sizeof...(Vector) ymm of y, kept in registers across all count terms.
+template <std::size_t... Vector>
+void GatherAxpyChunk(std::index_sequence<Vector...>, std::size_t count,
+                     const float* __restrict alpha, std::size_t alphaStride,
+                     const std::uint32_t* __restrict index,
+                     const float* __restrict x, std::size_t ldx,
+                     float* __restrict y) noexcept
+{
+    __m256 sum[] = { _mm256_loadu_ps(y + Vector * 8)... };
+
+    for (std::size_t numK = 0; numK < count; ++numK)
+    {
+        const auto a = _mm256_set1_ps(alpha[numK * alphaStride]);
+        const float* xk = x + index[numK] * ldx;
+
+        ((sum[Vector] =
+              _mm256_fmadd_ps(a, _mm256_loadu_ps(xk + Vector * 8),
+                              sum[Vector])),
+         ...);
+    }
+
+    (_mm256_storeu_ps(y + Vector * 8, sum[Vector]), ...);
+}
+
+void GatherAxpy(std::size_t count, const float* __restrict alpha,
+                std::size_t alphaStride, const std::uint32_t* __restrict index,
+                const float* __restrict x, std::size_t ldx, std::size_t length,
+                float* __restrict y) noexcept
+{
+    std::size_t offset = 0;
+
+    for (; offset + 32 <= length; offset += 32)
+    {
+        GatherAxpyChunk(std::make_index_sequence<4>(), count, alpha,
+                        alphaStride, index, x + offset, ldx, y + offset);
+    }
+
+    for (; offset + 8 <= length; offset += 8)
+    {
+        GatherAxpyChunk(std::make_index_sequence<1>(), count, alpha,
+                        alphaStride, index, x + offset, ldx, y + offset);
+    }
+
+    for (; offset < length; ++offset)
+    {
+        float sum = y[offset];
+
+        for (std::size_t numK = 0; numK < count; ++numK)
+        {
+            sum += alpha[numK * alphaStride] * x[index[numK] * ldx + offset];
+        }
+
+        y[offset] = sum;
+    }
+}
+
+// Eight consecutive elements of a weight row widened to fp32.
+__m256 LoadWeight(const float* w) noexcept
+{
+    return _mm256_loadu_ps(w);
+}
+
+__m256 LoadWeight(const Core::BFloat16* w) noexcept
+{
+    const auto bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w));
+
+    return _mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_cvtepu16_epi32(bits), 16));
+}
+
+// Only reached when the CPU reports F16C.
+__m256 LoadWeight(const Core::Float16* w) noexcept
+{
+    return _mm256_cvtph_ps(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(w)));
+}
+
+float WidenWeight(float w) noexcept
+{
+    return w;
+}
+
+template <typename T>
+float WidenWeight(T w) noexcept
+{
+    return w.ToFloat();
+}
+
+// NumW rows of w against NumB batch vectors with one accumulator per pair
+// (Index = numW * NumB + numB): every w element loaded feeds NumB fmas, and
+// the independent chains hide the fma latency. The pack expansion unrolls
+// the pairs at compile time so the accumulators stay in registers.
+template <std::size_t NumB, std::size_t NumW, typename T,
+          std::size_t... Index>
+void GEMVBlock(std::index_sequence<Index...>, std::size_t length,
+               const float* __restrict x, const T* __restrict w, float* y,
+               std::size_t ldy) noexcept
+{
+    __m256 sum[] = { (static_cast<void>(Index), _mm256_setzero_ps())... };
+
+    std::size_t index = 0;
+
+    for (; index + 8 <= length; index += 8)
+    {
+        ((sum[Index] = _mm256_fmadd_ps(
+              LoadWeight(w + Index / NumB * length + index),
+              _mm256_loadu_ps(x + Index % NumB * length + index),
+              sum[Index])),
+         ...);
+    }
+
+    const auto reduce = [&](std::size_t pair, __m256 partial) {
+        const auto* row = w + pair / NumB * length;
+        const auto* vector = x + pair % NumB * length;
+        auto result = HorizontalSum(partial);
+
+        for (std::size_t tail = index; tail < length; ++tail)
+        {
+            result += WidenWeight(row[tail]) * vector[tail];
+        }
+
+        y[pair % NumB * ldy + pair / NumB] += result;
+    };
+
+    (reduce(Index, sum[Index]), ...);
+}
+
+template <std::size_t NumB, typename T>
+void GEMVBatch(std::size_t numRow, std::size_t length, const float* x,
+               const T* w, float* y, std::size_t ldy) noexcept
+{
+    // Keep NumW * NumB accumulators within half the register file.
+    constexpr std::size_t NumW = NumB >= 8 ? 1 : 8 / NumB;
+
+    std::size_t numR = 0;
+
+    for (; numR + NumW <= numRow; numR += NumW)
+    {
+        GEMVBlock<NumB, NumW>(std::make_index_sequence<NumW * NumB>(),
+                              length, x, w + numR * length, y + numR, ldy);
+    }
+
+    for (; numR < numRow; ++numR)
+    {
+        GEMVBlock<NumB, 1>(std::make_index_sequence<NumB>(), length, x,
+                           w + numR * length, y + numR, ldy);
+    }
+}
+
+template <typename T>
+void GEMV(std::size_t numBatch, std::size_t numRow, std::size_t length,
+          const float* x, const T* w, float* y, std::size_t ldy) noexcept
+{
+    switch (numBatch)
+    {
+        case 1:
+            GEMVBatch<1>(numRow, length, x, w, y, ldy);
+            break;
+        case 2:
+            GEMVBatch<2>(numRow, length, x, w, y, ldy);
+            break;
+        case 3:
+            GEMVBatch<3>(numRow, length, x, w, y, ldy);
+            break;
+        case 4:
+            GEMVBatch<4>(numRow, length, x, w, y, ldy);
+            break;
+        case 5:
+            GEMVBatch<5>(numRow, length, x, w, y, ldy);
+            break;
+        case 6:
+            GEMVBatch<6>(numRow, length, x, w, y, ldy);
+            break;
+        case 7:
+            GEMVBatch<7>(numRow, length, x, w, y, ldy);
+            break;
+        case 8:
+            GEMVBatch<8>(numRow, length, x, w, y, ldy);
+            break;
+        default:
+            break;
+    }
+}
+
+template <typename T>
+void HalfToFloat(std::size_t length, const T* __restrict x,
+                 float* __restrict y) noexcept
+{
+    std::size_t index = 0;
+
+    for (; index + 8 <= length; index += 8)
+    {
+        _mm256_storeu_ps(y + index, LoadWeight(x + index));
+    }
+
+    for (; index < length; ++index)
+    {
+        y[index] = x[index].ToFloat();
+    }
+}
+
+// Eight floats rounded to bfloat16 in the low 16 bits of each lane, with
+// the same rounding and NaN handling as Core::BFloat16::FromFloat.
+__m256i RoundToBFloat16(__m256 value) noexcept
+{
+    const auto bits = _mm256_castps_si256(value);
+    const auto isOdd =
+        _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+    const auto rounded = _mm256_add_epi32(
+        bits, _mm256_add_epi32(isOdd, _mm256_set1_epi32(0x7FFF)));
+    const auto quietNaN = _mm256_or_si256(bits, _mm256_set1_epi32(0x400000));
+    const auto isNaN = _mm256_castps_si256(
+        _mm256_cmp_ps(value, value, _CMP_UNORD_Q));
+
+    return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, quietNaN, isNaN),
+                             16);
+}
+
+void FloatToBFloat16(std::size_t length, const float* __restrict x,
+                     Core::BFloat16* __restrict y) noexcept
+{
+    std::size_t index = 0;
+
+    for (; index + 16 <= length; index += 16)
+    {
+        // packus interleaves the 128-bit lanes; permute restores the order.
+        const auto packed = _mm256_packus_epi32(
+            RoundToBFloat16(_mm256_loadu_ps(x + index)),
+            RoundToBFloat16(_mm256_loadu_ps(x + index + 8)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + index),
+                            _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+
+    for (; index < length; ++index)
+    {
+        y[index] = Core::BFloat16::FromFloat(x[index]);
+    }
+}
+
+void FloatToFloat16(std::size_t length, const float* __restrict x,
+                    Core::Float16* __restrict y) noexcept
+{
+    std::size_t index = 0;
+
+    for (; index + 8 <= length; index += 8)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(y + index),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(x + index),
+                                         _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    for (; index < length; ++index)
+    {
+        y[index] = Core::Float16::FromFloat(x[index]);
+    }
+}
+
+// The sign is taken from a comparison rather than the sign bit, so that -0
+// passes through as x < 0 would have it.
+void LeakyReLU(std::size_t length, float alpha, const float* x,
+               float* y) noexcept
+{
+    std::size_t index = 0;
+    const auto a = _mm256_set1_ps(alpha);
+    const auto zero = _mm256_setzero_ps();
+
+    for (; index + 8 <= length; index += 8)
+    {
+        const auto value = _mm256_loadu_ps(x + index);
+
+        _mm256_storeu_ps(
+            y + index,
+            _mm256_blendv_ps(value, _mm256_mul_ps(a, value),
+                             _mm256_cmp_ps(value, zero, _CMP_LT_OQ)));
+    }
+
+    for (; index < length; ++index)
+    {
+        y[index] = x[index] < 0.0f ? alpha * x[index] : x[index];
+    }
+}
+
+void LeakyReLUGradient(std::size_t length, float alpha, const float* x,
+                       const float* dy, float* dx, bool isAdd) noexcept
+{
+    std::size_t index = 0;
+    const auto a = _mm256_set1_ps(alpha);
+    const auto zero = _mm256_setzero_ps();
+
+    for (; index + 8 <= length; index += 8)
+    {
+        const auto gradient = _mm256_loadu_ps(dy + index);
+        auto result = _mm256_blendv_ps(
+            gradient, _mm256_mul_ps(a, gradient),
+            _mm256_cmp_ps(_mm256_loadu_ps(x + index), zero, _CMP_LE_OQ));
+
+        if (isAdd)
+        {
+            result = _mm256_add_ps(_mm256_loadu_ps(dx + index), result);
+        }
+
+        _mm256_storeu_ps(dx + index, result);
+    }
+
+    for (; index < length; ++index)
+    {
+        const float gradient = x[index] <= 0.0f ? alpha * dy[index] : dy[index];
+
+        dx[index] = isAdd ? dx[index] + gradient : gradient;
+    }
+}
+
+// All ones in the first length lanes, for a tail of length < 8.
+__m256i TailMask(std::size_t length) noexcept
+{
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(length)),
+                              _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+float Max(std::size_t length, const float* x) noexcept
+{
+    std::size_t index = 0;
+    const auto lowest =
+        _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+    auto result = lowest;
+
+    for (; index + 8 <= length; index += 8)
+    {
+        result = _mm256_max_ps(result, _mm256_loadu_ps(x + index));
+    }
+
+    if (index < length)
+    {
+        const auto mask = TailMask(length - index);
+
+        result = _mm256_max_ps(
+            result,
+            _mm256_blendv_ps(lowest, _mm256_maskload_ps(x + index, mask),
+                             _mm256_castsi256_ps(mask)));
+    }
+
+    auto max128 = _mm_max_ps(_mm256_extractf128_ps(result, 1),
+                             _mm256_castps256_ps128(result));
+    max128 = _mm_max_ps(max128, _mm_movehl_ps(max128, max128));
+    max128 = _mm_max_ss(max128, _mm_shuffle_ps(max128, max128, 0x55));
+
+    return _mm_cvtss_f32(max128);
+}
+
+// exp(x) after Cephes' expf: 2^n * p(r), with n = round(x / ln 2), r = x -
+// n ln 2 in two parts and p a degree 7 polynomial. Values that would turn
+// subnormal are flushed to zero. The bounds come first in the clamps, so
+// that a NaN in x passes through.
+__m256 Exp(__m256 x) noexcept
+{
+    const auto lowest = _mm256_set1_ps(-87.33f);
+    const auto underflow = _mm256_cmp_ps(x, lowest, _CMP_LT_OQ);
+
+    x = _mm256_min_ps(_mm256_set1_ps(88.0f), _mm256_max_ps(lowest, x));
+
+    const auto n =
+        _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504f)),
+                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const auto r = _mm256_fnmadd_ps(
+        n, _mm256_set1_ps(-2.12194440e-4f),
+        _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), x));
+
+    auto p = _mm256_set1_ps(1.9875691500e-4f);
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(1.3981999507e-3f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(8.3334519073e-3f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(4.1665795894e-2f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(1.6666665459e-1f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(5.0000001201e-1f));
+    p = _mm256_add_ps(_mm256_fmadd_ps(p, _mm256_mul_ps(r, r), r),
+                      _mm256_set1_ps(1.0f));
+
+    const auto scale = _mm256_castsi256_ps(_mm256_slli_epi32(
+        _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)),
+        23));
+
+    return _mm256_andnot_ps(underflow, _mm256_mul_ps(p, scale));
+}
+
+float ShiftedExp(std::size_t length, float shift, const float* x,
+                 float* y) noexcept
+{
+    std::size_t index = 0;
+    const auto s = _mm256_set1_ps(shift);
+    auto sum = _mm256_setzero_ps();
+
+    for (; index + 8 <= length; index += 8)
+    {
+        const auto value = Exp(_mm256_sub_ps(_mm256_loadu_ps(x + index), s));
+
+        _mm256_storeu_ps(y + index, value);
+        sum = _mm256_add_ps(sum, value);
+    }
+
+    // The lanes past the tail are cleared before they are summed.
+    if (index < length)
+    {
+        const auto mask = TailMask(length - index);
+        const auto value = _mm256_and_ps(
+            Exp(_mm256_sub_ps(_mm256_maskload_ps(x + index, mask), s)),
+            _mm256_castsi256_ps(mask));
+
+        _mm256_maskstore_ps(y + index, mask, value);
+        sum = _mm256_add_ps(sum, value);
+    }
+
+    return HorizontalSum(sum);
+}
+}  // namespace
+
+KernelTable KernelRegistry::AVX2KernelTable() noexcept
+{
+    // Every AVX2 CPU shipped so far has F16C, but it is a separate CPUID bit.
+    const auto fp16 =
+        CPUInfo::HasExtension(Extension::F16C)
+            ? HalfKernel<Core::Float16>{ HalfToFloat<Core::Float16>,
+                                         FloatToFloat16, GEMV<Core::Float16> }
+            : ScalarKernelTable().fp16;
+
+    return KernelTable{
+        ISA::AVX2,
+        GEMMKernel{ MR, NR, MicroKernel },
+        GEMMKernel{ MR, NR, MicroKernel },
+        Dot,
+        Axpy,
+        GatherAxpy,
+        GEMV<float>,
+        Int8GEMMKernel{ Int8MR, Int8NR, 64, Int8MicroKernel },
+        HalfKernel<Core::BFloat16>{ HalfToFloat<Core::BFloat16>,
+                                    FloatToBFloat16, GEMV<Core::BFloat16> },
+        fp16,
+        ActivationKernel{ LeakyReLU, LeakyReLUGradient },
+        SoftmaxKernel{ Max, ShiftedExp }
+    };
+}
+}  // namespace CubbyDNN::Compute
+
+#else
+
+namespace CubbyDNN::Compute
+{
+KernelTable KernelRegistry::AVX2KernelTable() noexcept
+{
+    return ScalarKernelTable();
+}
+}  // namespace CubbyDNN::Compute
+
+#endif
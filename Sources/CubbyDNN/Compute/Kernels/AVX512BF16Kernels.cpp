@@ -0,0 +1,67 @@
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#if defined(CUBBYDNN_ARCH_X86)
+
+// GCC 12 flags the self-initialized placeholders inside its own AVX-512
+// headers as (maybe-)uninitialized once they are inlined (GCC bug 105593).
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#include <cstring>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+// vcvtneps2bf16 rounds to nearest even and quiets NaN like
+// Core::BFloat16::FromFloat, but treats subnormal inputs as zero.
+void FloatToBFloat16(std::size_t length, const float* __restrict x,
+                     Core::BFloat16* __restrict y) noexcept
+{
+    std::size_t index = 0;
+
+    for (; index + 16 <= length; index += 16)
+    {
+        const auto converted = _mm512_cvtneps_pbh(_mm512_loadu_ps(x + index));
+        std::memcpy(y + index, &converted, sizeof(converted));
+    }
+
+    if (index < length)
+    {
+        const auto mask = static_cast<__mmask16>((1u << (length - index)) - 1u);
+        const auto converted =
+            _mm512_cvtneps_pbh(_mm512_maskz_loadu_ps(mask, x + index));
+        __m256i bits;
+        std::memcpy(&bits, &converted, sizeof(bits));
+
+        _mm256_mask_storeu_epi16(y + index, mask, bits);
+    }
+}
+}  // namespace
+
+FloatToHalfKernel<Core::BFloat16>
+KernelRegistry::AVX512BF16FromFloat() noexcept
+{
+    return FloatToBFloat16;
+}
+}  // namespace CubbyDNN::Compute
+
+#else
+
+namespace CubbyDNN::Compute
+{
+FloatToHalfKernel<Core::BFloat16>
+KernelRegistry::AVX512BF16FromFloat() noexcept
+{
+    return ScalarKernelTable().bf16.fromFloat;
+}
+}  // namespace CubbyDNN::Compute
+
+#endif
@@ -0,0 +1,749 @@
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#if defined(CUBBYDNN_ARCH_X86)
+
+// GCC 12 flags the self-initialized placeholders inside its own AVX-512
+// headers as (maybe-)uninitialized once they are inlined (GCC bug 105593).
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+// 8 x 32 tile: 16 zmm accumulators, 2 for the b row and 1 broadcast.
+constexpr std::size_t MR = 8;
+constexpr std::size_t NR = 32;
+
+// 16 x 16 tile for narrow products: one zmm of b per k and one accumulator
+// per row, so n = 16 or 48 wastes no lanes.
+constexpr std::size_t NarrowMR = 16;
+constexpr std::size_t NarrowNR = 16;
+
+// 8 x 32 int32 tile, laid out like the float one. One zmm of b holds four k
+// for sixteen columns.
+constexpr std::size_t Int8MR = 8;
+constexpr std::size_t Int8NR = 32;
+
+void MicroKernel(std::size_t kc, const float* __restrict a,
+                 const float* __restrict b, float* c,
+                 std::size_t ldc) noexcept
+{
+    auto c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+    auto c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+    auto c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+    auto c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+    auto c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+    auto c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+    auto c60 = _mm512_setzero_ps(), c61 = _mm512_setzero_ps();
+    auto c70 = _mm512_setzero_ps(), c71 = _mm512_setzero_ps();
+
+    for (std::size_t numK = 0; numK < kc; ++numK)
+    {
+        const auto b0 = _mm512_load_ps(b);
+        const auto b1 = _mm512_load_ps(b + 16);
+
+        auto ai = _mm512_set1_ps(a[0]);
+        c00 = _mm512_fmadd_ps(ai, b0, c00);
+        c01 = _mm512_fmadd_ps(ai, b1, c01);
+
+        ai = _mm512_set1_ps(a[1]);
+        c10 = _mm512_fmadd_ps(ai, b0, c10);
+        c11 = _mm512_fmadd_ps(ai, b1, c11);
+
+        ai = _mm512_set1_ps(a[2]);
+        c20 = _mm512_fmadd_ps(ai, b0, c20);
+        c21 = _mm512_fmadd_ps(ai, b1, c21);
+
+        ai = _mm512_set1_ps(a[3]);
+        c30 = _mm512_fmadd_ps(ai, b0, c30);
+        c31 = _mm512_fmadd_ps(ai, b1, c31);
+
+        ai = _mm512_set1_ps(a[4]);
+        c40 = _mm512_fmadd_ps(ai, b0, c40);
+        c41 = _mm512_fmadd_ps(ai, b1, c41);
+
+        ai = _mm512_set1_ps(a[5]);
+        c50 = _mm512_fmadd_ps(ai, b0, c50);
+        c51 = _mm512_fmadd_ps(ai, b1, c51);
+
+        ai = _mm512_set1_ps(a[6]);
+        c60 = _mm512_fmadd_ps(ai, b0, c60);
+        c61 = _mm512_fmadd_ps(ai, b1, c61);
+
+        ai = _mm512_set1_ps(a[7]);
+        c70 = _mm512_fmadd_ps(ai, b0, c70);
+        c71 = _mm512_fmadd_ps(ai, b1, c71);
+
+        a += MR;
+        b += NR;
+    }
+
+    const auto store = [](float* row, __m512 lo, __m512 hi) {
+        _mm512_storeu_ps(row, _mm512_add_ps(_mm512_loadu_ps(row), lo));
+        _mm512_storeu_ps(row + 16,
+                         _mm512_add_ps(_mm512_loadu_ps(row + 16), hi));
+    };
+
+    store(c, c00, c01);
+    store(c + ldc, c10, c11);
+    store(c + 2 * ldc, c20, c21);
+    store(c + 3 * ldc, c30, c31);
+    store(c + 4 * ldc, c40, c41);
+    store(c + 5 * ldc, c50, c51);
+    store(c + 6 * ldc, c60, c61);
+    store(c + 7 * ldc, c70, c71);
+}
+
+template <std::size_t... Row>
+void NarrowMicroKernel(std::index_sequence<Row...>, std::size_t kc,
+                       const float* __restrict a, const float* __restrict b,
+                       float* c, std::size_t ldc) noexcept
+{
+    __m512 sum[] = { (static_cast<void>(Row), _mm512_setzero_ps())... };
+
+    for (std::size_t numK = 0; numK < kc; ++numK)
+    {
+        const auto bk = _mm512_load_ps(b);
+
+        ((sum[Row] = _mm512_fmadd_ps(_mm512_set1_ps(a[Row]), bk, sum[Row])),
+         ...);
+
+        a += NarrowMR;
+        b += NarrowNR;
+    }
+
+    ((_mm512_storeu_ps(c + Row * ldc,
+                       _mm512_add_ps(_mm512_loadu_ps(c + Row * ldc),
+                                     sum[Row]))),
+     ...);
+}
+
+void NarrowMicroKernel(std::size_t kc, const float* __restrict a,
+                       const float* __restrict b, float* c,
+                       std::size_t ldc) noexcept
+{
+    NarrowMicroKernel(std::make_index_sequence<NarrowMR>(), kc, a, b, c, ldc);
+}
+
+// Four consecutive k of one row of a, broadcast to every 32-bit lane.
+__m512i BroadcastGroup(const std::uint8_t* a) noexcept
+{
+    std::int32_t group;
+    std::memcpy(&group, a, sizeof(group));
+
+    return _mm512_set1_epi32(group);
+}
+
+// vpmaddubsw forms u8 x s8 pair sums in 16 bits, vpmaddwd by one widens and
+// adds the pairs into the four-k dot product per 32-bit lane.
+__m512i DotGroup(__m512i a, __m512i b, __m512i ones) noexcept
+{
+    return _mm512_madd_epi16(_mm512_maddubs_epi16(a, b), ones);
+}
+
+void Int8MicroKernel(std::size_t kc, const std::uint8_t* __restrict a,
+                     const std::int8_t* __restrict b, std::int32_t* c,
+                     std::size_t ldc) noexcept
+{
+    const auto ones = _mm512_set1_epi16(1);
+
+    auto c00 = _mm512_setzero_si512(), c01 = _mm512_setzero_si512();
+    auto c10 = _mm512_setzero_si512(), c11 = _mm512_setzero_si512();
+    auto c20 = _mm512_setzero_si512(), c21 = _mm512_setzero_si512();
+    auto c30 = _mm512_setzero_si512(), c31 = _mm512_setzero_si512();
+    auto c40 = _mm512_setzero_si512(), c41 = _mm512_setzero_si512();
+    auto c50 = _mm512_setzero_si512(), c51 = _mm512_setzero_si512();
+    auto c60 = _mm512_setzero_si512(), c61 = _mm512_setzero_si512();
+    auto c70 = _mm512_setzero_si512(), c71 = _mm512_setzero_si512();
+
+    for (std::size_t numK = 0; numK < kc; numK += 4)
+    {
+        const auto b0 = _mm512_load_si512(b);
+        const auto b1 = _mm512_load_si512(b + 64);
+
+        auto ai = BroadcastGroup(a);
+        c00 = _mm512_add_epi32(c00, DotGroup(ai, b0, ones));
+        c01 = _mm512_add_epi32(c01, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 4);
+        c10 = _mm512_add_epi32(c10, DotGroup(ai, b0, ones));
+        c11 = _mm512_add_epi32(c11, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 8);
+        c20 = _mm512_add_epi32(c20, DotGroup(ai, b0, ones));
+        c21 = _mm512_add_epi32(c21, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 12);
+        c30 = _mm512_add_epi32(c30, DotGroup(ai, b0, ones));
+        c31 = _mm512_add_epi32(c31, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 16);
+        c40 = _mm512_add_epi32(c40, DotGroup(ai, b0, ones));
+        c41 = _mm512_add_epi32(c41, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 20);
+        c50 = _mm512_add_epi32(c50, DotGroup(ai, b0, ones));
+        c51 = _mm512_add_epi32(c51, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 24);
+        c60 = _mm512_add_epi32(c60, DotGroup(ai, b0, ones));
+        c61 = _mm512_add_epi32(c61, DotGroup(ai, b1, ones));
+
+        ai = BroadcastGroup(a + 28);
+        c70 = _mm512_add_epi32(c70, DotGroup(ai, b0, ones));
+        c71 = _mm512_add_epi32(c71, DotGroup(ai, b1, ones));
+
+        a += Int8MR * 4;
+        b += Int8NR * 4;
+    }
+
+    const auto store = [](std::int32_t* row, __m512i lo, __m512i hi) {
+        _mm512_storeu_si512(row,
+                            _mm512_add_epi32(_mm512_loadu_si512(row), lo));
+        _mm512_storeu_si512(
+            row + 16, _mm512_add_epi32(_mm512_loadu_si512(row + 16), hi));
+    };
+
+    store(c, c00, c01);
+    store(c + ldc, c10, c11);
+    store(c + 2 * ldc, c20, c21);
+    store(c + 3 * ldc, c30, c31);
+    store(c + 4 * ldc, c40, c41);
+    store(c + 5 * ldc, c50, c51);
+    store(c + 6 * ldc, c60, c61);
+    store(c + 7 * ldc, c70, c71);
+}
+
+float Dot(std::size_t length, const float* __restrict x,
+          const float* __restrict y) noexcept
+{
+    std::size_t index = 0;
+    auto sum = _mm512_setzero_ps();
+
+    for (; index + 16 <= length; index += 16)
+    {
+        sum = _mm512_fmadd_ps(_mm512_loadu_ps(x + index),
+                              _mm512_loadu_ps(y + index), sum);
+    }
+
+    if (index < length)
+    {
+        const auto mask =
+            static_cast<__mmask16>((1u << (length - index)) - 1u);
+
+        sum = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, x + index),
+                              _mm512_maskz_loadu_ps(mask, y + index), sum);
+    }
+
+    return _mm512_reduce_add_ps(sum);
+}
+
+void Axpy(std::size_t length, float alpha, const float* __restrict x,
+          float* __restrict y) noexcept
+{
+    std::size_t index = 0;
+    const auto a = _mm512_set1_ps(alpha);
+
+    for (; index + 16 <= length; index += 16)
+    {
+        _mm512_storeu_ps(y + index,
+                         _mm512_fmadd_ps(a, _mm512_loadu_ps(x + index),
+                                         _mm512_loadu_ps(y + index)));
+    }
+
+    if (index < length)
+    {
+        const auto mask =
+            static_cast<__mmask16>((1u << (length - index)) - 1u);
+
+        _mm512_mask_storeu_ps(
+            y + index, mask,
+            _mm512_fmadd_ps(a, _mm512_maskz_loadu_ps(mask, x + index),
+                            _mm512_maskz_loadu_ps(mask, y + index)));
+    }
+}
+
+// sizeof...(Vector) zmm of y, kept in registers across all count terms.
+template <std::size_t... Vector>
+void GatherAxpyChunk(std::index_sequence<Vector...>, std::size_t count,
+                     const float* __restrict alpha, std::size_t alphaStride,
+                     const std::uint32_t* __restrict index,
+                     const float* __restrict x, std::size_t ldx,
+                     float* __restrict y) noexcept
+{
+    __m512 sum[] = { _mm512_loadu_ps(y + Vector * 16)... };
+
+    for (std::size_t numK = 0; numK < count; ++numK)
+    {
+        const auto a = _mm512_set1_ps(alpha[numK * alphaStride]);
+        const float* xk = x + index[numK] * ldx;
+
+        ((sum[Vector] =
+              _mm512_fmadd_ps(a, _mm512_loadu_ps(xk + Vector * 16),
+                              sum[Vector])),
+         ...);
+    }
+
+    (_mm512_storeu_ps(y + Vector * 16, sum[Vector]), ...);
+}
+
+void GatherAxpy(std::size_t count, const float* __restrict alpha,
+                std::size_t alphaStride, const std::uint32_t* __restrict index,
+                const float* __restrict x, std::size_t ldx, std::size_t length,
+                float* __restrict y) noexcept
+{
+    std::size_t offset = 0;
+
+    for (; offset + 64 <= length; offset += 64)
+    {
+        GatherAxpyChunk(std::make_index_sequence<4>(), count, alpha,
+                        alphaStride, index, x + offset, ldx, y + offset);
+    }
+
+    for (; offset + 16 <= length; offset += 16)
+    {
+        GatherAxpyChunk(std::make_index_sequence<1>(), count, alpha,
+                        alphaStride, index, x + offset, ldx, y + offset);
+    }
+
+    if (offset < length)
+    {
+        const auto mask =
+            static_cast<__mmask16>((1u << (length - offset)) - 1u);
+        auto sum = _mm512_maskz_loadu_ps(mask, y + offset);
+
+        for (std::size_t numK = 0; numK < count; ++numK)
+        {
+            sum = _mm512_fmadd_ps(
+                _mm512_set1_ps(alpha[numK * alphaStride]),
+                _mm512_maskz_loadu_ps(mask, x + index[numK] * ldx + offset),
+                sum);
+        }
+
+        _mm512_mask_storeu_ps(y + offset, mask, sum);
+    }
+}
+
+// Sixteen consecutive elements of a weight row widened to fp32; the masked
+// overloads zero the lanes outside mask.
+__m512 LoadWeight(const float* w) noexcept
+{
+    return _mm512_loadu_ps(w);
+}
+
+__m512 LoadWeight(__mmask16 mask, const float* w) noexcept
+{
+    return _mm512_maskz_loadu_ps(mask, w);
+}
+
+__m512 WidenBFloat16(__m256i bits) noexcept
+{
+    return _mm512_castsi512_ps(
+        _mm512_slli_epi32(_mm512_cvtepu16_epi32(bits), 16));
+}
+
+__m512 LoadWeight(const Core::BFloat16* w) noexcept
+{
+    return WidenBFloat16(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w)));
+}
+
+__m512 LoadWeight(__mmask16 mask, const Core::BFloat16* w) noexcept
+{
+    return WidenBFloat16(_mm256_maskz_loadu_epi16(mask, w));
+}
+
+__m512 LoadWeight(const Core::Float16* w) noexcept
+{
+    return _mm512_cvtph_ps(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w)));
+}
+
+__m512 LoadWeight(__mmask16 mask, const Core::Float16* w) noexcept
+{
+    return _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, w));
+}
+
+// NumW rows of w against NumB batch vectors with one accumulator per pair
+// (Index = numW * NumB + numB): every w element loaded feeds NumB fmas, and
+// the independent chains hide the fma latency. The pack expansion unrolls
+// the pairs at compile time so the accumulators stay in registers. The tail
+// is a masked iteration, so no scalar cleanup is needed.
+template <std::size_t NumB, std::size_t NumW, typename T,
+          std::size_t... Index>
+void GEMVBlock(std::index_sequence<Index...>, std::size_t length,
+               const float* __restrict x, const T* __restrict w, float* y,
+               std::size_t ldy) noexcept
+{
+    __m512 sum[] = { (static_cast<void>(Index), _mm512_setzero_ps())... };
+
+    std::size_t index = 0;
+
+    for (; index + 16 <= length; index += 16)
+    {
+        ((sum[Index] = _mm512_fmadd_ps(
+              LoadWeight(w + Index / NumB * length + index),
+              _mm512_loadu_ps(x + Index % NumB * length + index),
+              sum[Index])),
+         ...);
+    }
+
+    if (index < length)
+    {
+        const auto mask =
+            static_cast<__mmask16>((1u << (length - index)) - 1u);
+
+        ((sum[Index] = _mm512_fmadd_ps(
+              LoadWeight(mask, w + Index / NumB * length + index),
+              _mm512_maskz_loadu_ps(mask, x + Index % NumB * length + index),
+              sum[Index])),
+         ...);
+    }
+
+    ((y[Index % NumB * ldy + Index / NumB] +=
+      _mm512_reduce_add_ps(sum[Index])),
+     ...);
+}
+
+template <std::size_t NumB, typename T>
+void GEMVBatch(std::size_t numRow, std::size_t length, const float* x,
+               const T* w, float* y, std::size_t ldy) noexcept
+{
+    // Keep NumW * NumB accumulators within half the register file, and
+    // read at most 8 rows of w at once to bound the number of streams.
+    constexpr std::size_t NumW = NumB >= 2 ? 16 / NumB : 8;
+
+    std::size_t numR = 0;
+
+    for (; numR + NumW <= numRow; numR += NumW)
+    {
+        GEMVBlock<NumB, NumW>(std::make_index_sequence<NumW * NumB>(),
+                              length, x, w + numR * length, y + numR, ldy);
+    }
+
+    for (; numR < numRow; ++numR)
+    {
+        GEMVBlock<NumB, 1>(std::make_index_sequence<NumB>(), length, x,
+                           w + numR * length, y + numR, ldy);
+    }
+}
+
+template <typename T>
+void GEMV(std::size_t numBatch, std::size_t numRow, std::size_t length,
+          const float* x, const T* w, float* y, std::size_t ldy) noexcept
+{
+    switch (numBatch)
+    {
+        case 1:
+            GEMVBatch<1>(numRow, length, x, w, y, ldy);
+            break;
+        case 2:
+            GEMVBatch<2>(numRow, length, x, w, y, ldy);
+            break;
+        case 3:
+            GEMVBatch<3>(numRow, length, x, w, y, ldy);
+            break;
+        case 4:
+            GEMVBatch<4>(numRow, length, x, w, y, ldy);
+            break;
+        case 5:
+            GEMVBatch<5>(numRow, length, x, w, y, ldy);
+            break;
+        case 6:
+            GEMVBatch<6>(numRow, length, x, w, y, ldy);
+            break;
+        case 7:
+            GEMVBatch<7>(numRow, length, x, w, y, ldy);
+            break;
+        case 8:
+            GEMVBatch<8>(numRow, length, x, w, y, ldy);
+            break;
+        default:
+            break;
+    }
+}
+
+template <typename T>
+void HalfToFloat(std::size_t length, const T* __restrict x,
+                 float* __restrict y) noexcept
+{
+    std::size_t index = 0;
+
+    for (; index + 16 <= length; index += 16)
+    {
+        _mm512_storeu_ps(y + index, LoadWeight(x + index));
+    }
+
+    if (index < length)
+    {
+        const auto mask = static_cast<__mmask16>((1u << (length - index)) - 1u);
+
+        _mm512_mask_storeu_ps(y + index, mask, LoadWeight(mask, x + index));
+    }
+}
+
+// Same rounding and NaN handling as Core::BFloat16::FromFloat.
+__m256i RoundToBFloat16(__m512 value) noexcept
+{
+    const auto bits = _mm512_castps_si512(value);
+    const auto isOdd =
+        _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+    auto rounded = _mm512_add_epi32(
+        bits, _mm512_add_epi32(isOdd, _mm512_set1_epi32(0x7FFF)));
+    const auto isNaN = _mm512_cmp_ps_mask(value, value, _CMP_UNORD_Q);
+
+    rounded = _mm512_mask_or_epi32(rounded, isNaN, bits,
+                                   _mm512_set1_epi32(0x400000));
+
+    return _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16));
+}
+
+void FloatToBFloat16(std::size_t length, const float* __restrict x,
+                     Core::BFloat16* __restrict y) noexcept
+{
+    std::size_t index = 0;
+
+    for (; index + 16 <= length; index += 16)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + index),
+                            RoundToBFloat16(_mm512_loadu_ps(x + index)));
+    }
+
+    if (index < length)
+    {
+        const auto mask = static_cast<__mmask16>((1u << (length - index)) - 1u);
+
+        _mm256_mask_storeu_epi16(
+            y + index, mask,
+            RoundToBFloat16(_mm512_maskz_loadu_ps(mask, x + index)));
+    }
+}
+
+void FloatToFloat16(std::size_t length, const float* __restrict x,
+                    Core::Float16* __restrict y) noexcept
+{
+    std::size_t index = 0;
+
+    for (; index + 16 <= length; index += 16)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + index),
+                            _mm512_cvtps_ph(_mm512_loadu_ps(x + index),
+                                            _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    if (index < length)
+    {
+        const auto mask = static_cast<__mmask16>((1u << (length - index)) - 1u);
+
+        _mm256_mask_storeu_epi16(
+            y + index, mask,
+            _mm512_cvtps_ph(_mm512_maskz_loadu_ps(mask, x + index),
+                            _MM_FROUND_TO_NEAREST_INT));
+    }
+}
+
+// Up to 16 values under mask; the negative ones are multiplied by alpha in
+// place of a blend.
+void LeakyReLUVector(__mmask16 mask, __m512 a, const float* x,
+                     float* y) noexcept
+{
+    const auto value = _mm512_maskz_loadu_ps(mask, x);
+    const auto negative =
+        _mm512_cmp_ps_mask(value, _mm512_setzero_ps(), _CMP_LT_OQ);
+
+    _mm512_mask_storeu_ps(y, mask,
+                          _mm512_mask_mul_ps(value, negative, a, value));
+}
+
+void LeakyReLU(std::size_t length, float alpha, const float* x,
+               float* y) noexcept
+{
+    std::size_t index = 0;
+    const auto a = _mm512_set1_ps(alpha);
+
+    for (; index + 16 <= length; index += 16)
+    {
+        LeakyReLUVector(0xFFFF, a, x + index, y + index);
+    }
+
+    if (index < length)
+    {
+        LeakyReLUVector(static_cast<__mmask16>((1u << (length - index)) - 1u),
+                        a, x + index, y + index);
+    }
+}
+
+void LeakyReLUGradientVector(__mmask16 mask, __m512 a, const float* x,
+                             const float* dy, float* dx, bool isAdd) noexcept
+{
+    const auto gradient = _mm512_maskz_loadu_ps(mask, dy);
+    const auto nonPositive = _mm512_cmp_ps_mask(
+        _mm512_maskz_loadu_ps(mask, x), _mm512_setzero_ps(), _CMP_LE_OQ);
+    auto result = _mm512_mask_mul_ps(gradient, nonPositive, a, gradient);
+
+    if (isAdd)
+    {
+        result = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, dx), result);
+    }
+
+    _mm512_mask_storeu_ps(dx, mask, result);
+}
+
+void LeakyReLUGradient(std::size_t length, float alpha, const float* x,
+                       const float* dy, float* dx, bool isAdd) noexcept
+{
+    std::size_t index = 0;
+    const auto a = _mm512_set1_ps(alpha);
+
+    for (; index + 16 <= length; index += 16)
+    {
+        LeakyReLUGradientVector(0xFFFF, a, x + index, dy + index, dx + index,
+                                isAdd);
+    }
+
+    if (index < length)
+    {
+        LeakyReLUGradientVector(
+            static_cast<__mmask16>((1u << (length - index)) - 1u), a,
+            x + index, dy + index, dx + index, isAdd);
+    }
+}
+
+float Max(std::size_t length, const float* x) noexcept
+{
+    std::size_t index = 0;
+    const auto lowest =
+        _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+    auto result = lowest;
+
+    for (; index + 16 <= length; index += 16)
+    {
+        result = _mm512_max_ps(result, _mm512_loadu_ps(x + index));
+    }
+
+    if (index < length)
+    {
+        result = _mm512_max_ps(
+            result, _mm512_mask_loadu_ps(
+                        lowest,
+                        static_cast<__mmask16>((1u << (length - index)) - 1u),
+                        x + index));
+    }
+
+    return _mm512_reduce_max_ps(result);
+}
+
+// exp(x) after Cephes' expf: 2^n * p(r), with n = round(x / ln 2), r = x -
+// n ln 2 in two parts and p a degree 7 polynomial. vscalefps applies 2^n.
+// Values that would turn subnormal are flushed to zero, as the narrower
+// kernels have them. The bounds come first in the clamps, so that a NaN in
+// x passes through.
+__m512 Exp(__m512 x) noexcept
+{
+    const auto lowest = _mm512_set1_ps(-87.33f);
+    const auto underflow = _mm512_cmp_ps_mask(x, lowest, _CMP_LT_OQ);
+
+    x = _mm512_min_ps(_mm512_set1_ps(88.0f), _mm512_max_ps(lowest, x));
+
+    const auto n = _mm512_roundscale_ps(
+        _mm512_mul_ps(x, _mm512_set1_ps(1.44269504f)),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const auto r = _mm512_fnmadd_ps(
+        n, _mm512_set1_ps(-2.12194440e-4f),
+        _mm512_fnmadd_ps(n, _mm512_set1_ps(0.693359375f), x));
+
+    auto p = _mm512_set1_ps(1.9875691500e-4f);
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(1.3981999507e-3f));
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(8.3334519073e-3f));
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(4.1665795894e-2f));
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(1.6666665459e-1f));
+    p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(5.0000001201e-1f));
+    p = _mm512_add_ps(_mm512_fmadd_ps(p, _mm512_mul_ps(r, r), r),
+                      _mm512_set1_ps(1.0f));
+
+    return _mm512_maskz_mov_ps(static_cast<__mmask16>(~underflow),
+                               _mm512_scalef_ps(p, n));
+}
+
+// The lanes past the tail are zeroed, so that they add nothing to the sum.
+float ShiftedExp(std::size_t length, float shift, const float* x,
+                 float* y) noexcept
+{
+    std::size_t index = 0;
+    const auto s = _mm512_set1_ps(shift);
+    auto sum = _mm512_setzero_ps();
+
+    for (; index + 16 <= length; index += 16)
+    {
+        const auto value = Exp(_mm512_sub_ps(_mm512_loadu_ps(x + index), s));
+
+        _mm512_storeu_ps(y + index, value);
+        sum = _mm512_add_ps(sum, value);
+    }
+
+    if (index < length)
+    {
+        const auto mask =
+            static_cast<__mmask16>((1u << (length - index)) - 1u);
+        const auto value = _mm512_maskz_mov_ps(
+            mask,
+            Exp(_mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + index), s)));
+
+        _mm512_mask_storeu_ps(y + index, mask, value);
+        sum = _mm512_add_ps(sum, value);
+    }
+
+    return _mm512_reduce_add_ps(sum);
+}
+}  // namespace
+
+KernelTable KernelRegistry::AVX512KernelTable() noexcept
+{
+    return KernelTable{
+        ISA::AVX512,
+        GEMMKernel{ MR, NR, MicroKernel },
+        GEMMKernel{ NarrowMR, NarrowNR, NarrowMicroKernel },
+        Dot,
+        Axpy,
+        GatherAxpy,
+        GEMV<float>,
+        CPUInfo::HasExtension(Extension::AVX512VNNI)
+            ? AVX512VNNIInt8Kernel()
+            : Int8GEMMKernel{ Int8MR, Int8NR, 64, Int8MicroKernel },
+        HalfKernel<Core::BFloat16>{
+            HalfToFloat<Core::BFloat16>,
+            CPUInfo::HasExtension(Extension::AVX512BF16)
+                ? AVX512BF16FromFloat()
+                : FloatToBFloat16,
+            GEMV<Core::BFloat16> },
+        HalfKernel<Core::Float16>{ HalfToFloat<Core::Float16>, FloatToFloat16,
+                                   GEMV<Core::Float16> },
+        ActivationKernel{ LeakyReLU, LeakyReLUGradient },
+        SoftmaxKernel{ Max, ShiftedExp }
+    };
+}
+}  // namespace CubbyDNN::Compute
+
+#else
+
+namespace CubbyDNN::Compute
+{
+KernelTable KernelRegistry::AVX512KernelTable() noexcept
+{
+    return ScalarKernelTable();
+}
+}  // namespace CubbyDNN::Compute
+
+#endif
@@ -0,0 +1,126 @@
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#if defined(CUBBYDNN_ARCH_X86)
+
+// GCC 12 flags the self-initialized placeholders inside its own AVX-512
+// headers as (maybe-)uninitialized once they are inlined (GCC bug 105593).
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#include <cstring>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+// Same 8 x 32 tile and packing as the AVX-512BW kernel, but vpdpbusd
+// accumulates the four-k dot products straight into 32 bits, so nothing
+// saturates and the full s8 weight range is exact.
+constexpr std::size_t Int8MR = 8;
+constexpr std::size_t Int8NR = 32;
+
+// Four consecutive k of one row of a, broadcast to every 32-bit lane.
+__m512i BroadcastGroup(const std::uint8_t* a) noexcept
+{
+    std::int32_t group;
+    std::memcpy(&group, a, sizeof(group));
+
+    return _mm512_set1_epi32(group);
+}
+
+void Int8MicroKernel(std::size_t kc, const std::uint8_t* __restrict a,
+                     const std::int8_t* __restrict b, std::int32_t* c,
+                     std::size_t ldc) noexcept
+{
+    auto c00 = _mm512_setzero_si512(), c01 = _mm512_setzero_si512();
+    auto c10 = _mm512_setzero_si512(), c11 = _mm512_setzero_si512();
+    auto c20 = _mm512_setzero_si512(), c21 = _mm512_setzero_si512();
+    auto c30 = _mm512_setzero_si512(), c31 = _mm512_setzero_si512();
+    auto c40 = _mm512_setzero_si512(), c41 = _mm512_setzero_si512();
+    auto c50 = _mm512_setzero_si512(), c51 = _mm512_setzero_si512();
+    auto c60 = _mm512_setzero_si512(), c61 = _mm512_setzero_si512();
+    auto c70 = _mm512_setzero_si512(), c71 = _mm512_setzero_si512();
+
+    for (std::size_t numK = 0; numK < kc; numK += 4)
+    {
+        const auto b0 = _mm512_load_si512(b);
+        const auto b1 = _mm512_load_si512(b + 64);
+
+        auto ai = BroadcastGroup(a);
+        c00 = _mm512_dpbusd_epi32(c00, ai, b0);
+        c01 = _mm512_dpbusd_epi32(c01, ai, b1);
+
+        ai = BroadcastGroup(a + 4);
+        c10 = _mm512_dpbusd_epi32(c10, ai, b0);
+        c11 = _mm512_dpbusd_epi32(c11, ai, b1);
+
+        ai = BroadcastGroup(a + 8);
+        c20 = _mm512_dpbusd_epi32(c20, ai, b0);
+        c21 = _mm512_dpbusd_epi32(c21, ai, b1);
+
+        ai = BroadcastGroup(a + 12);
+        c30 = _mm512_dpbusd_epi32(c30, ai, b0);
+        c31 = _mm512_dpbusd_epi32(c31, ai, b1);
+
+        ai = BroadcastGroup(a + 16);
+        c40 = _mm512_dpbusd_epi32(c40, ai, b0);
+        c41 = _mm512_dpbusd_epi32(c41, ai, b1);
+
+        ai = BroadcastGroup(a + 20);
+        c50 = _mm512_dpbusd_epi32(c50, ai, b0);
+        c51 = _mm512_dpbusd_epi32(c51, ai, b1);
+
+        ai = BroadcastGroup(a + 24);
+        c60 = _mm512_dpbusd_epi32(c60, ai, b0);
+        c61 = _mm512_dpbusd_epi32(c61, ai, b1);
+
+        ai = BroadcastGroup(a + 28);
+        c70 = _mm512_dpbusd_epi32(c70, ai, b0);
+        c71 = _mm512_dpbusd_epi32(c71, ai, b1);
+
+        a += Int8MR * 4;
+        b += Int8NR * 4;
+    }
+
+    const auto store = [](std::int32_t* row, __m512i lo, __m512i hi) {
+        _mm512_storeu_si512(row,
+                            _mm512_add_epi32(_mm512_loadu_si512(row), lo));
+        _mm512_storeu_si512(
+            row + 16, _mm512_add_epi32(_mm512_loadu_si512(row + 16), hi));
+    };
+
+    store(c, c00, c01);
+    store(c + ldc, c10, c11);
+    store(c + 2 * ldc, c20, c21);
+    store(c + 3 * ldc, c30, c31);
+    store(c + 4 * ldc, c40, c41);
+    store(c + 5 * ldc, c50, c51);
+    store(c + 6 * ldc, c60, c61);
+    store(c + 7 * ldc, c70, c71);
+}
+}  // namespace
+
+Int8GEMMKernel KernelRegistry::AVX512VNNIInt8Kernel() noexcept
+{
+    return Int8GEMMKernel{ Int8MR, Int8NR, 127, Int8MicroKernel };
+}
+}  // namespace CubbyDNN::Compute
+
+#else
+
+namespace CubbyDNN::Compute
+{
+Int8GEMMKernel KernelRegistry::AVX512VNNIInt8Kernel() noexcept
+{
+    return ScalarKernelTable().int8Gemm;
+}
+}  // namespace CubbyDNN::Compute
+
+#endif
@@ -0,0 +1,455 @@
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#if defined(CUBBYDNN_ARCH_X86)
+
+#include <algorithm>
+#include <limits>
+#include <nmmintrin.h>
+#include <utility>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+constexpr std::size_t MR = 6;
+constexpr std::size_t NR = 8;
+
+// SSE4.2 has no FMA, so every update is a separate multiply and add.
+void MicroKernel(std::size_t kc, const float* __restrict a,
+                 const float* __restrict b, float* c,
+                 std::size_t ldc) noexcept
+{
+    auto c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps();
+    auto c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+    auto c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps();
+    auto c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+    auto c40 = _mm_setzero_ps(), c41 = _mm_setzero_ps();
+    auto c50 = _mm_setzero_ps(), c51 = _mm_setzero_ps();
+
+    for (std::size_t numK = 0; numK < kc; ++numK)
+    {
+        const auto b0 = _mm_load_ps(b);
+        const auto b1 = _mm_load_ps(b + 4);
+
+        auto ai = _mm_load1_ps(a);
+        c00 = _mm_add_ps(c00, _mm_mul_ps(ai, b0));
+        c01 = _mm_add_ps(c01, _mm_mul_ps(ai, b1));
+
+        ai = _mm_load1_ps(a + 1);
+        c10 = _mm_add_ps(c10, _mm_mul_ps(ai, b0));
+        c11 = _mm_add_ps(c11, _mm_mul_ps(ai, b1));
+
+        ai = _mm_load1_ps(a + 2);
+        c20 = _mm_add_ps(c20, _mm_mul_ps(ai, b0));
+        c21 = _mm_add_ps(c21, _mm_mul_ps(ai, b1));
+
+        ai = _mm_load1_ps(a + 3);
+        c30 = _mm_add_ps(c30, _mm_mul_ps(ai, b0));
+        c31 = _mm_add_ps(c31, _mm_mul_ps(ai, b1));
+
+        ai = _mm_load1_ps(a + 4);
+        c40 = _mm_add_ps(c40, _mm_mul_ps(ai, b0));
+        c41 = _mm_add_ps(c41, _mm_mul_ps(ai, b1));
+
+        ai = _mm_load1_ps(a + 5);
+        c50 = _mm_add_ps(c50, _mm_mul_ps(ai, b0));
+        c51 = _mm_add_ps(c51, _mm_mul_ps(ai, b1));
+
+        a += MR;
+        b += NR;
+    }
+
+    const auto store = [](float* row, __m128 lo, __m128 hi) {
+        _mm_storeu_ps(row, _mm_add_ps(_mm_loadu_ps(row), lo));
+        _mm_storeu_ps(row + 4, _mm_add_ps(_mm_loadu_ps(row + 4), hi));
+    };
+
+    store(c, c00, c01);
+    store(c + ldc, c10, c11);
+    store(c + 2 * ldc, c20, c21);
+    store(c + 3 * ldc, c30, c31);
+    store(c + 4 * ldc, c40, c41);
+    store(c + 5 * ldc, c50, c51);
+}
+
+float HorizontalSum(__m128 sum) noexcept
+{
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+
+    return _mm_cvtss_f32(sum);
+}
+
+float Dot(std::size_t length, const float* __restrict x,
+          const float* __restrict y) noexcept
+{
+    std::size_t index = 0;
+    auto sum0 = _mm_setzero_ps();
+    auto sum1 = _mm_setzero_ps();
+
+    for (; index + 8 <= length; index += 8)
+    {
+        sum0 = _mm_add_ps(
+            sum0, _mm_mul_ps(_mm_loadu_ps(x + index), _mm_loadu_ps(y + index)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(x + index + 4),
+                                           _mm_loadu_ps(y + index + 4)));
+    }
+
+    auto result = HorizontalSum(_mm_add_ps(sum0, sum1));
+
+    for (; index < length; ++index)
+    {
+        result += x[index] * y[index];
+    }
+
+    return result;
+}
+
+void Axpy(std::size_t length, float alpha, const float* __restrict x,
+          float* __restrict y) noexcept
+{
+    std::size_t index = 0;
+    const auto a = _mm_set1_ps(alpha);
+
+    for (; index + 4 <= length; index += 4)
+    {
+        _mm_storeu_ps(y + index,
+                      _mm_add_ps(_mm_loadu_ps(y + index),
+                                 _mm_mul_ps(a, _mm_loadu_ps(x + index))));
+    }
+
+    for (; index < length; ++index)
+    {
+        y[index] += alpha * x[index];
+    }
+}
+
+// sizeof...(Vector) xmm of y, kept in registers across all count terms.
+template <std::size_t... Vector>
+void GatherAxpyChunk(std::index_sequence<Vector...>, std::size_t count,
+                     const float* __restrict alpha, std::size_t alphaStride,
+                     const std::uint32_t* __restrict index,
+                     const float* __restrict x, std::size_t ldx,
+                     float* __restrict y) noexcept
+{
+    __m128 sum[] = { _mm_loadu_ps(y + Vector * 4)... };
+
+    for (std::size_t numK = 0; numK < count; ++numK)
+    {
+        const auto a = _mm_set1_ps(alpha[numK * alphaStride]);
+        const float* xk = x + index[numK] * ldx;
+
+        ((sum[Vector] = _mm_add_ps(
+              sum[Vector], _mm_mul_ps(a, _mm_loadu_ps(xk + Vector * 4)))),
+         ...);
+    }
+
+    (_mm_storeu_ps(y + Vector * 4, sum[Vector]), ...);
+}
+
+void GatherAxpy(std::size_t count, const float* __restrict alpha,
+                std::size_t alphaStride, const std::uint32_t* __restrict index,
+                const float* __restrict x, std::size_t ldx, std::size_t length,
+                float* __restrict y) noexcept
+{
+    std::size_t offset = 0;
+
+    for (; offset + 16 <= length; offset += 16)
+    {
+        GatherAxpyChunk(std::make_index_sequence<4>(), count, alpha,
+                        alphaStride, index, x + offset, ldx, y + offset);
+    }
+
+    for (; offset + 4 <= length; offset += 4)
+    {
+        GatherAxpyChunk(std::make_index_sequence<1>(), count, alpha,
+                        alphaStride, index, x + offset, ldx, y + offset);
+    }
+
+    for (; offset < length; ++offset)
+    {
+        float sum = y[offset];
+
+        for (std::size_t numK = 0; numK < count; ++numK)
+        {
+            sum += alpha[numK * alphaStride] * x[index[numK] * ldx + offset];
+        }
+
+        y[offset] = sum;
+    }
+}
+
+// NumW rows of w against NumB batch vectors with one accumulator per pair
+// (Index = numW * NumB + numB): every w element loaded feeds NumB
+// multiply-adds, and the independent chains hide the add latency. The pack
+// expansion unrolls the pairs at compile time so the accumulators stay in
+// registers.
+template <std::size_t NumB, std::size_t NumW, std::size_t... Index>
+void GEMVBlock(std::index_sequence<Index...>, std::size_t length,
+               const float* __restrict x, const float* __restrict w, float* y,
+               std::size_t ldy) noexcept
+{
+    __m128 sum[] = { (static_cast<void>(Index), _mm_setzero_ps())... };
+
+    std::size_t index = 0;
+
+    for (; index + 4 <= length; index += 4)
+    {
+        ((sum[Index] = _mm_add_ps(
+              sum[Index],
+              _mm_mul_ps(_mm_loadu_ps(w + Index / NumB * length + index),
+                         _mm_loadu_ps(x + Index % NumB * length + index)))),
+         ...);
+    }
+
+    const auto reduce = [&](std::size_t pair, __m128 partial) {
+        const auto* row = w + pair / NumB * length;
+        const auto* vector = x + pair % NumB * length;
+        auto result = HorizontalSum(partial);
+
+        for (std::size_t tail = index; tail < length; ++tail)
+        {
+            result += row[tail] * vector[tail];
+        }
+
+        y[pair % NumB * ldy + pair / NumB] += result;
+    };
+
+    (reduce(Index, sum[Index]), ...);
+}
+
+template <std::size_t NumB>
+void GEMVBatch(std::size_t numRow, std::size_t length, const float* x,
+               const float* w, float* y, std::size_t ldy) noexcept
+{
+    // Keep NumW * NumB accumulators within half the register file.
+    constexpr std::size_t NumW = NumB >= 8 ? 1 : 8 / NumB;
+
+    std::size_t numR = 0;
+
+    for (; numR + NumW <= numRow; numR += NumW)
+    {
+        GEMVBlock<NumB, NumW>(std::make_index_sequence<NumW * NumB>(),
+                              length, x, w + numR * length, y + numR, ldy);
+    }
+
+    for (; numR < numRow; ++numR)
+    {
+        GEMVBlock<NumB, 1>(std::make_index_sequence<NumB>(), length, x,
+                           w + numR * length, y + numR, ldy);
+    }
+}
+
+void GEMV(std::size_t numBatch, std::size_t numRow, std::size_t length,
+          const float* x, const float* w, float* y, std::size_t ldy) noexcept
+{
+    switch (numBatch)
+    {
+        case 1:
+            GEMVBatch<1>(numRow, length, x, w, y, ldy);
+            break;
+        case 2:
+            GEMVBatch<2>(numRow, length, x, w, y, ldy);
+            break;
+        case 3:
+            GEMVBatch<3>(numRow, length, x, w, y, ldy);
+            break;
+        case 4:
+            GEMVBatch<4>(numRow, length, x, w, y, ldy);
+            break;
+        case 5:
+            GEMVBatch<5>(numRow, length, x, w, y, ldy);
+            break;
+        case 6:
+            GEMVBatch<6>(numRow, length, x, w, y, ldy);
+            break;
+        case 7:
+            GEMVBatch<7>(numRow, length, x, w, y, ldy);
+            break;
+        case 8:
+            GEMVBatch<8>(numRow, length, x, w, y, ldy);
+            break;
+        default:
+            break;
+    }
+}
+
+// The sign is taken from a comparison rather than the sign bit, so that -0
+// passes through as x < 0 would have it.
+void LeakyReLU(std::size_t length, float alpha, const float* x,
+               float* y) noexcept
+{
+    std::size_t index = 0;
+    const auto a = _mm_set1_ps(alpha);
+    const auto zero = _mm_setzero_ps();
+
+    for (; index + 4 <= length; index += 4)
+    {
+        const auto value = _mm_loadu_ps(x + index);
+
+        _mm_storeu_ps(y + index,
+                      _mm_blendv_ps(value, _mm_mul_ps(a, value),
+                                    _mm_cmplt_ps(value, zero)));
+    }
+
+    for (; index < length; ++index)
+    {
+        y[index] = x[index] < 0.0f ? alpha * x[index] : x[index];
+    }
+}
+
+void LeakyReLUGradient(std::size_t length, float alpha, const float* x,
+                       const float* dy, float* dx, bool isAdd) noexcept
+{
+    std::size_t index = 0;
+    const auto a = _mm_set1_ps(alpha);
+    const auto zero = _mm_setzero_ps();
+
+    for (; index + 4 <= length; index += 4)
+    {
+        const auto gradient = _mm_loadu_ps(dy + index);
+        auto result =
+            _mm_blendv_ps(gradient, _mm_mul_ps(a, gradient),
+                          _mm_cmple_ps(_mm_loadu_ps(x + index), zero));
+
+        if (isAdd)
+        {
+            result = _mm_add_ps(_mm_loadu_ps(dx + index), result);
+        }
+
+        _mm_storeu_ps(dx + index, result);
+    }
+
+    for (; index < length; ++index)
+    {
+        const float gradient = x[index] <= 0.0f ? alpha * dy[index] : dy[index];
+
+        dx[index] = isAdd ? dx[index] + gradient : gradient;
+    }
+}
+
+float Max(std::size_t length, const float* x) noexcept
+{
+    std::size_t index = 0;
+    auto result = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+
+    for (; index + 4 <= length; index += 4)
+    {
+        result = _mm_max_ps(result, _mm_loadu_ps(x + index));
+    }
+
+    result = _mm_max_ps(result, _mm_movehl_ps(result, result));
+    result = _mm_max_ss(result, _mm_shuffle_ps(result, result, 0x55));
+
+    float max = _mm_cvtss_f32(result);
+
+    for (; index < length; ++index)
+    {
+        max = std::max(max, x[index]);
+    }
+
+    return max;
+}
+
+// exp(x) after Cephes' expf: 2^n * p(r), with n = round(x / ln 2), r = x -
+// n ln 2 in two parts and p a degree 7 polynomial. Values that would turn
+// subnormal are flushed to zero. The bounds come first in the clamps, so
+// that a NaN in x passes through.
+__m128 Exp(__m128 x) noexcept
+{
+    const auto lowest = _mm_set1_ps(-87.33f);
+    const auto underflow = _mm_cmplt_ps(x, lowest);
+
+    x = _mm_min_ps(_mm_set1_ps(88.0f), _mm_max_ps(lowest, x));
+
+    const auto n =
+        _mm_round_ps(_mm_mul_ps(x, _mm_set1_ps(1.44269504f)),
+                     _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const auto r =
+        _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(0.693359375f))),
+                   _mm_mul_ps(n, _mm_set1_ps(-2.12194440e-4f)));
+
+    auto p = _mm_set1_ps(1.9875691500e-4f);
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.3981999507e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(8.3334519073e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(4.1665795894e-2f));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.6666665459e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(5.0000001201e-1f));
+    p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, _mm_mul_ps(r, r)), r),
+                   _mm_set1_ps(1.0f));
+
+    const auto scale = _mm_castsi128_ps(_mm_slli_epi32(
+        _mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23));
+
+    return _mm_andnot_ps(underflow, _mm_mul_ps(p, scale));
+}
+
+// The tail goes through a padded vector, so that every value is computed the
+// same way.
+float ShiftedExp(std::size_t length, float shift, const float* x,
+                 float* y) noexcept
+{
+    std::size_t index = 0;
+    const auto s = _mm_set1_ps(shift);
+    auto sum = _mm_setzero_ps();
+
+    for (; index + 4 <= length; index += 4)
+    {
+        const auto value = Exp(_mm_sub_ps(_mm_loadu_ps(x + index), s));
+
+        _mm_storeu_ps(y + index, value);
+        sum = _mm_add_ps(sum, value);
+    }
+
+    float result = HorizontalSum(sum);
+
+    if (index < length)
+    {
+        alignas(16) float tail[4] = { shift, shift, shift, shift };
+
+        std::copy(x + index, x + length, tail);
+        _mm_store_ps(tail, Exp(_mm_sub_ps(_mm_load_ps(tail), s)));
+
+        for (std::size_t numI = 0; index < length; ++index, ++numI)
+        {
+            y[index] = tail[numI];
+            result += tail[numI];
+        }
+    }
+
+    return result;
+}
+}  // namespace
+
+KernelTable KernelRegistry::SSE42KernelTable() noexcept
+{
+    // There are no SSE int8 or half-precision kernels; the scalar ones are
+    // used instead.
+    const auto scalar = ScalarKernelTable();
+
+    return KernelTable{ ISA::SSE42,
+                        GEMMKernel{ MR, NR, MicroKernel },
+                        GEMMKernel{ MR, NR, MicroKernel },
+                        Dot,
+                        Axpy,
+                        GatherAxpy,
+                        GEMV,
+                        scalar.int8Gemm,
+                        scalar.bf16,
+                        scalar.fp16,
+                        ActivationKernel{ LeakyReLU, LeakyReLUGradient },
+                        SoftmaxKernel{ Max, ShiftedExp } };
+}
+}  // namespace CubbyDNN::Compute
+
+#else
+
+namespace CubbyDNN::Compute
+{
+KernelTable KernelRegistry::SSE42KernelTable() noexcept
+{
+    return ScalarKernelTable();
+}
+}  // namespace CubbyDNN::Compute
+
+#endif
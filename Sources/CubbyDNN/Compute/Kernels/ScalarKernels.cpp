@@ -0,0 +1,234 @@
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+constexpr std::size_t MR = 4;
+constexpr std::size_t NR = 4;
+constexpr std::size_t Int8MR = 4;
+constexpr std::size_t Int8NR = 4;
+
+void MicroKernel(std::size_t kc, const float* __restrict a,
+                 const float* __restrict b, float* c,
+                 std::size_t ldc) noexcept
+{
+    float accumulator[MR][NR] = {};
+
+    for (std::size_t numK = 0; numK < kc; ++numK)
+    {
+        for (std::size_t numI = 0; numI < MR; ++numI)
+        {
+            for (std::size_t numJ = 0; numJ < NR; ++numJ)
+            {
+                accumulator[numI][numJ] += a[numI] * b[numJ];
+            }
+        }
+
+        a += MR;
+        b += NR;
+    }
+
+    for (std::size_t numI = 0; numI < MR; ++numI)
+    {
+        for (std::size_t numJ = 0; numJ < NR; ++numJ)
+        {
+            c[numI * ldc + numJ] += accumulator[numI][numJ];
+        }
+    }
+}
+
+float Dot(std::size_t length, const float* __restrict x,
+          const float* __restrict y) noexcept
+{
+    float sum = 0.0f;
+
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        sum += x[index] * y[index];
+    }
+
+    return sum;
+}
+
+void Axpy(std::size_t length, float alpha, const float* __restrict x,
+          float* __restrict y) noexcept
+{
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        y[index] += alpha * x[index];
+    }
+}
+
+void GatherAxpy(std::size_t count, const float* __restrict alpha,
+                std::size_t alphaStride, const std::uint32_t* __restrict index,
+                const float* __restrict x, std::size_t ldx, std::size_t length,
+                float* __restrict y) noexcept
+{
+    for (std::size_t numK = 0; numK < count; ++numK)
+    {
+        Axpy(length, alpha[numK * alphaStride], x + index[numK] * ldx, y);
+    }
+}
+
+void Int8MicroKernel(std::size_t kc, const std::uint8_t* __restrict a,
+                     const std::int8_t* __restrict b, std::int32_t* c,
+                     std::size_t ldc) noexcept
+{
+    std::int32_t accumulator[Int8MR][Int8NR] = {};
+
+    for (std::size_t numK = 0; numK < kc; numK += 4)
+    {
+        for (std::size_t numI = 0; numI < Int8MR; ++numI)
+        {
+            for (std::size_t numJ = 0; numJ < Int8NR; ++numJ)
+            {
+                for (std::size_t numP = 0; numP < 4; ++numP)
+                {
+                    accumulator[numI][numJ] +=
+                        static_cast<std::int32_t>(a[numI * 4 + numP]) *
+                        static_cast<std::int32_t>(b[numJ * 4 + numP]);
+                }
+            }
+        }
+
+        a += Int8MR * 4;
+        b += Int8NR * 4;
+    }
+
+    for (std::size_t numI = 0; numI < Int8MR; ++numI)
+    {
+        for (std::size_t numJ = 0; numJ < Int8NR; ++numJ)
+        {
+            c[numI * ldc + numJ] += accumulator[numI][numJ];
+        }
+    }
+}
+
+void GEMV(std::size_t numBatch, std::size_t numRow, std::size_t length,
+          const float* __restrict x, const float* __restrict w, float* y,
+          std::size_t ldy) noexcept
+{
+    for (std::size_t numR = 0; numR < numRow; ++numR)
+    {
+        for (std::size_t numB = 0; numB < numBatch; ++numB)
+        {
+            y[numB * ldy + numR] +=
+                Dot(length, x + numB * length, w + numR * length);
+        }
+    }
+}
+
+template <typename T>
+void HalfToFloat(std::size_t length, const T* __restrict x,
+                 float* __restrict y) noexcept
+{
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        y[index] = x[index].ToFloat();
+    }
+}
+
+template <typename T>
+void FloatToHalf(std::size_t length, const float* __restrict x,
+                 T* __restrict y) noexcept
+{
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        y[index] = T::FromFloat(x[index]);
+    }
+}
+
+template <typename T>
+void HalfGEMV(std::size_t numBatch, std::size_t numRow, std::size_t length,
+              const float* __restrict x, const T* __restrict w, float* y,
+              std::size_t ldy) noexcept
+{
+    for (std::size_t numR = 0; numR < numRow; ++numR)
+    {
+        const T* row = w + numR * length;
+
+        for (std::size_t numB = 0; numB < numBatch; ++numB)
+        {
+            const float* vector = x + numB * length;
+            float sum = 0.0f;
+
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                sum += vector[index] * row[index].ToFloat();
+            }
+
+            y[numB * ldy + numR] += sum;
+        }
+    }
+}
+
+void LeakyReLU(std::size_t length, float alpha, const float* x,
+               float* y) noexcept
+{
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        y[index] = x[index] < 0.0f ? alpha * x[index] : x[index];
+    }
+}
+
+void LeakyReLUGradient(std::size_t length, float alpha, const float* x,
+                       const float* dy, float* dx, bool isAdd) noexcept
+{
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        const float gradient = x[index] <= 0.0f ? alpha * dy[index] : dy[index];
+
+        dx[index] = isAdd ? dx[index] + gradient : gradient;
+    }
+}
+
+float Max(std::size_t length, const float* x) noexcept
+{
+    float result = -std::numeric_limits<float>::infinity();
+
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        result = std::max(result, x[index]);
+    }
+
+    return result;
+}
+
+float ShiftedExp(std::size_t length, float shift, const float* x,
+                 float* y) noexcept
+{
+    float sum = 0.0f;
+
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        y[index] = std::exp(x[index] - shift);
+        sum += y[index];
+    }
+
+    return sum;
+}
+
+template <typename T>
+HalfKernel<T> MakeHalfKernel() noexcept
+{
+    return HalfKernel<T>{ HalfToFloat<T>, FloatToHalf<T>, HalfGEMV<T> };
+}
+}  // namespace
+
+KernelTable KernelRegistry::ScalarKernelTable() noexcept
+{
+    return KernelTable{
+        ISA::Scalar, GEMMKernel{ MR, NR, MicroKernel },
+        GEMMKernel{ MR, NR, MicroKernel }, Dot, Axpy, GatherAxpy, GEMV,
+        Int8GEMMKernel{ Int8MR, Int8NR, 127, Int8MicroKernel },
+        MakeHalfKernel<Core::BFloat16>(), MakeHalfKernel<Core::Float16>(),
+        ActivationKernel{ LeakyReLU, LeakyReLUGradient },
+        SoftmaxKernel{ Max, ShiftedExp }
+    };
+}
+}  // namespace CubbyDNN::Compute
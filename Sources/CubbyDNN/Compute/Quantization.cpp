@@ -0,0 +1,191 @@
+#include <CubbyDNN/Compute/Quantization.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+std::int32_t Round(float value) noexcept
+{
+    return static_cast<std::int32_t>(std::nearbyint(value));
+}
+
+// Calls store(i, j, value) with the real value of every element of c.
+template <typename Store>
+void ForEachReal(std::size_t m, std::size_t n, std::size_t k,
+                 const Core::Span<std::int32_t> accumulator,
+                 const QuantizationParam& aParam,
+                 const Core::Span<std::int32_t> aRowSum,
+                 const Core::Span<QuantizationParam> bParam,
+                 const Core::Span<std::int32_t> bRowSum,
+                 const Core::Span<float> bias, Store store) noexcept
+{
+    const bool isPerRow = bParam.Length() > 1;
+    const std::int32_t aZeroPoint = aParam.zeroPoint;
+
+    for (std::size_t numR = 0; numR < m; ++numR)
+    {
+        for (std::size_t numC = 0; numC < n; ++numC)
+        {
+            const auto& param = bParam[isPerRow ? numC : 0];
+            std::int64_t value = accumulator[numR * n + numC];
+
+            value -= static_cast<std::int64_t>(aZeroPoint) * bRowSum[numC];
+
+            if (param.zeroPoint)
+            {
+                value -= static_cast<std::int64_t>(param.zeroPoint) *
+                         aRowSum[numR];
+                value += static_cast<std::int64_t>(k) * aZeroPoint *
+                         param.zeroPoint;
+            }
+
+            float real =
+                aParam.scale * param.scale * static_cast<float>(value);
+
+            if (bias.Length())
+            {
+                real += bias[numC];
+            }
+
+            store(numR * n + numC, real);
+        }
+    }
+}
+}  // namespace
+
+QuantizationParam Quantization::ChooseUnsigned(float min, float max) noexcept
+{
+    min = std::min(min, 0.0f);
+    max = std::max(max, 0.0f);
+
+    const float scale = max > min ? (max - min) / 255.0f : 1.0f;
+
+    return QuantizationParam{ scale, std::clamp(Round(-min / scale), 0, 255) };
+}
+
+QuantizationParam Quantization::ChooseSymmetric(float absMax,
+                                                std::int32_t maxLevel) noexcept
+{
+    return QuantizationParam{
+        absMax > 0.0f ? absMax / static_cast<float>(maxLevel) : 1.0f, 0
+    };
+}
+
+void Quantization::Quantize(const Core::Span<float> input,
+                            const QuantizationParam& param,
+                            Core::Span<std::uint8_t> output) noexcept
+{
+    const float inverse = 1.0f / param.scale;
+
+    std::transform(input.begin(), input.end(), output.begin(),
+                   [inverse, &param](float value) {
+                       return static_cast<std::uint8_t>(std::clamp(
+                           Round(value * inverse) + param.zeroPoint, 0, 255));
+                   });
+}
+
+void Quantization::Quantize(const Core::Span<float> input,
+                            const QuantizationParam& param,
+                            std::int32_t maxLevel,
+                            Core::Span<std::int8_t> output) noexcept
+{
+    const float inverse = 1.0f / param.scale;
+
+    std::transform(input.begin(), input.end(), output.begin(),
+                   [inverse, maxLevel, &param](float value) {
+                       return static_cast<std::int8_t>(
+                           std::clamp(Round(value * inverse) + param.zeroPoint,
+                                      -maxLevel, maxLevel));
+                   });
+}
+
+void Quantization::QuantizeRows(std::size_t numRow, std::size_t rowSize,
+                                const Core::Span<float> input,
+                                std::int32_t maxLevel,
+                                Core::Span<std::int8_t> output,
+                                Core::Span<QuantizationParam> param,
+                                Core::Span<std::int32_t> rowSum) noexcept
+{
+    for (std::size_t numR = 0; numR < numRow; ++numR)
+    {
+        const auto row = input.SubSpan(numR * rowSize, rowSize);
+        const auto quantized = output.SubSpan(numR * rowSize, rowSize);
+
+        float absMax = 0.0f;
+
+        for (const auto value : row)
+        {
+            absMax = std::max(absMax, std::abs(value));
+        }
+
+        param[numR] = ChooseSymmetric(absMax, maxLevel);
+        Quantize(row, param[numR], maxLevel, quantized);
+
+        std::int32_t sum = 0;
+
+        for (const auto value : quantized)
+        {
+            sum += value;
+        }
+
+        rowSum[numR] = sum;
+    }
+}
+
+void Quantization::RowSum(std::size_t numRow, std::size_t rowSize,
+                          const Core::Span<std::uint8_t> input,
+                          Core::Span<std::int32_t> rowSum) noexcept
+{
+    for (std::size_t numR = 0; numR < numRow; ++numR)
+    {
+        std::int32_t sum = 0;
+
+        for (const auto value : input.SubSpan(numR * rowSize, rowSize))
+        {
+            sum += value;
+        }
+
+        rowSum[numR] = sum;
+    }
+}
+
+void Quantization::Dequantize(std::size_t m, std::size_t n, std::size_t k,
+                              const Core::Span<std::int32_t> accumulator,
+                              const QuantizationParam& aParam,
+                              const Core::Span<std::int32_t> aRowSum,
+                              const Core::Span<QuantizationParam> bParam,
+                              const Core::Span<std::int32_t> bRowSum,
+                              const Core::Span<float> bias,
+                              Core::Span<float> output) noexcept
+{
+    ForEachReal(m, n, k, accumulator, aParam, aRowSum, bParam, bRowSum, bias,
+                [&output](std::size_t index, float value) {
+                    output[index] = value;
+                });
+}
+
+void Quantization::Requantize(std::size_t m, std::size_t n, std::size_t k,
+                              const Core::Span<std::int32_t> accumulator,
+                              const QuantizationParam& aParam,
+                              const Core::Span<std::int32_t> aRowSum,
+                              const Core::Span<QuantizationParam> bParam,
+                              const Core::Span<std::int32_t> bRowSum,
+                              const Core::Span<float> bias,
+                              const QuantizationParam& outputParam,
+                              Core::Span<std::uint8_t> output) noexcept
+{
+    const float inverse = 1.0f / outputParam.scale;
+
+    ForEachReal(m, n, k, accumulator, aParam, aRowSum, bParam, bRowSum, bias,
+                [&output, &outputParam, inverse](std::size_t index,
+                                                 float value) {
+                    output[index] = static_cast<std::uint8_t>(
+                        std::clamp(Round(value * inverse) +
+                                       outputParam.zeroPoint,
+                                   0, 255));
+                });
+}
+}  // namespace CubbyDNN::Compute
@@ -0,0 +1,273 @@
+#include <CubbyDNN/Compute/Elementwise.hpp>
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+#include <CubbyDNN/Compute/Softmax.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+// Calls body(offset, length) for every independent piece of work: a block,
+// or a chunk of the positions of a block when each is a group of its own.
+// The rows of the piece start at offset plus each row offset and hold
+// length values. size is the number of values in the tensor.
+template <typename Body>
+void ForEachGroup(const SoftmaxLayout& layout, std::size_t size,
+                  const Body& body)
+{
+    const std::size_t rowLength = layout.rowLength;
+    const std::size_t numChunk =
+        layout.isRowGrouped
+            ? 1
+            : (rowLength + Softmax::ChunkSize - 1) / Softmax::ChunkSize;
+    const std::size_t numItem = layout.blockOffsetList.size() * numChunk;
+    const std::size_t numThread = Elementwise::ThreadCount(size);
+
+    const auto runItem = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t numI = begin; numI < end; ++numI)
+        {
+            const std::size_t offset = layout.blockOffsetList[numI / numChunk];
+
+            if (layout.isRowGrouped)
+            {
+                body(offset, rowLength);
+                continue;
+            }
+
+            const std::size_t position =
+                numI % numChunk * Softmax::ChunkSize;
+
+            body(offset + position,
+                 std::min(Softmax::ChunkSize, rowLength - position));
+        }
+    };
+
+    if (numThread == 1)
+    {
+        runItem(0, numItem);
+        return;
+    }
+
+    Core::DefaultThreadPool().ParallelFor(
+        numItem, (numItem + numThread - 1) / numThread, numThread, runItem);
+}
+}  // namespace
+
+SoftmaxLayout Softmax::Layout(const Core::Shape& shape,
+                              const std::vector<bool>& groupAxis)
+{
+    // Size, stride and flag of each run of axes with the same flag.
+    std::vector<std::tuple<std::size_t, std::size_t, bool>> axisList;
+    std::size_t stride = 1;
+
+    for (std::size_t index = 0, maxIndex = groupAxis.size(); index < maxIndex;
+         ++index)
+    {
+        const std::size_t size = shape[index];
+
+        if (size != 1)
+        {
+            if (!axisList.empty() &&
+                std::get<2>(axisList.back()) == groupAxis[index])
+            {
+                std::get<0>(axisList.back()) *= size;
+            }
+            else
+            {
+                axisList.emplace_back(size, stride, groupAxis[index]);
+            }
+        }
+
+        stride *= size;
+    }
+
+    SoftmaxLayout layout;
+    layout.rowLength = 1;
+    layout.rowOffsetList = { 0 };
+    layout.blockOffsetList = { 0 };
+
+    // The innermost run makes the rows; the others repeat them, within a
+    // group or over the blocks.
+    for (std::size_t index = 0, maxIndex = axisList.size(); index < maxIndex;
+         ++index)
+    {
+        const auto [size, axisStride, isGrouped] = axisList[index];
+
+        if (index == 0)
+        {
+            layout.rowLength = size;
+            layout.isRowGrouped = isGrouped;
+            continue;
+        }
+
+        auto& offsetList =
+            isGrouped ? layout.rowOffsetList : layout.blockOffsetList;
+        const std::size_t count = offsetList.size();
+
+        offsetList.resize(count * size);
+
+        // From the last copy down, so that the first is read before it is
+        // overwritten.
+        for (std::size_t numK = size; numK-- > 0;)
+        {
+            for (std::size_t numJ = 0; numJ < count; ++numJ)
+            {
+                offsetList[numK * count + numJ] =
+                    offsetList[numJ] + numK * axisStride;
+            }
+        }
+    }
+
+    return layout;
+}
+
+void Softmax::Forward(const SoftmaxLayout& layout, float epsilon,
+                      const Core::Span<float> input, Core::Span<float> output)
+{
+    const float* source = input.begin();
+    float* destination = output.begin();
+    const auto& kernel = KernelRegistry::Active().softmax;
+    const auto& rowOffsetList = layout.rowOffsetList;
+
+    ForEachGroup(layout, output.Length(), [&](std::size_t offset,
+                                              std::size_t length) {
+        const float* x = source + offset;
+        float* y = destination + offset;
+
+        if (layout.isRowGrouped)
+        {
+            float max = -std::numeric_limits<float>::infinity();
+            float sum = 0.0f;
+
+            for (const auto row : rowOffsetList)
+            {
+                max = std::max(max, kernel.reduceMax(length, x + row));
+            }
+
+            for (const auto row : rowOffsetList)
+            {
+                sum += kernel.shiftedExp(length, max, x + row, y + row);
+            }
+
+            const float sumInv = 1.0f / (sum + epsilon);
+
+            for (const auto row : rowOffsetList)
+            {
+                for (std::size_t index = row; index < row + length; ++index)
+                {
+                    y[index] *= sumInv;
+                }
+            }
+
+            return;
+        }
+
+        // A maximum and a sum per position, each formed down the rows.
+        float max[ChunkSize];
+        float sumInv[ChunkSize];
+
+        std::fill_n(max, length, -std::numeric_limits<float>::infinity());
+        std::fill_n(sumInv, length, 0.0f);
+
+        for (const auto row : rowOffsetList)
+        {
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                max[index] = std::max(max[index], x[row + index]);
+            }
+        }
+
+        for (const auto row : rowOffsetList)
+        {
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                y[row + index] = x[row + index] - max[index];
+            }
+
+            kernel.shiftedExp(length, 0.0f, y + row, y + row);
+
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                sumInv[index] += y[row + index];
+            }
+        }
+
+        for (std::size_t index = 0; index < length; ++index)
+        {
+            sumInv[index] = 1.0f / (sumInv[index] + epsilon);
+        }
+
+        for (const auto row : rowOffsetList)
+        {
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                y[row + index] *= sumInv[index];
+            }
+        }
+    });
+}
+
+void Softmax::BackwardAdd(const SoftmaxLayout& layout,
+                          const Core::Span<float> output,
+                          const Core::Span<float> gradient,
+                          Core::Span<float> inputGradient)
+{
+    const float* source = output.begin();
+    const float* sourceGradient = gradient.begin();
+    float* destination = inputGradient.begin();
+    const auto& kernelTable = KernelRegistry::Active();
+    const auto& rowOffsetList = layout.rowOffsetList;
+
+    ForEachGroup(layout, output.Length(), [&](std::size_t offset,
+                                              std::size_t length) {
+        const float* y = source + offset;
+        const float* dy = sourceGradient + offset;
+        float* dx = destination + offset;
+
+        if (layout.isRowGrouped)
+        {
+            float sum = 0.0f;
+
+            for (const auto row : rowOffsetList)
+            {
+                sum += kernelTable.dot(length, dy + row, y + row);
+            }
+
+            for (const auto row : rowOffsetList)
+            {
+                for (std::size_t index = row; index < row + length; ++index)
+                {
+                    dx[index] += y[index] * (dy[index] - sum);
+                }
+            }
+
+            return;
+        }
+
+        float sum[ChunkSize];
+
+        std::fill_n(sum, length, 0.0f);
+
+        for (const auto row : rowOffsetList)
+        {
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                sum[index] += dy[row + index] * y[row + index];
+            }
+        }
+
+        for (const auto row : rowOffsetList)
+        {
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                dx[row + index] +=
+                    y[row + index] * (dy[row + index] - sum[index]);
+            }
+        }
+    });
+}
+}  // namespace CubbyDNN::Compute
\ No newline at end of file
@@ -0,0 +1,520 @@
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+#include <CubbyDNN/Compute/Sparse.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace CubbyDNN::Compute
+{
+namespace
+{
+std::size_t BlockHeight(SparseFormat format) noexcept
+{
+    switch (format)
+    {
+        case SparseFormat::Block4x4:
+            return 4;
+        case SparseFormat::Block8x1:
+            return 8;
+        default:
+            return 1;
+    }
+}
+
+std::size_t BlockWidth(SparseFormat format) noexcept
+{
+    return format == SparseFormat::Block4x4 ? 4 : 1;
+}
+
+// Threads of the default pool to run a kernel on, the calling one included:
+// one per 1.6 MFLOP as in the dense GEMM, at most every thread of the pool.
+std::size_t ThreadCount(std::size_t numFlop) noexcept
+{
+    return std::max<std::size_t>(
+        1u, std::min<std::size_t>(numFlop / 1600000u,
+                                  Core::DefaultThreadPool().ThreadCount()));
+}
+
+template <typename T>
+T* AcquireBuffer(Core::Memory<T>& buffer, std::size_t size)
+{
+    buffer.Resize(size);
+
+    return buffer.GetSpan().begin();
+}
+
+// destination(numColumn x numRow) = source(numRow x numColumn)^T
+void Transpose(std::size_t numRow, std::size_t numColumn, const float* source,
+               float* destination) noexcept
+{
+    for (std::size_t numR = 0; numR < numRow; ++numR)
+    {
+        for (std::size_t numC = 0; numC < numColumn; ++numC)
+        {
+            destination[numC * numRow + numR] = source[numR * numColumn + numC];
+        }
+    }
+}
+
+// y += weight * x for a single vector, split over block rows. The BlockRow
+// sums stay in registers. Only blocks overhanging the right edge take the
+// bounds-checked loop, so x is never read past its end.
+template <std::size_t BlockRow, std::size_t BlockColumn>
+void MultiplyAddVector(const float* x, const SparseMatrix& weight,
+                       float* y) noexcept
+{
+    constexpr std::size_t BlockSize = BlockRow * BlockColumn;
+
+    const std::size_t numRow = weight.numRow;
+    const std::size_t numColumn = weight.numColumn;
+    const std::size_t* rowOffset = weight.rowOffset.GetSpan().begin();
+    const std::uint32_t* columnIndex = weight.columnIndex.GetSpan().begin();
+    const float* values = weight.values.GetSpan().begin();
+
+    const std::size_t numBlockRow = (numRow + BlockRow - 1) / BlockRow;
+    const std::size_t numThread = ThreadCount(2 * weight.values.Size());
+
+    const auto runBlockRow = [&](std::size_t numBR) {
+        const std::size_t row = numBR * BlockRow;
+        const std::size_t numValid = std::min(BlockRow, numRow - row);
+        float sum[BlockRow] = {};
+
+        for (std::size_t block = rowOffset[numBR];
+             block < rowOffset[numBR + 1]; ++block)
+        {
+            const float* value = values + block * BlockSize;
+            const std::size_t column = columnIndex[block];
+            const std::size_t width = std::min(BlockColumn, numColumn - column);
+
+            if (BlockColumn == 1 || width == BlockColumn)
+            {
+                for (std::size_t numI = 0; numI < BlockRow; ++numI)
+                {
+                    for (std::size_t numJ = 0; numJ < BlockColumn; ++numJ)
+                    {
+                        sum[numI] +=
+                            value[numI * BlockColumn + numJ] * x[column + numJ];
+                    }
+                }
+            }
+            else
+            {
+                for (std::size_t numI = 0; numI < BlockRow; ++numI)
+                {
+                    for (std::size_t numJ = 0; numJ < width; ++numJ)
+                    {
+                        sum[numI] +=
+                            value[numI * BlockColumn + numJ] * x[column + numJ];
+                    }
+                }
+            }
+        }
+
+        for (std::size_t numI = 0; numI < numValid; ++numI)
+        {
+            y[row + numI] += sum[numI];
+        }
+    };
+
+    // Ranges of 16 block rows, handed to whichever thread is free next so
+    // that rows with more blocks do not hold up the others.
+    Core::DefaultThreadPool().ParallelFor(
+        numBlockRow, 16, numThread, [&](std::size_t first, std::size_t last) {
+            for (std::size_t numBR = first; numBR < last; ++numBR)
+            {
+                runBlockRow(numBR);
+            }
+        });
+}
+
+// output += input * weight^T for several vectors. The input is transposed
+// first so that every stored weight scales one contiguous run of batch
+// values, and the gatherAxpy kernel sums all blocks of a block row into a
+// chunk of the BlockRow x batchSize scratch while it sits in registers. The
+// transposed input is padded with zero rows so that blocks overhanging the
+// right edge read zeros.
+template <std::size_t BlockRow, std::size_t BlockColumn>
+void MultiplyAddBatch(std::size_t batchSize, const float* input,
+                      const SparseMatrix& weight, float* output) noexcept
+{
+    constexpr std::size_t BlockSize = BlockRow * BlockColumn;
+
+    const std::size_t numRow = weight.numRow;
+    const std::size_t numColumn = weight.numColumn;
+    const std::size_t* rowOffset = weight.rowOffset.GetSpan().begin();
+    const std::uint32_t* columnIndex = weight.columnIndex.GetSpan().begin();
+    const float* values = weight.values.GetSpan().begin();
+
+    const auto gatherAxpy = KernelRegistry::Active().gatherAxpy;
+
+    // Scratch rather than thread-local: the thread may run other products
+    // while it waits for the block rows.
+    const Core::ScratchMemory<float> transposedMemory(
+        (numColumn + BlockColumn - 1) * batchSize);
+    float* transposed = transposedMemory.Data();
+    Transpose(batchSize, numColumn, input, transposed);
+    std::fill(transposed + numColumn * batchSize,
+              transposed + (numColumn + BlockColumn - 1) * batchSize, 0.0f);
+
+    const std::size_t numBlockRow = (numRow + BlockRow - 1) / BlockRow;
+    const std::size_t numThread =
+        ThreadCount(2 * weight.values.Size() * batchSize);
+
+    const auto runBlockRow = [&](std::size_t numBR) {
+        static thread_local Core::Memory<float> sumMemory;
+        float* sum = AcquireBuffer(sumMemory, BlockRow * batchSize);
+
+        const std::size_t row = numBR * BlockRow;
+        const std::size_t numValid = std::min(BlockRow, numRow - row);
+        const std::size_t begin = rowOffset[numBR];
+        const std::size_t count = rowOffset[numBR + 1] - begin;
+
+        std::fill(sum, sum + BlockRow * batchSize, 0.0f);
+
+        for (std::size_t numI = 0; numI < numValid; ++numI)
+        {
+            for (std::size_t numJ = 0; numJ < BlockColumn; ++numJ)
+            {
+                gatherAxpy(count,
+                           values + begin * BlockSize + numI * BlockColumn +
+                               numJ,
+                           BlockSize, columnIndex + begin,
+                           transposed + numJ * batchSize, batchSize, batchSize,
+                           sum + numI * batchSize);
+            }
+        }
+
+        for (std::size_t numB = 0; numB < batchSize; ++numB)
+        {
+            for (std::size_t numI = 0; numI < numValid; ++numI)
+            {
+                output[numB * numRow + row + numI] +=
+                    sum[numI * batchSize + numB];
+            }
+        }
+    };
+
+    // Ranges of 16 block rows, as in MultiplyAddVector.
+    Core::DefaultThreadPool().ParallelFor(
+        numBlockRow, 16, numThread, [&](std::size_t first, std::size_t last) {
+            for (std::size_t numBR = first; numBR < last; ++numBR)
+            {
+                runBlockRow(numBR);
+            }
+        });
+}
+
+// dx += weight^T * dy for a single vector. The transposed product scatters
+// instead of gathering, so it runs on one thread.
+template <std::size_t BlockRow, std::size_t BlockColumn>
+void dMultiplyAddLeftVector(const float* dy, const SparseMatrix& weight,
+                            float* dx) noexcept
+{
+    constexpr std::size_t BlockSize = BlockRow * BlockColumn;
+
+    const std::size_t numRow = weight.numRow;
+    const std::size_t numColumn = weight.numColumn;
+    const std::size_t numBlockRow = (numRow + BlockRow - 1) / BlockRow;
+    const std::size_t* rowOffset = weight.rowOffset.GetSpan().begin();
+    const std::uint32_t* columnIndex = weight.columnIndex.GetSpan().begin();
+    const float* values = weight.values.GetSpan().begin();
+
+    for (std::size_t numBR = 0; numBR < numBlockRow; ++numBR)
+    {
+        const std::size_t row = numBR * BlockRow;
+        const std::size_t numValid = std::min(BlockRow, numRow - row);
+        float dyBlock[BlockRow] = {};
+
+        std::copy(dy + row, dy + row + numValid, dyBlock);
+
+        for (std::size_t block = rowOffset[numBR];
+             block < rowOffset[numBR + 1]; ++block)
+        {
+            const float* value = values + block * BlockSize;
+            const std::size_t column = columnIndex[block];
+            const std::size_t width = std::min(BlockColumn, numColumn - column);
+            float sum[BlockColumn] = {};
+
+            for (std::size_t numI = 0; numI < BlockRow; ++numI)
+            {
+                for (std::size_t numJ = 0; numJ < BlockColumn; ++numJ)
+                {
+                    sum[numJ] +=
+                        value[numI * BlockColumn + numJ] * dyBlock[numI];
+                }
+            }
+
+            for (std::size_t numJ = 0; numJ < width; ++numJ)
+            {
+                dx[column + numJ] += sum[numJ];
+            }
+        }
+    }
+}
+
+// destination += gradient * weight for several vectors, in the transposed
+// layout of MultiplyAddBatch. Every thread owns a contiguous slice of the
+// batch and walks the whole matrix for it, so the scattered updates never
+// collide.
+template <std::size_t BlockRow, std::size_t BlockColumn>
+void dMultiplyAddLeftBatch(std::size_t batchSize, const float* gradient,
+                           const SparseMatrix& weight,
+                           float* destination) noexcept
+{
+    constexpr std::size_t BlockSize = BlockRow * BlockColumn;
+
+    const std::size_t numRow = weight.numRow;
+    const std::size_t numColumn = weight.numColumn;
+    const std::size_t numBlockRow = (numRow + BlockRow - 1) / BlockRow;
+    const std::size_t* rowOffset = weight.rowOffset.GetSpan().begin();
+    const std::uint32_t* columnIndex = weight.columnIndex.GetSpan().begin();
+    const float* values = weight.values.GetSpan().begin();
+
+    const auto axpy = KernelRegistry::Active().axpy;
+
+    const Core::ScratchMemory<float> transposedMemory(numRow * batchSize);
+    const Core::ScratchMemory<float> sumMemory(numColumn * batchSize);
+    float* transposed = transposedMemory.Data();
+    float* sum = sumMemory.Data();
+
+    Transpose(batchSize, numRow, gradient, transposed);
+    std::fill(sum, sum + numColumn * batchSize, 0.0f);
+
+    const std::size_t numThread =
+        ThreadCount(2 * weight.values.Size() * batchSize);
+    const std::size_t slice = std::max<std::size_t>(
+        16u, (batchSize + numThread - 1) / numThread);
+
+    // One slice of the batch per range, a share of it per thread but at
+    // least 16 samples; a range only adds into the entries of sum for its
+    // own samples.
+    const auto runSlice = [&](std::size_t first, std::size_t last) {
+        const std::size_t length = last - first;
+
+        for (std::size_t numBR = 0; numBR < numBlockRow; ++numBR)
+        {
+            const std::size_t row = numBR * BlockRow;
+            const std::size_t numValid = std::min(BlockRow, numRow - row);
+
+            for (std::size_t block = rowOffset[numBR];
+                 block < rowOffset[numBR + 1]; ++block)
+            {
+                const float* value = values + block * BlockSize;
+                const std::size_t column = columnIndex[block];
+                const std::size_t width =
+                    std::min(BlockColumn, numColumn - column);
+
+                for (std::size_t numI = 0; numI < numValid; ++numI)
+                {
+                    for (std::size_t numJ = 0; numJ < width; ++numJ)
+                    {
+                        axpy(length, value[numI * BlockColumn + numJ],
+                             transposed + (row + numI) * batchSize + first,
+                             sum + (column + numJ) * batchSize + first);
+                    }
+                }
+            }
+        }
+    };
+
+    Core::DefaultThreadPool().ParallelFor(batchSize, slice, numThread,
+                                          runSlice);
+
+    for (std::size_t numB = 0; numB < batchSize; ++numB)
+    {
+        for (std::size_t numC = 0; numC < numColumn; ++numC)
+        {
+            destination[numB * numColumn + numC] +=
+                sum[numC * batchSize + numB];
+        }
+    }
+}
+
+template <std::size_t BlockRow, std::size_t BlockColumn>
+void MultiplyAddBlocks(std::size_t batchSize, const float* input,
+                       const SparseMatrix& weight, float* output) noexcept
+{
+    if (batchSize == 1)
+    {
+        MultiplyAddVector<BlockRow, BlockColumn>(input, weight, output);
+    }
+    else if (batchSize > 1)
+    {
+        MultiplyAddBatch<BlockRow, BlockColumn>(batchSize, input, weight,
+                                                output);
+    }
+}
+
+template <std::size_t BlockRow, std::size_t BlockColumn>
+void dMultiplyAddLeftBlocks(std::size_t batchSize, const float* gradient,
+                            const SparseMatrix& weight,
+                            float* destination) noexcept
+{
+    if (batchSize == 1)
+    {
+        dMultiplyAddLeftVector<BlockRow, BlockColumn>(gradient, weight,
+                                                      destination);
+    }
+    else if (batchSize > 1)
+    {
+        dMultiplyAddLeftBatch<BlockRow, BlockColumn>(batchSize, gradient,
+                                                     weight, destination);
+    }
+}
+}  // namespace
+
+SparseMatrix Sparse::FromDense(SparseFormat format, std::size_t numRow,
+                               std::size_t numColumn,
+                               const Core::Span<float> dense)
+{
+    if (numColumn > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::runtime_error("Too many columns for a sparse matrix");
+    }
+
+    const std::size_t blockRow = BlockHeight(format);
+    const std::size_t blockColumn = BlockWidth(format);
+    const std::size_t numBlockRow = (numRow + blockRow - 1) / blockRow;
+
+    std::vector<std::size_t> rowOffset{ 0 };
+    std::vector<std::uint32_t> columnIndex;
+    std::vector<float> values;
+
+    for (std::size_t row = 0; row < numRow; row += blockRow)
+    {
+        const std::size_t height = std::min(blockRow, numRow - row);
+
+        for (std::size_t column = 0; column < numColumn;
+             column += blockColumn)
+        {
+            const std::size_t width = std::min(blockColumn, numColumn - column);
+            const std::size_t first = values.size();
+            bool isZero = true;
+
+            values.resize(first + blockRow * blockColumn, 0.0f);
+
+            for (std::size_t numI = 0; numI < height; ++numI)
+            {
+                for (std::size_t numJ = 0; numJ < width; ++numJ)
+                {
+                    const float value =
+                        dense[(row + numI) * numColumn + column + numJ];
+
+                    values[first + numI * blockColumn + numJ] = value;
+                    isZero = isZero && value == 0.0f;
+                }
+            }
+
+            if (isZero)
+            {
+                values.resize(first);
+            }
+            else
+            {
+                columnIndex.push_back(static_cast<std::uint32_t>(column));
+            }
+        }
+
+        rowOffset.push_back(columnIndex.size());
+    }
+
+    SparseMatrix matrix{ format,
+                         numRow,
+                         numColumn,
+                         blockRow,
+                         blockColumn,
+                         Core::Memory<std::size_t>(numBlockRow + 1),
+                         Core::Memory<std::uint32_t>(columnIndex.size()),
+                         Core::Memory<float>(values.size()) };
+
+    std::copy(rowOffset.begin(), rowOffset.end(),
+              matrix.rowOffset.GetSpan().begin());
+    std::copy(columnIndex.begin(), columnIndex.end(),
+              matrix.columnIndex.GetSpan().begin());
+    std::copy(values.begin(), values.end(), matrix.values.GetSpan().begin());
+
+    return matrix;
+}
+
+void Sparse::ToDense(const SparseMatrix& matrix,
+                     Core::Span<float> dense) noexcept
+{
+    const std::size_t blockRow = matrix.blockRow;
+    const std::size_t blockColumn = matrix.blockColumn;
+    const auto rowOffset = matrix.rowOffset.GetSpan();
+    const auto columnIndex = matrix.columnIndex.GetSpan();
+    const auto values = matrix.values.GetSpan();
+
+    dense.FillZero();
+
+    for (std::size_t numBR = 0; numBR + 1 < rowOffset.Length(); ++numBR)
+    {
+        const std::size_t row = numBR * blockRow;
+        const std::size_t height = std::min(blockRow, matrix.numRow - row);
+
+        for (std::size_t block = rowOffset[numBR];
+             block < rowOffset[numBR + 1]; ++block)
+        {
+            const std::size_t column = columnIndex[block];
+            const std::size_t width =
+                std::min(blockColumn, matrix.numColumn - column);
+
+            for (std::size_t numI = 0; numI < height; ++numI)
+            {
+                for (std::size_t numJ = 0; numJ < width; ++numJ)
+                {
+                    dense[(row + numI) * matrix.numColumn + column + numJ] =
+                        values[(block * blockRow + numI) * blockColumn +
+                               numJ];
+                }
+            }
+        }
+    }
+}
+
+void Sparse::MultiplyAdd(std::size_t batchSize, const Core::Span<float> input,
+                         const SparseMatrix& weight,
+                         Core::Span<float> output) noexcept
+{
+    switch (weight.format)
+    {
+        case SparseFormat::CSR:
+            MultiplyAddBlocks<1, 1>(batchSize, input.begin(), weight,
+                                    output.begin());
+            break;
+        case SparseFormat::Block4x4:
+            MultiplyAddBlocks<4, 4>(batchSize, input.begin(), weight,
+                                    output.begin());
+            break;
+        case SparseFormat::Block8x1:
+            MultiplyAddBlocks<8, 1>(batchSize, input.begin(), weight,
+                                    output.begin());
+            break;
+    }
+}
+
+void Sparse::dMultiplyAddLeft(std::size_t batchSize,
+                              const Core::Span<float> gradient,
+                              const SparseMatrix& weight,
+                              Core::Span<float> destination) noexcept
+{
+    switch (weight.format)
+    {
+        case SparseFormat::CSR:
+            dMultiplyAddLeftBlocks<1, 1>(batchSize, gradient.begin(), weight,
+                                         destination.begin());
+            break;
+        case SparseFormat::Block4x4:
+            dMultiplyAddLeftBlocks<4, 4>(batchSize, gradient.begin(), weight,
+                                         destination.begin());
+            break;
+        case SparseFormat::Block8x1:
+            dMultiplyAddLeftBlocks<8, 1>(batchSize, gradient.begin(), weight,
+                                         destination.begin());
+            break;
+    }
+}
+}  // namespace CubbyDNN::Compute
@@ -0,0 +1,360 @@
+#include <CubbyDNN/Core/Allocator.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace CubbyDNN::Core
+{
+namespace
+{
+std::atomic<Allocator*> defaultAllocator{ nullptr };
+
+#if defined(__linux__)
+constexpr std::size_t HugePageSize = std::size_t{ 1 } << 21;
+
+// MPOL_INTERLEAVE of <linux/mempolicy.h>; mbind is called through syscall
+// so that libnuma is not needed.
+constexpr int InterleavePolicy = 3;
+
+std::size_t SystemPageSize() noexcept
+{
+    static const auto pageSize =
+        static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    return pageSize;
+}
+
+// Maps length bytes starting on a multiple of alignment, which is a
+// multiple of the system page size.
+void* MapAligned(std::size_t length, std::size_t alignment)
+{
+    const std::size_t reserved = length + alignment - SystemPageSize();
+
+    void* pointer = mmap(nullptr, reserved, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pointer == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+
+    auto* begin = static_cast<char*>(pointer);
+    auto* aligned = reinterpret_cast<char*>(
+        (reinterpret_cast<std::uintptr_t>(begin) + alignment - 1) /
+        alignment * alignment);
+
+    if (aligned != begin)
+    {
+        munmap(begin, aligned - begin);
+    }
+
+    if (aligned + length != begin + reserved)
+    {
+        munmap(aligned + length, begin + reserved - (aligned + length));
+    }
+
+    return aligned;
+}
+
+// Writes one byte of every page, pages shared out in equal contiguous
+// ranges over the threads of the pool the compute kernels run on.
+void TouchInParallel(char* begin, std::size_t length, std::size_t pageSize)
+{
+    auto& pool = DefaultThreadPool();
+    const std::size_t numPage = length / pageSize;
+    const std::size_t numThread = pool.ThreadCount();
+
+    pool.ParallelFor(numPage, (numPage + numThread - 1) / numThread,
+                     numThread, [&](std::size_t first, std::size_t last) {
+                         for (std::size_t index = first; index < last; ++index)
+                         {
+                             begin[index * pageSize] = 0;
+                         }
+                     });
+}
+#endif
+}  // namespace
+
+void* SystemAllocator::Allocate(std::size_t numByte)
+{
+    return ::operator new(numByte, std::align_val_t{ CacheLineSize });
+}
+
+void SystemAllocator::Deallocate(void* pointer,
+                                 [[maybe_unused]] std::size_t numByte) noexcept
+{
+    ::operator delete(pointer, std::align_val_t{ CacheLineSize });
+}
+
+bool AllocationPolicy::IsDefault() const noexcept
+{
+    return hugePage == HugePagePolicy::None && numa == NUMAPolicy::FirstTouch;
+}
+
+PageAllocator::PageAllocator(const AllocationPolicy& policy)
+    : m_policy(policy)
+{
+    // Do nothing
+}
+
+void* PageAllocator::Allocate(std::size_t numByte)
+{
+    if (!IsMapped(numByte))
+    {
+        return m_system.Allocate(numByte);
+    }
+
+#if defined(__linux__)
+    const std::size_t length = MappedLength(numByte);
+    void* pointer = MAP_FAILED;
+
+    if (m_policy.hugePage == HugePagePolicy::Explicit)
+    {
+        pointer = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+
+    const bool isHugeTLB = pointer != MAP_FAILED;
+
+    if (!isHugeTLB)
+    {
+        pointer = MapAligned(length, m_policy.hugePage == HugePagePolicy::None
+                                         ? SystemPageSize()
+                                         : HugePageSize);
+    }
+
+    if (!isHugeTLB && m_policy.hugePage != HugePagePolicy::None)
+    {
+        madvise(pointer, length, MADV_HUGEPAGE);
+    }
+
+    if (m_policy.numa == NUMAPolicy::Interleave)
+    {
+        // Every node; the system drops those the process may not use.
+        const unsigned long nodeMask = ~0ul;
+
+        syscall(SYS_mbind, pointer, length, InterleavePolicy, &nodeMask,
+                sizeof(nodeMask) * 8, 0);
+    }
+    else if (m_policy.numa == NUMAPolicy::ParallelFirstTouch)
+    {
+        TouchInParallel(static_cast<char*>(pointer), length,
+                        m_policy.hugePage == HugePagePolicy::None
+                            ? SystemPageSize()
+                            : HugePageSize);
+    }
+
+    return pointer;
+#else
+    return m_system.Allocate(numByte);
+#endif
+}
+
+void PageAllocator::Deallocate(void* pointer, std::size_t numByte) noexcept
+{
+    if (!IsMapped(numByte))
+    {
+        m_system.Deallocate(pointer, numByte);
+        return;
+    }
+
+#if defined(__linux__)
+    munmap(pointer, MappedLength(numByte));
+#else
+    m_system.Deallocate(pointer, numByte);
+#endif
+}
+
+const AllocationPolicy& PageAllocator::Policy() const noexcept
+{
+    return m_policy;
+}
+
+bool PageAllocator::IsMapped(std::size_t numByte) const noexcept
+{
+    return !m_policy.IsDefault() && numByte >= m_policy.minMappedByte;
+}
+
+std::size_t PageAllocator::MappedLength(std::size_t numByte) const noexcept
+{
+#if defined(__linux__)
+    const std::size_t pageSize = m_policy.hugePage == HugePagePolicy::None
+                                     ? SystemPageSize()
+                                     : HugePageSize;
+
+    return (numByte + pageSize - 1) / pageSize * pageSize;
+#else
+    return numByte;
+#endif
+}
+
+PoolAllocator::PoolAllocator(Allocator& upstream) : m_upstream(upstream)
+{
+    // Do nothing
+}
+
+PoolAllocator::~PoolAllocator() noexcept
+{
+    Trim();
+}
+
+void* PoolAllocator::Allocate(std::size_t numByte)
+{
+    const std::size_t classSize = ClassSize(numByte);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const auto iter = m_freeListMap.find(classSize);
+        if (iter != m_freeListMap.end() && !iter->second.empty())
+        {
+            void* pointer = iter->second.back();
+            iter->second.pop_back();
+
+            ++m_statistics.hitCount;
+            m_statistics.cachedByte -= classSize;
+
+            return pointer;
+        }
+
+        ++m_statistics.missCount;
+    }
+
+    try
+    {
+        return m_upstream.Allocate(classSize);
+    }
+    catch (const std::bad_alloc&)
+    {
+        // Blocks of other classes may be what stands in the way.
+        if (!Trim())
+        {
+            throw;
+        }
+
+        return m_upstream.Allocate(classSize);
+    }
+}
+
+void PoolAllocator::Deallocate(void* pointer, std::size_t numByte) noexcept
+{
+    const std::size_t classSize = ClassSize(numByte);
+
+    try
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_freeListMap[classSize].emplace_back(pointer);
+        m_statistics.cachedByte += classSize;
+    }
+    catch (...)
+    {
+        m_upstream.Deallocate(pointer, classSize);
+    }
+}
+
+PoolStatistics PoolAllocator::Statistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_statistics;
+}
+
+std::size_t PoolAllocator::Trim(std::size_t maxCachedByte)
+{
+    std::vector<std::pair<std::size_t, void*>> releaseList;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::vector<std::size_t> classSizeList;
+        for (const auto& pair : m_freeListMap)
+        {
+            classSizeList.emplace_back(pair.first);
+        }
+
+        std::sort(classSizeList.rbegin(), classSizeList.rend());
+
+        for (const auto classSize : classSizeList)
+        {
+            auto& freeList = m_freeListMap[classSize];
+
+            while (!freeList.empty() &&
+                   m_statistics.cachedByte > maxCachedByte)
+            {
+                releaseList.emplace_back(classSize, freeList.back());
+                freeList.pop_back();
+                m_statistics.cachedByte -= classSize;
+            }
+
+            if (freeList.empty())
+            {
+                m_freeListMap.erase(classSize);
+            }
+        }
+    }
+
+    std::size_t releasedByte = 0;
+
+    for (const auto& [classSize, pointer] : releaseList)
+    {
+        m_upstream.Deallocate(pointer, classSize);
+        releasedByte += classSize;
+    }
+
+    return releasedByte;
+}
+
+std::size_t PoolAllocator::ClassSize(std::size_t numByte) noexcept
+{
+    const std::size_t numLine =
+        std::max<std::size_t>((numByte + CacheLineSize - 1) / CacheLineSize,
+                              1);
+
+    if (numLine <= 4)
+    {
+        return numLine * CacheLineSize;
+    }
+
+    // Above four lines, each power of two is split into four classes.
+    std::size_t log2 = 0;
+    while ((numLine - 1) >> (log2 + 1))
+    {
+        ++log2;
+    }
+
+    const std::size_t step = std::size_t{ 1 } << (log2 - 2);
+
+    return (numLine + step - 1) / step * step * CacheLineSize;
+}
+
+Allocator& DefaultAllocator() noexcept
+{
+    Allocator* allocator = defaultAllocator.load(std::memory_order_acquire);
+
+    return allocator ? *allocator : StandardPool();
+}
+
+void SetDefaultAllocator(Allocator* allocator) noexcept
+{
+    defaultAllocator.store(allocator, std::memory_order_release);
+}
+
+PoolAllocator& StandardPool() noexcept
+{
+    // Never destroyed, so that buffers in static and thread-local storage can
+    // still be returned to it at exit.
+    static auto* systemAllocator = new SystemAllocator;
+    static auto* pool = new PoolAllocator(*systemAllocator);
+
+    return *pool;
+}
+}  // namespace CubbyDNN::Core
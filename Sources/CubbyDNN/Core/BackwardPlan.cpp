@@ -0,0 +1,200 @@
+#include <CubbyDNN/Core/BackwardPlan.hpp>
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Node.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace CubbyDNN::Core
+{
+BackwardPlan::BackwardPlan(Node::Node* target,
+                           const std::vector<Node::Node*>& sourceList)
+    : m_target(target), m_graphVersion(target->graph->Version())
+{
+    const auto* graph = target->graph;
+    const std::size_t numNode = graph->NodeCount();
+
+    // Over the nodes the target depends on, the longest path to each from a
+    // node without inputs.
+    std::vector<bool> isDepList(numNode);
+    std::vector<std::size_t> levelList(numNode);
+
+    for (auto* node : graph->SortDeps({ target }))
+    {
+        isDepList[node->Id()] = true;
+
+        for (const auto& pair : node->m_nodeInputMap)
+        {
+            if (const auto* input = pair.second->InputNode())
+            {
+                levelList[node->Id()] = std::max(levelList[node->Id()],
+                                                 levelList[input->Id()] + 1);
+            }
+        }
+    }
+
+    // The gradients the sources are accumulated from: those of the nodes
+    // that depend on a source and that the target depends on.
+    std::vector<bool> isInPlanList(numNode);
+    std::vector<Node::Node*> nodeList;
+
+    const auto addNode = [&](Node::Node* node) {
+        if (!isInPlanList[node->Id()])
+        {
+            isInPlanList[node->Id()] = true;
+            nodeList.emplace_back(node);
+        }
+    };
+
+    addNode(target);
+
+    for (auto* source : sourceList)
+    {
+        addNode(source);
+    }
+
+    for (auto* node : graph->SortRevDeps(sourceList))
+    {
+        if (isDepList[node->Id()])
+        {
+            addNode(node);
+        }
+    }
+
+    // How many consumers in the plan each node still waits for.
+    std::vector<std::size_t> numWaitingList(numNode);
+
+    for (const auto* node : nodeList)
+    {
+        for (const auto* revNodeInput : node->m_revNodeInputList)
+        {
+            numWaitingList[node->Id()] +=
+                isInPlanList[revNodeInput->node->Id()];
+        }
+    }
+
+    // Of the nodes whose consumers are all done, the one at the lowest
+    // level goes first. A parameter then comes right after the layer that
+    // reads it rather than at the very end, so that the layer's inputs,
+    // recomputed under checkpointing, can go early.
+    const auto isLater = [&](const Node::Node* lhs, const Node::Node* rhs) {
+        const std::size_t lhsLevel = levelList[lhs->Id()];
+        const std::size_t rhsLevel = levelList[rhs->Id()];
+
+        return lhsLevel != rhsLevel ? lhsLevel > rhsLevel
+                                    : lhs->Id() > rhs->Id();
+    };
+
+    std::vector<Node::Node*> readyList;
+
+    for (auto* node : nodeList)
+    {
+        if (!numWaitingList[node->Id()])
+        {
+            readyList.emplace_back(node);
+        }
+    }
+
+    std::make_heap(readyList.begin(), readyList.end(), isLater);
+
+    // The last step that reads each consumer's output.
+    std::vector<std::size_t> lastInputList(numNode, nodeList.size());
+
+    while (!readyList.empty())
+    {
+        std::pop_heap(readyList.begin(), readyList.end(), isLater);
+        auto* node = readyList.back();
+        readyList.pop_back();
+
+        Step step{ node, {}, {} };
+
+        for (const auto* revNodeInput : node->m_revNodeInputList)
+        {
+            if (isInPlanList[revNodeInput->node->Id()])
+            {
+                step.revNodeInputList.emplace_back(revNodeInput);
+                lastInputList[revNodeInput->node->Id()] = m_stepList.size();
+            }
+        }
+
+        m_stepList.emplace_back(std::move(step));
+
+        for (const auto& pair : node->m_nodeInputMap)
+        {
+            auto* input = pair.second->InputNode();
+
+            if (input && isInPlanList[input->Id()] &&
+                !--numWaitingList[input->Id()])
+            {
+                readyList.emplace_back(input);
+                std::push_heap(readyList.begin(), readyList.end(), isLater);
+            }
+        }
+    }
+
+    for (auto* node : nodeList)
+    {
+        if (lastInputList[node->Id()] < m_stepList.size())
+        {
+            m_stepList[lastInputList[node->Id()]].releaseList.emplace_back(
+                node);
+        }
+    }
+}
+
+void BackwardPlan::Run()
+{
+    const Node::Node::GradientScope scope(m_target->graph);
+
+    for (const auto& step : m_stepList)
+    {
+        auto* node = step.node;
+
+        if (node->m_isForwardOnly)
+        {
+            throw std::runtime_error("The memory plan of '" + node->name +
+                                     "' does not allow gradients");
+        }
+
+        node->PrepareGradient();
+
+        if (node == m_target)
+        {
+            node->m_gradient.GetSpan().FillOne();
+        }
+        else
+        {
+            node->m_gradient.GetSpan().FillZero();
+
+            for (const auto* revNodeInput : step.revNodeInputList)
+            {
+                revNodeInput->backwardOp(revNodeInput->node, m_target);
+            }
+        }
+
+        node->EvalGradientInternal();
+
+        for (auto* consumer : step.releaseList)
+        {
+            consumer->ReleaseOutput();
+        }
+
+        node->m_gradientDirty = m_target;
+    }
+}
+
+const Node::Node* BackwardPlan::Target() const noexcept
+{
+    return m_target;
+}
+
+bool BackwardPlan::IsCurrent() const noexcept
+{
+    return m_graphVersion == m_target->graph->Version();
+}
+
+std::size_t BackwardPlan::StepCount() const noexcept
+{
+    return m_stepList.size();
+}
+}  // namespace CubbyDNN::Core
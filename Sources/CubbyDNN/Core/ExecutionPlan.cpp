@@ -0,0 +1,175 @@
+#include <CubbyDNN/Core/ExecutionPlan.hpp>
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+#include <CubbyDNN/Node/Node.hpp>
+
+#include <functional>
+#include <stdexcept>
+
+namespace CubbyDNN::Core
+{
+ExecutionPlan::ExecutionPlan(const std::vector<Node::Node*>& targetList)
+    : m_targetList(targetList)
+{
+    if (targetList.empty())
+    {
+        throw std::runtime_error("An execution plan needs at least one target");
+    }
+
+    // The order Node::EvalOutput would evaluate them in, without
+    // recursing, so that deep graphs do not run out of stack.
+    const auto* graph = targetList.front()->graph;
+    std::vector<std::size_t> indexList(graph->NodeCount());
+
+    for (auto* node : graph->SortDeps(targetList))
+    {
+        const std::size_t index = m_stepList.size();
+        std::size_t numInput = 0;
+
+        for (const auto& pair : node->m_nodeInputMap)
+        {
+            if (auto* input = pair.second->InputNode())
+            {
+                m_stepList[indexList[input->Id()]].consumerList.emplace_back(
+                    index);
+                ++numInput;
+            }
+        }
+
+        indexList[node->Id()] = index;
+        m_stepList.push_back({ node, 0, numInput, {} });
+    }
+
+    m_numWaitingList =
+        std::make_unique<std::atomic<std::size_t>[]>(m_stepList.size());
+
+    EvalShape();
+}
+
+void ExecutionPlan::Run()
+{
+    UpdateShape();
+
+    for (const auto& step : m_stepList)
+    {
+        RunStep(step);
+    }
+}
+
+void ExecutionPlan::RunParallel()
+{
+    auto& pool = DefaultThreadPool();
+
+    if (pool.ThreadCount() == 1 ||
+        m_targetList.front()->graph->IsCheckpointing())
+    {
+        Run();
+        return;
+    }
+
+    UpdateShape();
+
+    for (std::size_t index = 0; index < m_stepList.size(); ++index)
+    {
+        m_numWaitingList[index].store(m_stepList[index].numInput,
+                                      std::memory_order_relaxed);
+    }
+
+    TaskGroup group(pool);
+    std::function<void(std::size_t)> runFrom;
+
+    // Runs a step, then queues the consumers it was the last input of. The
+    // first of them continues on this thread, so that a chain of nodes is
+    // not handed from thread to thread.
+    runFrom = [&](std::size_t index) {
+        while (index < m_stepList.size())
+        {
+            const auto& step = m_stepList[index];
+            std::size_t next = m_stepList.size();
+
+            RunStep(step);
+
+            for (const auto consumer : step.consumerList)
+            {
+                // Acquires the outputs of the other inputs, which were
+                // released by their own decrement.
+                if (m_numWaitingList[consumer].fetch_sub(
+                        1, std::memory_order_acq_rel) != 1)
+                {
+                    continue;
+                }
+
+                if (next == m_stepList.size())
+                {
+                    next = consumer;
+                }
+                else
+                {
+                    group.Run([&runFrom, consumer] { runFrom(consumer); });
+                }
+            }
+
+            index = next;
+        }
+    };
+
+    for (std::size_t index = 0; index < m_stepList.size(); ++index)
+    {
+        if (!m_stepList[index].numInput)
+        {
+            group.Run([&runFrom, index] { runFrom(index); });
+        }
+    }
+
+    group.Wait();
+}
+
+std::size_t ExecutionPlan::StepCount() const noexcept
+{
+    return m_stepList.size();
+}
+
+void ExecutionPlan::UpdateShape()
+{
+    for (const auto* target : m_targetList)
+    {
+        // A changed shape marks every node that depends on it, the targets
+        // among them.
+        if (target->m_isShapeDirty)
+        {
+            EvalShape();
+            return;
+        }
+    }
+}
+
+void ExecutionPlan::EvalShape()
+{
+    for (auto* target : m_targetList)
+    {
+        target->EvalShape();
+    }
+
+    for (auto& step : m_stepList)
+    {
+        step.size = step.node->Shape().Size();
+    }
+}
+
+void ExecutionPlan::RunStep(const Step& step)
+{
+    if (!step.node->m_isOutputDirty)
+    {
+        return;
+    }
+
+    if (!step.numInput)
+    {
+        step.node->EvalOutput();
+    }
+    else
+    {
+        step.node->ComputeOutput(step.size);
+    }
+}
+}  // namespace CubbyDNN::Core
@@ -1,10 +1,84 @@
 #include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Dense.hpp>
+#include <CubbyDNN/Node/FusedSoftmaxCE.hpp>
 #include <CubbyDNN/Node/Input.hpp>
+#include <CubbyDNN/Node/Parameter.hpp>
+#include <CubbyDNN/Node/ReLU.hpp>
+#include <CubbyDNN/Node/Softmax.hpp>
+#include <CubbyDNN/Node/SoftmaxCE.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 namespace CubbyDNN::Core
 {
-Graph::Graph() : m_graphBuilder(this)
+namespace
+{
+// Depth-first from the roots along the nodes forEachNext(node, visit)
+// visits, a node placed once every node it leads to is. Iterative, so that
+// deep graphs do not run out of stack, and linear in the nodes and edges
+// reached.
+template <typename ForEachNext>
+std::vector<Node::Node*> SortFrom(std::size_t numNode,
+                                  const std::vector<Node::Node*>& rootList,
+                                  ForEachNext forEachNext)
+{
+    std::vector<Node::Node*> result;
+    std::vector<bool> isPlaced(numNode);
+    std::vector<std::pair<Node::Node*, bool>> stack;
+
+    for (auto iter = rootList.rbegin(); iter != rootList.rend(); ++iter)
+    {
+        stack.emplace_back(*iter, false);
+    }
+
+    while (!stack.empty())
+    {
+        const auto [node, isExpanded] = stack.back();
+        stack.pop_back();
+
+        if (isPlaced[node->Id()])
+        {
+            continue;
+        }
+
+        if (isExpanded)
+        {
+            isPlaced[node->Id()] = true;
+            result.emplace_back(node);
+            continue;
+        }
+
+        stack.emplace_back(node, true);
+        forEachNext(node, [&](Node::Node* next) {
+            if (!isPlaced[next->Id()])
+            {
+                stack.emplace_back(next, false);
+            }
+        });
+    }
+
+    return result;
+}
+}  // namespace
+
+Graph::Graph() : Graph(AllocationPolicy{})
+{
+    // Do nothing
+}
+
+Graph::Graph(const AllocationPolicy& allocationPolicy)
+    : m_allocationPolicy(allocationPolicy),
+      m_graphBuilder(this),
+      m_depsNode(nullptr),
+      m_version(0)
 {
+    if (!m_allocationPolicy.IsDefault())
+    {
+        m_pageAllocator = std::make_unique<PageAllocator>(m_allocationPolicy);
+        m_bufferPool = std::make_unique<PoolAllocator>(*m_pageAllocator);
+    }
+
     m_graphBuilder.RegisterStandardNodeType();
 }
 
@@ -13,6 +87,16 @@ GraphBuilder& Graph::Builder() noexcept
     return m_graphBuilder;
 }
 
+const AllocationPolicy& Graph::GetAllocationPolicy() const noexcept
+{
+    return m_allocationPolicy;
+}
+
+Allocator& Graph::BufferAllocator() const noexcept
+{
+    return m_bufferPool ? *m_bufferPool : DefaultAllocator();
+}
+
 void Graph::Feed(const std::vector<std::tuple<std::string, Shape, Span<float>>>&
                      feedDataList) const
 {
@@ -23,9 +107,21 @@ void Graph::Feed(const std::vector<std::tuple<std::string, Shape, Span<float>>>&
     }
 }
 
+std::size_t Graph::NodeCount() const noexcept
+{
+    return m_nodeList.size();
+}
+
+std::size_t Graph::Version() const noexcept
+{
+    return m_version;
+}
+
 std::size_t Graph::NodeCount(const Node::NodeType* nodeType) const
 {
-    return m_nodeTypeMap.count(nodeType);
+    const auto iter = m_nodeCountMap.find(nodeType);
+
+    return iter == m_nodeCountMap.cend() ? 0 : iter->second;
 }
 
 Node::Node* Graph::Node(const std::string& nodeName) const
@@ -34,4 +130,318 @@ Node::Node* Graph::Node(const std::string& nodeName) const
 
     return iter == m_nodeMap.cend() ? nullptr : iter->second.get();
 }
-}  // namespace CubbyDNN::Core
\ No newline at end of file
+
+std::vector<Node::Node*> Graph::SortDeps(
+    const std::vector<Node::Node*>& targetList) const
+{
+    return SortFrom(m_nodeList.size(), targetList, [](Node::Node* node,
+                                                      const auto& visit) {
+        for (const auto& pair : node->m_nodeInputMap)
+        {
+            if (auto* input = pair.second->InputNode())
+            {
+                visit(input);
+            }
+        }
+    });
+}
+
+std::vector<Node::Node*> Graph::SortRevDeps(
+    const std::vector<Node::Node*>& sourceList) const
+{
+    return SortFrom(m_nodeList.size(), sourceList, [](Node::Node* node,
+                                                      const auto& visit) {
+        for (const auto* revNodeInput : node->m_revNodeInputList)
+        {
+            visit(revNodeInput->node);
+        }
+    });
+}
+
+bool Graph::IsDependOn(const Node::Node* node, const Node::Node* dep) const
+{
+    if (m_depsNode != node)
+    {
+        m_depsMask.assign(m_nodeList.size(), false);
+
+        std::vector<const Node::Node*> stack{ node };
+
+        while (!stack.empty())
+        {
+            const auto* next = stack.back();
+            stack.pop_back();
+
+            for (const auto& pair : next->m_nodeInputMap)
+            {
+                const auto* input = pair.second->InputNode();
+
+                if (input && !m_depsMask[input->Id()])
+                {
+                    m_depsMask[input->Id()] = true;
+                    stack.emplace_back(input);
+                }
+            }
+        }
+
+        m_depsNode = node;
+    }
+
+    // Nodes created after the mask was built have no consumers yet.
+    return dep->Id() < m_depsMask.size() && m_depsMask[dep->Id()];
+}
+
+ExecutionPlan Graph::Compile(
+    const std::vector<Node::NodeWrapper>& targetList) const
+{
+    std::vector<Node::Node*> nodeList;
+
+    for (const auto& target : targetList)
+    {
+        nodeList.emplace_back(target.node);
+    }
+
+    return ExecutionPlan(nodeList);
+}
+
+BackwardPlan Graph::CompileBackward(
+    const Node::NodeWrapper& target,
+    const std::vector<Node::NodeWrapper>& sourceList) const
+{
+    std::vector<Node::Node*> nodeList;
+
+    for (const auto& source : sourceList)
+    {
+        nodeList.emplace_back(source.node);
+    }
+
+    return BackwardPlan(target.node, nodeList);
+}
+
+std::vector<Node::Node*> Graph::Fuse(
+    const std::vector<Node::NodeWrapper>& targetList)
+{
+    if (m_memoryPlan || IsCheckpointing())
+    {
+        throw std::runtime_error(
+            "Nodes cannot be fused under a memory plan or checkpointing");
+    }
+
+    std::vector<Node::Node*> resultList;
+
+    for (const auto& target : targetList)
+    {
+        resultList.emplace_back(target.node);
+    }
+
+    const auto isA = [](const Node::NodeType* nodeType,
+                        const Node::Node* node) {
+        return node && nodeType->IsBaseOf(node->Type());
+    };
+
+    // The first node of a chain: one that nothing but the last reads.
+    const auto isInner = [&resultList](const Node::Node* node) {
+        return node->m_revNodeInputList.size() == 1 &&
+               std::find(resultList.begin(), resultList.end(), node) ==
+                   resultList.end();
+    };
+
+    const auto detach = [](Node::Node* node) {
+        for (const auto& pair : node->m_nodeInputMap)
+        {
+            pair.second->Detach();
+        }
+
+        node->m_output = Memory<float>();
+        node->m_gradient = Memory<float>();
+    };
+
+    // In the order the consumers were attached, so that gradients are
+    // accumulated in the same order as before.
+    const auto replace = [&resultList](Node::Node* node, Node::Node* fused) {
+        const auto revNodeInputList = node->m_revNodeInputList;
+
+        for (auto* revNodeInput : revNodeInputList)
+        {
+            revNodeInput->Detach();
+            revNodeInput->Attach(fused);
+        }
+
+        std::replace(resultList.begin(), resultList.end(), node, fused);
+    };
+
+    for (auto* node : SortDeps(resultList))
+    {
+        if (isA(nodeTypeManager.Type<Node::ReLU>(), node))
+        {
+            auto* relu = static_cast<Node::ReLU*>(node);
+            auto* dense = (*relu)["logit"]->InputNode();
+
+            if (relu->alpha >= 0.0f &&
+                isA(nodeTypeManager.Type<Node::Dense>(), dense) &&
+                isInner(dense))
+            {
+                auto* input = (*dense)["input"]->InputNode();
+                auto* weight = (*dense)["weight"]->InputNode();
+                auto* bias = (*dense)["bias"]->InputNode();
+
+                detach(relu);
+                detach(dense);
+                replace(relu, m_graphBuilder.FusedDense(input, weight, bias,
+                                                        relu->alpha));
+                continue;
+            }
+
+            // The rest of the chain is fused from its last node.
+            if (isInner(node) &&
+                isA(nodeTypeManager.Type<Node::ReLU>(),
+                    node->m_revNodeInputList.front()->node))
+            {
+                continue;
+            }
+
+            std::vector<Node::Node*> chain{ node };
+
+            while (isA(nodeTypeManager.Type<Node::ReLU>(),
+                       (*chain.back())["logit"]->InputNode()) &&
+                   isInner((*chain.back())["logit"]->InputNode()))
+            {
+                chain.emplace_back((*chain.back())["logit"]->InputNode());
+            }
+
+            if (chain.size() < 2)
+            {
+                continue;
+            }
+
+            auto* input = (*chain.back())["logit"]->InputNode();
+            std::vector<Compute::ElementwiseOp> opList;
+
+            for (auto iter = chain.rbegin(); iter != chain.rend(); ++iter)
+            {
+                opList.push_back({ Compute::ElementwiseType::ReLU,
+                                   static_cast<Node::ReLU*>(*iter)->alpha });
+                detach(*iter);
+            }
+
+            replace(node, m_graphBuilder.FusedElementwise(input, opList));
+        }
+        else if (isA(nodeTypeManager.Type<Node::SoftmaxCE>(), node))
+        {
+            auto* softmax = (*node)["prob"]->InputNode();
+
+            if (!isA(nodeTypeManager.Type<Node::Softmax>(), softmax) ||
+                !isInner(softmax) ||
+                !Node::FusedSoftmaxCE::IsFusable(
+                    static_cast<Node::Softmax*>(softmax)->groupAxis))
+            {
+                continue;
+            }
+
+            auto* label = (*node)["label"]->InputNode();
+            auto* logit = (*softmax)["logit"]->InputNode();
+
+            detach(node);
+            detach(softmax);
+            replace(node, m_graphBuilder.FusedSoftmaxCE(
+                              label, logit,
+                              static_cast<Node::Softmax*>(softmax)->groupAxis));
+        }
+    }
+
+    return resultList;
+}
+
+const MemoryPlan& Graph::PlanMemory(
+    const std::vector<Node::NodeWrapper>& targetList, PlanMode mode)
+{
+    std::vector<Node::Node*> nodeList;
+
+    for (const auto& target : targetList)
+    {
+        nodeList.emplace_back(target.node);
+    }
+
+    // The nodes get their own buffers back before the new plan measures them.
+    m_memoryPlan.reset();
+    m_memoryPlan = std::make_unique<MemoryPlan>(nodeList, mode);
+
+    return *m_memoryPlan;
+}
+
+void Graph::ClearMemoryPlan()
+{
+    m_memoryPlan.reset();
+}
+
+void Graph::EnableCheckpointing(
+    const Node::NodeWrapper& target,
+    const std::vector<Node::NodeWrapper>& checkpointList)
+{
+    DisableCheckpointing();
+
+    for (auto* node : SortDeps({ target.node }))
+    {
+        if (node == target.node)
+        {
+            continue;
+        }
+
+        const bool isCheckpoint = std::any_of(
+            checkpointList.begin(), checkpointList.end(),
+            [node](const Node::NodeWrapper& checkpoint) {
+                return checkpoint.node == node;
+            });
+
+        if (!isCheckpoint &&
+            !nodeTypeManager.Type<Node::Input>()->IsBaseOf(node->Type()) &&
+            !nodeTypeManager.Type<Node::Parameter>()->IsBaseOf(node->Type()))
+        {
+            node->m_isRecomputable = true;
+            m_recomputableList.emplace_back(node);
+        }
+    }
+}
+
+void Graph::EnableCheckpointing(const Node::NodeWrapper& target)
+{
+    std::vector<Node::Node*> nodeList;
+
+    // In evaluation order.
+    for (auto* node : SortDeps({ target.node }))
+    {
+        if (node != target.node &&
+            !nodeTypeManager.Type<Node::Input>()->IsBaseOf(node->Type()) &&
+            !nodeTypeManager.Type<Node::Parameter>()->IsBaseOf(node->Type()))
+        {
+            nodeList.emplace_back(node);
+        }
+    }
+
+    const auto interval = static_cast<std::size_t>(
+        std::ceil(std::sqrt(static_cast<double>(nodeList.size()))));
+    std::vector<Node::NodeWrapper> checkpointList;
+
+    for (std::size_t index = interval; index <= nodeList.size();
+         index += interval)
+    {
+        checkpointList.emplace_back(nodeList[index - 1]);
+    }
+
+    EnableCheckpointing(target, checkpointList);
+}
+
+void Graph::DisableCheckpointing()
+{
+    for (auto* node : m_recomputableList)
+    {
+        node->m_isRecomputable = false;
+    }
+
+    m_recomputableList.clear();
+}
+
+bool Graph::IsCheckpointing() const noexcept
+{
+    return !m_recomputableList.empty();
+}
+}  // namespace CubbyDNN::Core
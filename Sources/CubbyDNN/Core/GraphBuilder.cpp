@@ -3,8 +3,12 @@
 #include <CubbyDNN/Initializer/Constant.hpp>
 #include <CubbyDNN/Initializer/Xavier.hpp>
 #include <CubbyDNN/Node/Dense.hpp>
+#include <CubbyDNN/Node/FusedDense.hpp>
+#include <CubbyDNN/Node/FusedElementwise.hpp>
+#include <CubbyDNN/Node/FusedSoftmaxCE.hpp>
 #include <CubbyDNN/Node/Input.hpp>
 #include <CubbyDNN/Node/Parameter.hpp>
+#include <CubbyDNN/Node/QuantizedDense.hpp>
 #include <CubbyDNN/Node/ReLU.hpp>
 #include <CubbyDNN/Node/Softmax.hpp>
 #include <CubbyDNN/Node/SoftmaxCE.hpp>
@@ -13,7 +17,7 @@
 #include <sstream>
 
 template <typename T>
-constexpr std::string GetDefaultName(CubbyDNN::Core::Graph* graph)
+std::string GetDefaultName(CubbyDNN::Core::Graph* graph)
 {
     return (std::ostringstream{} << T::TypeName() << graph->NodeCount<T>())
         .str();
@@ -35,8 +39,13 @@ void GraphBuilder::RegisterStandardNodeType()
     graph->nodeTypeManager.RegisterNode<Node::Softmax>();
 
     graph->nodeTypeManager.RegisterNode<Node::Dense>();
+    graph->nodeTypeManager.RegisterNode<Node::QuantizedDense>();
 
     graph->nodeTypeManager.RegisterNode<Node::SoftmaxCE>();
+
+    graph->nodeTypeManager.RegisterNode<Node::FusedDense>();
+    graph->nodeTypeManager.RegisterNode<Node::FusedSoftmaxCE>();
+    graph->nodeTypeManager.RegisterNode<Node::FusedElementwise>();
 }
 
 Node::NodeWrapper GraphBuilder::Input(const std::string& nodeName)
@@ -46,10 +55,10 @@ Node::NodeWrapper GraphBuilder::Input(const std::string& nodeName)
 
 Node::NodeWrapper GraphBuilder::Parameter(
     const std::string& nodeName, const Shape& shape,
-    Initializer::InitializerWrapper initializer)
+    Initializer::InitializerWrapper initializer, Precision precision)
 {
-    return Node::NodeWrapper(
-        graph->CreateNode<Node::Parameter>(nodeName, shape, initializer));
+    return Node::NodeWrapper(graph->CreateNode<Node::Parameter>(
+        nodeName, shape, initializer, precision));
 }
 
 Initializer::InitializerWrapper GraphBuilder::InitConstant(float constant)
@@ -93,6 +102,20 @@ Node::NodeWrapper GraphBuilder::Dense(Node::NodeWrapper input,
     return node;
 }
 
+Node::NodeWrapper GraphBuilder::QuantizedDense(Node::NodeWrapper input,
+                                               Node::NodeWrapper weight,
+                                               Node::NodeWrapper bias)
+{
+    Node::NodeWrapper node(graph->CreateNode<Node::QuantizedDense>(
+        GetDefaultName<Node::QuantizedDense>(graph)));
+
+    node["input"]->Attach(input);
+    node["weight"]->Attach(weight);
+    node["bias"]->Attach(bias);
+
+    return node;
+}
+
 Node::NodeWrapper GraphBuilder::SoftmaxCE(Node::NodeWrapper label,
                                           Node::NodeWrapper prob)
 {
@@ -105,6 +128,48 @@ Node::NodeWrapper GraphBuilder::SoftmaxCE(Node::NodeWrapper label,
     return node;
 }
 
+Node::NodeWrapper GraphBuilder::FusedDense(Node::NodeWrapper input,
+                                           Node::NodeWrapper weight,
+                                           Node::NodeWrapper bias, float alpha)
+{
+    Node::NodeWrapper node(graph->CreateNode<Node::FusedDense>(
+        GetDefaultName<Node::FusedDense>(graph), alpha));
+
+    node["input"]->Attach(input);
+    node["weight"]->Attach(weight);
+
+    if (bias.node)
+    {
+        node["bias"]->Attach(bias);
+    }
+
+    return node;
+}
+
+Node::NodeWrapper GraphBuilder::FusedSoftmaxCE(
+    Node::NodeWrapper label, Node::NodeWrapper logit,
+    const std::vector<bool>& reduceAxis)
+{
+    Node::NodeWrapper node(graph->CreateNode<Node::FusedSoftmaxCE>(
+        GetDefaultName<Node::FusedSoftmaxCE>(graph), reduceAxis));
+
+    node["label"]->Attach(label);
+    node["logit"]->Attach(logit);
+
+    return node;
+}
+
+Node::NodeWrapper GraphBuilder::FusedElementwise(
+    Node::NodeWrapper input, const std::vector<Compute::ElementwiseOp>& opList)
+{
+    Node::NodeWrapper node(graph->CreateNode<Node::FusedElementwise>(
+        GetDefaultName<Node::FusedElementwise>(graph), opList));
+
+    node["input"]->Attach(input);
+
+    return node;
+}
+
 Initializer::InitializerWrapper GraphBuilder::InitXavier(
     std::mt19937_64::result_type seed, std::size_t fanIn, std::size_t fanOut)
 {
@@ -0,0 +1,307 @@
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Core/MemoryPlan.hpp>
+#include <CubbyDNN/Node/Input.hpp>
+#include <CubbyDNN/Node/Parameter.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace CubbyDNN::Core
+{
+namespace
+{
+// Buffers are placed on cache lines, like every Memory allocation.
+constexpr std::size_t LineLength = CacheLineSize / sizeof(float);
+
+std::size_t RoundToLine(std::size_t size) noexcept
+{
+    return (size + LineLength - 1) / LineLength * LineLength;
+}
+
+template <typename T>
+bool IsA(const Node::Node* node)
+{
+    const auto* nodeType = node->graph->nodeTypeManager.Type<T>();
+
+    return nodeType && nodeType->IsBaseOf(node->Type());
+}
+}  // namespace
+
+MemoryPlan::MemoryPlan(const std::vector<Node::Node*>& targetList,
+                       PlanMode mode)
+    : m_mode(mode), m_naiveSize(0)
+{
+    if (targetList.empty())
+    {
+        throw std::runtime_error("A memory plan needs at least one target");
+    }
+
+    if (mode == PlanMode::Training && targetList.size() != 1)
+    {
+        throw std::runtime_error(
+            "A training memory plan takes the loss as its only target");
+    }
+
+    for (auto* target : targetList)
+    {
+        target->EvalShape();
+    }
+
+    auto* graph = targetList.front()->graph;
+    const auto nodeList = graph->SortDeps(targetList);
+    const std::unordered_set<Node::Node*> targetSet(targetList.begin(),
+                                                    targetList.end());
+
+    // Positions in nodeList by node id, or nodeList.size() for the nodes
+    // outside of it.
+    std::vector<std::size_t> positionList(graph->NodeCount(),
+                                          nodeList.size());
+
+    for (std::size_t position = 0; position < nodeList.size(); ++position)
+    {
+        auto* node = nodeList[position];
+        positionList[node->Id()] = position;
+
+        if (!targetSet.count(node) && !IsA<Node::Input>(node) &&
+            !IsA<Node::Parameter>(node) && node->Shape().Size())
+        {
+            m_bufferList.push_back({ node, node->Shape().Size(), 0 });
+        }
+    }
+
+    // For each of nodeList, a bitset of the positions of the nodes it
+    // depends on, for outputs, or of those that depend on it, for
+    // gradients: the nodes evaluated before it in any order.
+    const std::size_t numWord = (nodeList.size() + 63) / 64;
+    std::vector<std::uint64_t> beforeList(nodeList.size() * numWord);
+
+    const auto isBefore = [&](std::size_t position, std::size_t prev) {
+        return (beforeList[position * numWord + prev / 64] >> (prev % 64)) &
+               1;
+    };
+
+    const auto addBefore = [&](std::size_t position, const Node::Node* prev) {
+        const std::size_t prevPosition = positionList[prev->Id()];
+
+        if (prevPosition == nodeList.size())
+        {
+            return;
+        }
+
+        auto* before = &beforeList[position * numWord];
+        const auto* prevBefore = &beforeList[prevPosition * numWord];
+
+        before[prevPosition / 64] |= std::uint64_t{ 1 } << (prevPosition % 64);
+
+        for (std::size_t index = 0; index < numWord; ++index)
+        {
+            before[index] |= prevBefore[index];
+        }
+    };
+
+    if (mode == PlanMode::Inference)
+    {
+        for (std::size_t position = 0; position < nodeList.size(); ++position)
+        {
+            for (const auto& pair : nodeList[position]->m_nodeInputMap)
+            {
+                if (const auto* input = pair.second->InputNode())
+                {
+                    addBefore(position, input);
+                }
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t position = nodeList.size(); position-- > 0;)
+        {
+            for (const auto* revNodeInput :
+                 nodeList[position]->m_revNodeInputList)
+            {
+                addBefore(position, revNodeInput->node);
+            }
+        }
+    }
+
+    // Who reads a buffer after it is written: the consumers of an output,
+    // and the inputs whose gradients are accumulated from a gradient.
+    std::vector<std::vector<Node::Node*>> readerList;
+
+    for (const auto& buffer : m_bufferList)
+    {
+        std::vector<Node::Node*> readers;
+
+        if (mode == PlanMode::Inference)
+        {
+            for (const auto* revNodeInput : buffer.node->m_revNodeInputList)
+            {
+                readers.emplace_back(revNodeInput->node);
+            }
+        }
+        else
+        {
+            for (const auto& pair : buffer.node->m_nodeInputMap)
+            {
+                readers.emplace_back(pair.second->InputNode());
+            }
+        }
+
+        readerList.emplace_back(std::move(readers));
+    }
+
+    // Node evaluates every input before writing its output, and every
+    // gradient it accumulates from before writing its gradient, so index's
+    // buffer is dead once other's is written if other is evaluated after
+    // all of index's readers.
+    const auto isDeadBefore = [&](std::size_t index, std::size_t other) {
+        const std::size_t position =
+            positionList[m_bufferList[other].node->Id()];
+
+        return std::all_of(readerList[index].begin(), readerList[index].end(),
+                           [&](const Node::Node* reader) {
+                               const std::size_t readerPosition =
+                                   reader ? positionList[reader->Id()]
+                                          : nodeList.size();
+
+                               return readerPosition < nodeList.size() &&
+                                      isBefore(position, readerPosition);
+                           });
+    };
+
+    const auto canShare = [&](std::size_t lhs, std::size_t rhs) {
+        return isDeadBefore(lhs, rhs) || isDeadBefore(rhs, lhs);
+    };
+
+    // Largest buffers first, each at the lowest offset clear of every
+    // placed buffer it cannot share with.
+    std::vector<std::size_t> order(m_bufferList.size());
+
+    for (std::size_t index = 0; index < order.size(); ++index)
+    {
+        order[index] = index;
+    }
+
+    std::stable_sort(order.begin(), order.end(),
+                     [this](std::size_t lhs, std::size_t rhs) {
+                         return m_bufferList[lhs].size >
+                                m_bufferList[rhs].size;
+                     });
+
+    std::vector<std::size_t> placedList;
+    std::size_t arenaSize = 0;
+
+    for (const auto index : order)
+    {
+        const std::size_t size = RoundToLine(m_bufferList[index].size);
+        std::vector<std::pair<std::size_t, std::size_t>> occupied;
+
+        for (const auto placed : placedList)
+        {
+            if (!canShare(index, placed))
+            {
+                occupied.emplace_back(
+                    m_bufferList[placed].offset,
+                    RoundToLine(m_bufferList[placed].size));
+            }
+        }
+
+        std::sort(occupied.begin(), occupied.end());
+
+        std::size_t offset = 0;
+
+        for (const auto& [begin, length] : occupied)
+        {
+            if (offset + size <= begin)
+            {
+                break;
+            }
+
+            offset = std::max(offset, begin + length);
+        }
+
+        m_bufferList[index].offset = offset;
+        m_naiveSize += size * sizeof(float);
+        arenaSize = std::max(arenaSize, offset + size);
+        placedList.emplace_back(index);
+    }
+
+    m_arena = Memory<float>(arenaSize, graph->BufferAllocator());
+
+    for (std::size_t index = 0; index < m_bufferList.size(); ++index)
+    {
+        auto& buffer = m_bufferList[index];
+
+        PlannedMemory(buffer.node) = Memory<float>::View(
+            m_arena.GetSpan().begin() + buffer.offset, buffer.size);
+
+        if (mode == PlanMode::Inference)
+        {
+            buffer.node->m_isOutputDirty = true;
+            buffer.node->m_isForwardOnly = true;
+        }
+
+        buffer.node->m_gradientDirty = nullptr;
+
+        for (std::size_t other = 0; other < m_bufferList.size(); ++other)
+        {
+            const auto& otherBuffer = m_bufferList[other];
+
+            if (other != index &&
+                buffer.offset < otherBuffer.offset + otherBuffer.size &&
+                otherBuffer.offset < buffer.offset + buffer.size)
+            {
+                (mode == PlanMode::Inference
+                     ? buffer.node->m_outputAliasList
+                     : buffer.node->m_gradientAliasList)
+                    .emplace_back(otherBuffer.node);
+            }
+        }
+    }
+}
+
+MemoryPlan::~MemoryPlan() noexcept
+{
+    for (const auto& buffer : m_bufferList)
+    {
+        PlannedMemory(buffer.node) = Memory<float>();
+
+        if (m_mode == PlanMode::Inference)
+        {
+            buffer.node->m_isOutputDirty = true;
+        }
+
+        buffer.node->m_gradientDirty = nullptr;
+        buffer.node->m_outputAliasList.clear();
+        buffer.node->m_gradientAliasList.clear();
+        buffer.node->m_isForwardOnly = false;
+    }
+}
+
+PlanMode MemoryPlan::Mode() const noexcept
+{
+    return m_mode;
+}
+
+std::size_t MemoryPlan::BufferCount() const noexcept
+{
+    return m_bufferList.size();
+}
+
+std::size_t MemoryPlan::NaiveSize() const noexcept
+{
+    return m_naiveSize;
+}
+
+std::size_t MemoryPlan::PlannedSize() const noexcept
+{
+    return m_arena.Size() * sizeof(float);
+}
+
+Memory<float>& MemoryPlan::PlannedMemory(Node::Node* node) const noexcept
+{
+    return m_mode == PlanMode::Inference ? node->m_output : node->m_gradient;
+}
+}  // namespace CubbyDNN::Core
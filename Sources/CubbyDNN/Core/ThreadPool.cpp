@@ -0,0 +1,297 @@
+#include <CubbyDNN/Core/ThreadPool.hpp>
+
+#include <algorithm>
+
+namespace CubbyDNN::Core
+{
+namespace
+{
+std::atomic<ThreadPool*> defaultThreadPool{ nullptr };
+
+// The pool the calling thread is a worker of, and its index there.
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local std::size_t currentIndex = 0;
+}  // namespace
+
+ThreadPool::ThreadPool(std::size_t numThread)
+    : m_numTask(0), m_isStopping(false)
+{
+    numThread = std::max<std::size_t>(numThread, 1);
+
+    for (std::size_t index = 0; index < numThread; ++index)
+    {
+        m_queueList.emplace_back(std::make_unique<Queue>());
+    }
+
+    for (std::size_t index = 0; index + 1 < numThread; ++index)
+    {
+        m_workerList.emplace_back([this, index] { WorkerLoop(index); });
+    }
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_isStopping = true;
+    }
+
+    m_wakeCondition.notify_all();
+
+    for (auto& worker : m_workerList)
+    {
+        worker.join();
+    }
+}
+
+std::size_t ThreadPool::ThreadCount() const noexcept
+{
+    return m_queueList.size();
+}
+
+void ThreadPool::ParallelFor(
+    std::size_t count, std::size_t grain, std::size_t numThread,
+    const std::function<void(std::size_t, std::size_t)>& body)
+{
+    grain = std::max<std::size_t>(grain, 1);
+    numThread = std::min({ numThread, (count + grain - 1) / grain,
+                           ThreadCount() });
+
+    if (numThread <= 1)
+    {
+        for (std::size_t begin = 0; begin < count; begin += grain)
+        {
+            body(begin, std::min(count, begin + grain));
+        }
+
+        return;
+    }
+
+    // numThread - 1 tasks and the calling thread take ranges until none
+    // are left; a task that starts late finds none and returns at once.
+    std::atomic<std::size_t> next{ 0 };
+
+    const auto run = [&] {
+        for (;;)
+        {
+            const std::size_t begin =
+                next.fetch_add(grain, std::memory_order_relaxed);
+
+            if (begin >= count)
+            {
+                return;
+            }
+
+            body(begin, std::min(count, begin + grain));
+        }
+    };
+
+    TaskGroup group(*this);
+
+    for (std::size_t index = 1; index < numThread; ++index)
+    {
+        group.Run(run);
+    }
+
+    run();
+    group.Wait();
+}
+
+std::size_t ThreadPool::QueueIndex() const noexcept
+{
+    return currentPool == this ? currentIndex : m_queueList.size() - 1;
+}
+
+void ThreadPool::Push(Task task)
+{
+    {
+        auto& queue = *m_queueList[QueueIndex()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.taskList.emplace_back(std::move(task));
+    }
+
+    m_numTask.fetch_add(1, std::memory_order_release);
+
+    // Taking the lock orders the notification after a worker that found no
+    // task has started waiting, so it cannot be missed.
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+
+    m_wakeCondition.notify_one();
+}
+
+bool ThreadPool::Pop(Task& task)
+{
+    if (!m_numTask.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    const std::size_t own = QueueIndex();
+
+    // The newest task of its own queue first, which keeps a task's nested
+    // loop on the thread that started it, then the oldest of the others.
+    for (std::size_t offset = 0; offset < m_queueList.size(); ++offset)
+    {
+        auto& queue = *m_queueList[(own + offset) % m_queueList.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (queue.taskList.empty())
+        {
+            continue;
+        }
+
+        if (offset == 0)
+        {
+            task = std::move(queue.taskList.back());
+            queue.taskList.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.taskList.front());
+            queue.taskList.pop_front();
+        }
+
+        m_numTask.fetch_sub(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool ThreadPool::RunOne()
+{
+    Task task;
+
+    if (!Pop(task))
+    {
+        return false;
+    }
+
+    std::exception_ptr exception;
+
+    try
+    {
+        task.function();
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+
+    // Whatever the task holds goes before its group may be gone.
+    task.function = nullptr;
+    task.group->Finish(exception);
+
+    return true;
+}
+
+void ThreadPool::WorkerLoop(std::size_t index)
+{
+    currentPool = this;
+    currentIndex = index;
+
+    for (;;)
+    {
+        if (RunOne())
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wakeCondition.wait(lock, [this] {
+            return m_isStopping || m_numTask.load(std::memory_order_acquire);
+        });
+
+        if (m_isStopping)
+        {
+            return;
+        }
+    }
+}
+
+TaskGroup::TaskGroup(ThreadPool& pool) : m_pool(pool), m_numPending(0)
+{
+    // Do nothing
+}
+
+TaskGroup::~TaskGroup() noexcept
+{
+    try
+    {
+        Wait();
+    }
+    catch (...)
+    {
+        // Dropped, as documented.
+    }
+}
+
+void TaskGroup::Run(std::function<void()> task)
+{
+    m_numPending.fetch_add(1, std::memory_order_relaxed);
+    m_pool.Push({ std::move(task), this });
+}
+
+void TaskGroup::Wait()
+{
+    while (m_numPending.load(std::memory_order_acquire))
+    {
+        if (!m_pool.RunOne())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    std::exception_ptr exception;
+
+    {
+        std::lock_guard<std::mutex> lock(m_exceptionMutex);
+        std::swap(exception, m_exception);
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+void TaskGroup::Finish(std::exception_ptr exception) noexcept
+{
+    if (exception)
+    {
+        std::lock_guard<std::mutex> lock(m_exceptionMutex);
+
+        if (!m_exception)
+        {
+            m_exception = exception;
+        }
+    }
+
+    m_numPending.fetch_sub(1, std::memory_order_release);
+}
+
+ThreadPool& DefaultThreadPool() noexcept
+{
+    ThreadPool* pool = defaultThreadPool.load(std::memory_order_acquire);
+
+    if (pool)
+    {
+        return *pool;
+    }
+
+    // Never destroyed, like the standard allocator pool: its workers may
+    // still be waiting for tasks while statics are destroyed at exit.
+    static auto* standardPool = new ThreadPool(
+        std::max<std::size_t>(1u, std::thread::hardware_concurrency()));
+
+    return *standardPool;
+}
+
+void SetDefaultThreadPool(ThreadPool* pool) noexcept
+{
+    defaultThreadPool.store(pool, std::memory_order_release);
+}
+}  // namespace CubbyDNN::Core
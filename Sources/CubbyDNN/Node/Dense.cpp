@@ -1,15 +1,52 @@
 #include <CubbyDNN/Node/Dense.hpp>
 
 #include <CubbyDNN/Compute/GEMM.hpp>
+#include <CubbyDNN/Compute/Sparse.hpp>
+#include <CubbyDNN/Node/Parameter.hpp>
 
 namespace CubbyDNN::Node
 {
+namespace
+{
+// output = epilogue(input * weight^T)
+template <typename T>
+void Multiply(std::size_t numInput, std::size_t batchSize,
+              std::size_t numOutput, const Core::Span<float> input,
+              const Core::Span<T> weight, Core::Span<float> output,
+              const Compute::GEMM::Epilogue& epilogue)
+{
+    // Tiny batches stream the weight once on this thread; packing it for the
+    // blocked GEMM would cost more than the product itself.
+    if (batchSize <= Compute::GEMM::MaxGEMVBatch)
+    {
+        output.FillZero();
+        Compute::GEMM::MultiplyAddGEMV(numInput, batchSize, numOutput, input,
+                                       weight, output, epilogue);
+    }
+    else
+    {
+        Compute::GEMM::Gemm(Compute::GEMM::Transpose::NoTrans,
+                            Compute::GEMM::Transpose::Trans, batchSize,
+                            numOutput, numInput, 1.0f, input, numInput,
+                            weight, numInput, 0.0f, output, numOutput,
+                            epilogue);
+    }
+}
+}  // namespace
+
 Dense::Dense(Core::Graph* graph, std::string_view name)
+    : Dense(graph, name, { nullptr, false, 0.0f })
+{
+}
+
+Dense::Dense(Core::Graph* graph, std::string_view name,
+             const Compute::GEMM::Epilogue& epilogue)
     : Node(graph, name),
-      m_input(this, "input", [this](const auto* dy) { BackwardOpInput(dy); }),
+      m_input(this, "input", NodeInput::Call<Dense, &Dense::BackwardOpInput>),
       m_inputWeight(this, "weight",
-                    [this](const auto* dy) { BackwardOpWeight(dy); }),
-      m_inputBias(this, "bias", [this](const auto* dy) { BackwardOpBias(dy); })
+                    NodeInput::Call<Dense, &Dense::BackwardOpWeight>),
+      m_inputBias(this, "bias", NodeInput::Call<Dense, &Dense::BackwardOpBias>),
+      m_epilogue{ nullptr, epilogue.isReLU, epilogue.alpha }
 {
     m_nodeInputMap["input"] = &m_input;
     m_nodeInputMap["weight"] = &m_inputWeight;
@@ -68,55 +105,137 @@ void Dense::EvalShapeInternal()
 
 void Dense::EvalOutputInternal()
 {
+    // The bias is added to each tile of the product as it is finished,
+    // rather than copied into every row of the output beforehand.
+    Compute::GEMM::Epilogue epilogue = m_epilogue;
+
     if (m_inputBias)
     {
-        m_inputBias.InputNode()->EvalOutput();
+        epilogue.bias = m_inputBias.InputNode()->Output().begin();
+    }
+
+    const std::size_t numInput = m_input.InputNode()->Shape()[0];
+    const auto input = m_input.InputNode()->EvalOutput().Output();
+
+    // Half-precision and sparse parameters are read in their own format;
+    // their dense fp32 output is never materialized.
+    const auto* parameter =
+        graph->Node<Parameter>(m_inputWeight.InputNode()->name);
+    const auto precision =
+        parameter ? parameter->precision : Core::Precision::Float32;
+
+    if (parameter && parameter->GetSparseParameter())
+    {
+        // The sparse product only accumulates, so the bias goes into every
+        // row first.
+        if (m_inputBias)
+        {
+            for (std::size_t index = 0, maxIndex = m_shape[1],
+                             width = m_shape[0];
+                 index < maxIndex; ++index)
+            {
+                m_output.GetSpan()
+                    .SubSpan(index * width)
+                    .CopyFrom(m_inputBias.InputNode()->Output());
+            }
+        }
+        else
+        {
+            m_output.GetSpan().FillZero();
+        }
 
-        for (std::size_t index = 0, maxIndex = m_shape[1], width = m_shape[0];
-             index < maxIndex; ++index)
+        Compute::Sparse::MultiplyAdd(m_shape[1], input,
+                                     *parameter->GetSparseParameter(),
+                                     m_output.GetSpan());
+
+        if (m_epilogue.isReLU)
         {
-            m_output.GetSpan()
-                .SubSpan(index * width)
-                .CopyFrom(m_inputBias.InputNode()->Output());
+            Compute::GEMM::ApplyEpilogue(m_shape[1], m_shape[0],
+                                         m_output.GetSpan(), m_shape[0],
+                                         m_epilogue);
         }
+
+        return;
     }
-    else
+
+    switch (precision)
     {
-        m_output.GetSpan().FillZero();
+        case Core::Precision::Float32:
+            Multiply(numInput, m_shape[1], m_shape[0], input,
+                     m_inputWeight.InputNode()->EvalOutput().Output(),
+                     m_output.GetSpan(), epilogue);
+            break;
+        case Core::Precision::BFloat16:
+            Multiply(numInput, m_shape[1], m_shape[0], input,
+                     parameter->GetBFloat16Parameter(), m_output.GetSpan(),
+                     epilogue);
+            break;
+        case Core::Precision::Float16:
+            Multiply(numInput, m_shape[1], m_shape[0], input,
+                     parameter->GetFloat16Parameter(), m_output.GetSpan(),
+                     epilogue);
+            break;
     }
-
-    Compute::GEMM::MultiplyAdd(
-        m_input.InputNode()->Shape()[0], m_shape[1], m_shape[0],
-        m_input.InputNode()->EvalOutput().Output(),
-        m_inputWeight.InputNode()->EvalOutput().Output(), m_output.GetSpan());
 }
 
 void Dense::BackwardOpInput(const Node* dy)
 {
-    Compute::GEMM::dMultiplyAddLeft(
-        m_input.InputNode()->Shape()[0], m_shape[1], m_shape[0],
-        EvalGradient(dy).Gradient(),
-        m_inputWeight.InputNode()->EvalOutput().Output(),
-        m_input.InputNode()->Gradient());
+    const std::size_t batchSize = m_shape[1];
+    const std::size_t numInput = m_input.InputNode()->Shape()[0];
+    const std::size_t numOutput = m_shape[0];
+
+    const auto* parameter =
+        graph->Node<Parameter>(m_inputWeight.InputNode()->name);
+
+    if (parameter && parameter->GetSparseParameter())
+    {
+        Compute::Sparse::dMultiplyAddLeft(batchSize,
+                                          EvalGradient(dy).Gradient(),
+                                          *parameter->GetSparseParameter(),
+                                          m_input.InputNode()->Gradient());
+
+        return;
+    }
+
+    // dInput(batch x in) += dOutput(batch x out) * weight(out x in)
+    Compute::GEMM::Gemm(Compute::GEMM::Transpose::NoTrans,
+                        Compute::GEMM::Transpose::NoTrans, batchSize, numInput,
+                        numOutput, 1.0f, EvalGradient(dy).Gradient(), numOutput,
+                        m_inputWeight.InputNode()->EvalOutput().Output(),
+                        numInput, 1.0f, m_input.InputNode()->Gradient(),
+                        numInput);
 }
 
 void Dense::BackwardOpWeight(const Node* dy)
 {
-    Compute::GEMM::dMultiplyAddRight(
-        m_input.InputNode()->Shape()[0], m_shape[1], m_shape[0],
-        EvalGradient(dy).Gradient(), m_input.InputNode()->EvalOutput().Output(),
-        m_inputWeight.InputNode()->Gradient());
+    const std::size_t batchSize = m_shape[1];
+    const std::size_t numInput = m_input.InputNode()->Shape()[0];
+    const std::size_t numOutput = m_shape[0];
+
+    // dWeight(out x in) += dOutput(batch x out)^T * input(batch x in)
+    Compute::GEMM::Gemm(Compute::GEMM::Transpose::Trans,
+                        Compute::GEMM::Transpose::NoTrans, numOutput, numInput,
+                        batchSize, 1.0f, EvalGradient(dy).Gradient(), numOutput,
+                        m_input.InputNode()->EvalOutput().Output(), numInput,
+                        1.0f, m_inputWeight.InputNode()->Gradient(), numInput);
 }
 
 void Dense::BackwardOpBias(const Node* dy)
 {
-    EvalGradient(dy);
+    const std::size_t batchSize = m_shape[1];
+    const std::size_t numOutput = m_shape[0];
 
-    for (std::size_t index = 0, maxIndex = m_shape[1], width = m_shape[0];
-         index < maxIndex; ++index)
+    if (m_ones.Size() != batchSize)
     {
-        m_inputBias.InputNode()->Gradient().AccumulateFrom(
-            Gradient().SubSpan(index * width));
+        m_ones.Resize(batchSize);
+        m_ones.GetSpan().FillOne();
     }
+
+    // dBias(1 x out) += ones(1 x batch) * dOutput(batch x out)
+    Compute::GEMM::Gemm(Compute::GEMM::Transpose::NoTrans,
+                        Compute::GEMM::Transpose::NoTrans, 1, numOutput,
+                        batchSize, 1.0f, m_ones.GetSpan(), batchSize,
+                        EvalGradient(dy).Gradient(), numOutput, 1.0f,
+                        m_inputBias.InputNode()->Gradient(), numOutput);
 }
 }  // namespace CubbyDNN::Node
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include <CubbyDNN/Node/FusedDense.hpp>
+
+namespace CubbyDNN::Node
+{
+FusedDense::FusedDense(Core::Graph* graph, std::string_view name,
+                       float _alpha)
+    : Dense(graph, name, { nullptr, true, _alpha }), alpha(_alpha)
+{
+}
+
+const NodeType* FusedDense::Type() const
+{
+    return graph->nodeTypeManager.Type<FusedDense>();
+}
+
+std::string_view FusedDense::TypeName()
+{
+    return "FusedDense";
+}
+
+void FusedDense::EvalGradientInternal()
+{
+    // With alpha >= 0, a product at or below zero comes out at or below
+    // zero, and one above zero comes out as it was.
+    EvalOutput();
+
+    for (std::size_t index = 0, maxIndex = m_output.Size(); index < maxIndex;
+         ++index)
+    {
+        if (m_output.GetSpan()[index] <= 0.0f)
+        {
+            m_gradient.GetSpan()[index] *= alpha;
+        }
+    }
+}
+}  // namespace CubbyDNN::Node
\ No newline at end of file
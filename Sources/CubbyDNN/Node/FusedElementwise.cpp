@@ -0,0 +1,53 @@
+#include <CubbyDNN/Node/FusedElementwise.hpp>
+
+namespace CubbyDNN::Node
+{
+FusedElementwise::FusedElementwise(
+    Core::Graph* graph, std::string_view name,
+    const std::vector<Compute::ElementwiseOp>& _opList)
+    : Node(graph, name),
+      opList(_opList),
+      m_input(this, "input",
+              NodeInput::Call<FusedElementwise, &FusedElementwise::BackwardOp>)
+{
+    m_nodeInputMap["input"] = &m_input;
+}
+
+const NodeType* FusedElementwise::Type() const
+{
+    return graph->nodeTypeManager.Type<FusedElementwise>();
+}
+
+std::string_view FusedElementwise::TypeName()
+{
+    return "FusedElementwise";
+}
+
+void FusedElementwise::EvalShapeInternal()
+{
+    if (!m_input)
+    {
+        throw std::runtime_error("No node attached at 'input'");
+    }
+
+    m_shape = m_input.InputNode()->Shape();
+}
+
+void FusedElementwise::EvalOutputInternal()
+{
+    m_input.InputNode()->EvalOutput();
+
+    Compute::Elementwise::Forward(opList, m_input.InputNode()->Output(),
+                                  m_output.GetSpan());
+}
+
+void FusedElementwise::BackwardOp(const Node* dy)
+{
+    m_input.InputNode()->EvalOutput();
+    EvalGradient(dy);
+
+    Compute::Elementwise::BackwardAdd(opList, m_input.InputNode()->Output(),
+                                      m_gradient.GetSpan(),
+                                      m_input.InputNode()->Gradient());
+}
+}  // namespace CubbyDNN::Node
\ No newline at end of file
@@ -0,0 +1,217 @@
+#include <CubbyDNN/Node/FusedSoftmaxCE.hpp>
+
+#include <CubbyDNN/Compute/Elementwise.hpp>
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace CubbyDNN::Node
+{
+FusedSoftmaxCE::FusedSoftmaxCE(Core::Graph* graph, std::string_view name,
+                               const std::vector<bool>& _groupAxis)
+    : Node(graph, name),
+      groupAxis(_groupAxis),
+      m_inputLabel(this, "label",
+                   NodeInput::Call<FusedSoftmaxCE,
+                                   &FusedSoftmaxCE::BackwardOpLabel>),
+      m_inputLogit(this, "logit",
+                   NodeInput::Call<FusedSoftmaxCE,
+                                   &FusedSoftmaxCE::BackwardOpLogit>),
+      m_groupSize(0)
+{
+    m_nodeInputMap["label"] = &m_inputLabel;
+    m_nodeInputMap["logit"] = &m_inputLogit;
+}
+
+const NodeType* FusedSoftmaxCE::Type() const
+{
+    return graph->nodeTypeManager.Type<FusedSoftmaxCE>();
+}
+
+std::string_view FusedSoftmaxCE::TypeName()
+{
+    return "FusedSoftmaxCE";
+}
+
+bool FusedSoftmaxCE::IsFusable(const std::vector<bool>& groupAxis)
+{
+    // Grouped axes, then the others.
+    return std::is_sorted(groupAxis.begin(), groupAxis.end(),
+                          std::greater<bool>());
+}
+
+Core::Span<float> FusedSoftmaxCE::Probability() const noexcept
+{
+    return m_probability.GetSpan();
+}
+
+void FusedSoftmaxCE::EvalShapeInternal()
+{
+    if (!m_inputLabel)
+    {
+        throw std::runtime_error("No node attached at 'label'");
+    }
+
+    if (!m_inputLogit)
+    {
+        throw std::runtime_error("No node attached at 'logit'");
+    }
+
+    const auto& shape = m_inputLogit.InputNode()->Shape();
+
+    if (m_inputLabel.InputNode()->Shape() != shape)
+    {
+        throw std::runtime_error(
+            "The shape of 'label' and 'logit' must be equal");
+    }
+
+    if (!IsFusable(groupAxis))
+    {
+        throw std::runtime_error("The grouped axes must come first");
+    }
+
+    // A single flag stands for the whole logit, as in Softmax.
+    if (groupAxis.empty() || groupAxis.size() == 1)
+    {
+        m_groupSize = groupAxis.empty() || groupAxis[0] ? shape.Size() : 1;
+    }
+    else if (groupAxis.size() != shape.Rank())
+    {
+        throw std::runtime_error(
+            "The length of 'group axis' must be equal to the rank of 'logit'");
+    }
+    else
+    {
+        m_groupSize = 1;
+
+        for (std::size_t index = 0;
+             index < groupAxis.size() && groupAxis[index]; ++index)
+        {
+            m_groupSize *= shape[index];
+        }
+    }
+
+    const std::size_t numGroup = m_groupSize ? shape.Size() / m_groupSize : 0;
+
+    m_probability.Resize(shape.Size());
+    m_logSummation.Resize(numGroup);
+    m_labelSummation.Resize(numGroup);
+    m_logLikelihood.Resize(numGroup);
+
+    m_shape = { 1 };
+}
+
+void FusedSoftmaxCE::EvalOutputInternal()
+{
+    const float* label = m_inputLabel.InputNode()->Output().begin();
+    const float* logit = m_inputLogit.InputNode()->Output().begin();
+    float* probability = m_probability.GetSpan().begin();
+    const auto& kernel = Compute::KernelRegistry::Active().softmax;
+    const std::size_t numGroup = m_logSummation.Size();
+
+    const auto runGroup = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t group = begin; group < end; ++group)
+        {
+            const std::size_t offset = group * m_groupSize;
+            const float* x = logit + offset;
+            const float* t = label + offset;
+            float* y = probability + offset;
+
+            const float maxLogit = kernel.reduceMax(m_groupSize, x);
+            const float summation =
+                kernel.shiftedExp(m_groupSize, maxLogit, x, y);
+            const float summationInv = 1.0f / summation;
+            const float logSummation = maxLogit + std::log(summation);
+            float labelSummation = 0.0f;
+            float logLikelihood = 0.0f;
+
+            // log(prob) is logit - logSummation, with no logarithm per value.
+            for (std::size_t index = 0; index < m_groupSize; ++index)
+            {
+                y[index] *= summationInv;
+                logLikelihood += t[index] * (x[index] - logSummation);
+                labelSummation += t[index];
+            }
+
+            m_logSummation.GetSpan()[group] = logSummation;
+            m_labelSummation.GetSpan()[group] = labelSummation;
+            m_logLikelihood.GetSpan()[group] = logLikelihood;
+        }
+    };
+
+    const std::size_t numThread =
+        Compute::Elementwise::ThreadCount(m_probability.Size());
+
+    if (numThread == 1)
+    {
+        runGroup(0, numGroup);
+    }
+    else
+    {
+        Core::DefaultThreadPool().ParallelFor(
+            numGroup, (numGroup + numThread - 1) / numThread, numThread,
+            runGroup);
+    }
+
+    // Summed in order, so that the loss does not depend on the threads.
+    float loss = 0.0f;
+
+    for (const auto logLikelihood : m_logLikelihood.GetSpan())
+    {
+        loss += logLikelihood;
+    }
+
+    m_output.GetSpan()[0] =
+        -loss / static_cast<float>(m_inputLabel.InputNode()->Shape()[1]);
+}
+
+void FusedSoftmaxCE::BackwardOpLabel(const Node* dy)
+{
+    m_inputLogit.InputNode()->EvalOutput();
+    EvalOutput();
+    EvalGradient(dy);
+
+    const float factor =
+        -m_gradient.GetSpan()[0] / m_inputLogit.InputNode()->Shape()[1];
+    const auto logit = m_inputLogit.InputNode()->Output();
+    auto gradient = m_inputLabel.InputNode()->Gradient();
+
+    for (std::size_t index = 0, maxIndex = gradient.Length();
+         index < maxIndex; ++index)
+    {
+        gradient[index] +=
+            factor *
+            (logit[index] - m_logSummation.GetSpan()[index / m_groupSize]);
+    }
+}
+
+void FusedSoftmaxCE::BackwardOpLogit(const Node* dy)
+{
+    m_inputLabel.InputNode()->EvalOutput();
+    EvalOutput();
+    EvalGradient(dy);
+
+    const float factor =
+        m_gradient.GetSpan()[0] / m_inputLogit.InputNode()->Shape()[1];
+    const auto label = m_inputLabel.InputNode()->Output();
+    const auto probability = m_probability.GetSpan();
+    auto gradient = m_inputLogit.InputNode()->Gradient();
+
+    for (std::size_t group = 0, maxGroup = m_labelSummation.Size();
+         group < maxGroup; ++group)
+    {
+        const float labelSummation = m_labelSummation.GetSpan()[group];
+
+        for (std::size_t index = group * m_groupSize,
+                         maxIndex = index + m_groupSize;
+             index < maxIndex; ++index)
+        {
+            gradient[index] +=
+                factor * (labelSummation * probability[index] - label[index]);
+        }
+    }
+}
+}  // namespace CubbyDNN::Node
\ No newline at end of file
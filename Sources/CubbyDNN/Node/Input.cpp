@@ -37,6 +37,12 @@ void Input::EvalShapeInternal()
 
 void Input::EvalOutputInternal()
 {
+    // Only reached when the fed span is shorter than the shape.
     Output().CopyFrom(m_inputSpan);
 }
+
+Core::Span<float> Input::OutputStorage() const noexcept
+{
+    return m_inputSpan;
+}
 }  // namespace CubbyDNN::Node
\ No newline at end of file
@@ -1,14 +1,29 @@
 #include <CubbyDNN/Core/Graph.hpp>
 #include <CubbyDNN/Node/Node.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace CubbyDNN::Node
 {
+namespace
+{
+// Number of EvalGradient calls in progress on this thread. Outputs are
+// only released for being done with in the forward pass outside of them.
+thread_local std::size_t gradientDepth = 0;
+}  // namespace
+
 Node::Node(Core::Graph* _graph, std::string_view _name)
     : graph(_graph),
       name(_name),
+      m_id(0),
       m_isShapeDirty(true),
       m_isOutputDirty(true),
-      m_gradientDirty(nullptr)
+      m_isOutputView(false),
+      m_outputVersion(0),
+      m_gradientDirty(nullptr),
+      m_isForwardOnly(false),
+      m_isRecomputable(false)
 {
     // Do nothing
 }
@@ -29,6 +44,11 @@ std::string_view Node::TypeName()
     return "Node";
 }
 
+std::size_t Node::Id() const noexcept
+{
+    return m_id;
+}
+
 const Core::Shape& Node::Shape() const noexcept
 {
     return m_shape;
@@ -44,9 +64,14 @@ Core::Span<float> Node::Gradient() const noexcept
     return m_gradient.GetSpan();
 }
 
+std::size_t Node::OutputVersion() const noexcept
+{
+    return m_outputVersion;
+}
+
 bool Node::HasRevDeps(const Node* revDep) const
 {
-    return m_revDeps.count(const_cast<Node*>(revDep));
+    return graph->IsDependOn(revDep, this);
 }
 
 Node& Node::MarkDirty(bool dirtyShape)
@@ -55,11 +80,44 @@ Node& Node::MarkDirty(bool dirtyShape)
     m_isOutputDirty = true;
     m_gradientDirty = nullptr;
 
-    for (auto* node : m_revDeps)
+    // The viewed storage may be about to change or go away.
+    if (m_isOutputView)
+    {
+        m_output = Core::Memory<float>();
+        m_isOutputView = false;
+    }
+
+    // Every node that depends on this one. A node whose shape is dirty
+    // already is left out with what depends on it: a shape is only clean
+    // after the shapes of the inputs are, and so are an output and a
+    // gradient, so they have all been dirty since it was marked.
+    std::vector<bool> isVisited(graph->NodeCount());
+    std::vector<Node*> stack;
+
+    for (const auto* revNodeInput : m_revNodeInputList)
     {
-        node->m_isShapeDirty = node->m_isShapeDirty || dirtyShape;
+        stack.emplace_back(revNodeInput->node);
+    }
+
+    while (!stack.empty())
+    {
+        auto* node = stack.back();
+        stack.pop_back();
+
+        if (isVisited[node->m_id] || node->m_isShapeDirty)
+        {
+            continue;
+        }
+
+        isVisited[node->m_id] = true;
+        node->m_isShapeDirty = dirtyShape;
         node->m_isOutputDirty = true;
         node->m_gradientDirty = nullptr;
+
+        for (const auto* revNodeInput : node->m_revNodeInputList)
+        {
+            stack.emplace_back(revNodeInput->node);
+        }
     }
 
     return *this;
@@ -90,10 +148,35 @@ Node& Node::EvalOutput()
         return *this;
     }
 
-    m_output.Resize(EvalShape().m_shape.Size());
+    // Every input is ready before the output is written, so a memory plan
+    // can hand this node a buffer that only dead nodes used.
+    for (const auto& pair : m_nodeInputMap)
+    {
+        pair.second->InputNode()->EvalOutput();
+    }
 
-    EvalOutputInternal();
-    m_isOutputDirty = false;
+    const std::size_t size = EvalShape().m_shape.Size();
+    auto storage = OutputStorage();
+
+    if (storage.begin() && storage.Length() >= size)
+    {
+        // Nothing is written through the view: a node only ever writes its
+        // output below, after dropping it.
+        m_output = Core::Memory<float>::View(storage.begin(), size);
+        m_isOutputView = true;
+        m_isOutputDirty = false;
+        ++m_outputVersion;
+
+        return *this;
+    }
+
+    if (m_isOutputView)
+    {
+        m_output = Core::Memory<float>();
+        m_isOutputView = false;
+    }
+
+    ComputeOutput(size);
 
     return *this;
 }
@@ -105,11 +188,30 @@ Node& Node::EvalGradient(const Node* dy)
         return *this;
     }
 
-    m_gradient.Resize(EvalShape().m_shape.Size());
+    if (m_isForwardOnly)
+    {
+        throw std::runtime_error("The memory plan of '" + name +
+                                 "' does not allow gradients");
+    }
+
+    const GradientScope scope(graph);
+
+    // Same as in EvalOutput: the gradients this one is accumulated from are
+    // ready before it is written.
+    for (const auto* revNodeInput : m_revNodeInputList)
+    {
+        if (revNodeInput->node == dy || revNodeInput->node->HasRevDeps(dy))
+        {
+            revNodeInput->node->EvalGradient(dy);
+        }
+    }
+
+    PrepareGradient();
 
     if (dy == this)
     {
         m_gradient.GetSpan().FillOne();
+        EvalGradientInternal();
         m_gradientDirty = dy;
 
         return *this;
@@ -121,7 +223,20 @@ Node& Node::EvalGradient(const Node* dy)
     {
         if (revNodeInput->node == dy || revNodeInput->node->HasRevDeps(dy))
         {
-            revNodeInput->backwardOp(dy);
+            revNodeInput->backwardOp(revNodeInput->node, dy);
+        }
+    }
+
+    EvalGradientInternal();
+
+    // Under checkpointing, the consumers have passed their gradient down to
+    // this node and their outputs can go; a later gradient that still needs
+    // one recomputes it from the nearest checkpoint.
+    for (const auto* revNodeInput : m_revNodeInputList)
+    {
+        if (revNodeInput->node == dy || revNodeInput->node->HasRevDeps(dy))
+        {
+            revNodeInput->node->ReleaseOutput();
         }
     }
 
@@ -129,4 +244,95 @@ Node& Node::EvalGradient(const Node* dy)
 
     return *this;
 }
+
+Core::Span<float> Node::OutputStorage() const noexcept
+{
+    return Core::Span<float>();
+}
+
+void Node::EvalGradientInternal()
+{
+    // Do nothing
+}
+
+void Node::ComputeOutput(std::size_t size)
+{
+    m_output.Resize(size, graph->BufferAllocator());
+    Core::CheckAlignment(Output());
+
+    for (auto* alias : m_outputAliasList)
+    {
+        alias->m_isOutputDirty = true;
+    }
+
+    EvalOutputInternal();
+    m_isOutputDirty = false;
+    ++m_outputVersion;
+
+    // Under checkpointing, an input whose consumers are all evaluated is
+    // not needed again until the backward pass.
+    if (gradientDepth || graph->m_recomputableList.empty())
+    {
+        return;
+    }
+
+    for (const auto& pair : m_nodeInputMap)
+    {
+        auto* input = pair.second->InputNode();
+
+        if (std::none_of(input->m_revNodeInputList.begin(),
+                         input->m_revNodeInputList.end(),
+                         [](const NodeInput* revNodeInput) {
+                             return revNodeInput->node->m_isOutputDirty;
+                         }))
+        {
+            input->ReleaseOutput();
+        }
+    }
+}
+
+void Node::PrepareGradient()
+{
+    m_gradient.Resize(EvalShape().m_shape.Size(), graph->BufferAllocator());
+    Core::CheckAlignment(Gradient());
+
+    for (auto* alias : m_gradientAliasList)
+    {
+        alias->m_gradientDirty = nullptr;
+    }
+}
+
+Node::GradientScope::GradientScope(Core::Graph* _graph) noexcept
+    : m_graph(_graph)
+{
+    ++gradientDepth;
+}
+
+Node::GradientScope::~GradientScope() noexcept
+{
+    if (--gradientDepth)
+    {
+        return;
+    }
+
+    // Once the outermost backward pass is done, what was recomputed for it
+    // goes again, so that backward passes run one after another do not
+    // pile up recomputed outputs.
+    for (auto* node : m_graph->m_recomputableList)
+    {
+        node->ReleaseOutput();
+    }
+}
+
+void Node::ReleaseOutput() noexcept
+{
+    // Outputs shared under an inference memory plan stay where they are.
+    if (!m_isRecomputable || m_isForwardOnly || m_isOutputDirty)
+    {
+        return;
+    }
+
+    m_output = Core::Memory<float>();
+    m_isOutputDirty = true;
+}
 }  // namespace CubbyDNN::Node
\ No newline at end of file
@@ -1,16 +1,17 @@
+#include <CubbyDNN/Core/Graph.hpp>
 #include <CubbyDNN/Node/Node.hpp>
 #include <CubbyDNN/Node/NodeInput.hpp>
 
+#include <algorithm>
 #include <stdexcept>
-#include <utility>
 
 namespace CubbyDNN::Node
 {
 NodeInput::NodeInput(Node* _node, std::string_view _name,
-                     std::function<void(const Node*)> _backwardOp)
+                     BackwardOp _backwardOp)
     : node(_node),
       name(_name),
-      backwardOp(std::move(_backwardOp)),
+      backwardOp(_backwardOp),
       m_inputNode(nullptr)
 {
     node->m_nodeInputMap[name] = this;
@@ -33,7 +34,8 @@ const Node* NodeInput::InputNode() const noexcept
 
 bool NodeInput::IsDependOn(const Node* _node) const
 {
-    return m_depsSet.count(const_cast<Node*>(_node));
+    return m_inputNode && (m_inputNode == _node ||
+                           node->graph->IsDependOn(m_inputNode, _node));
 }
 
 void NodeInput::Attach(Node* inputNode)
@@ -48,20 +50,28 @@ void NodeInput::Attach(Node* inputNode)
         return;
     }
 
-    // Trace dependencies and merge into the owner node.
-    m_depsSet.emplace(inputNode);
-    m_depsSet.insert(inputNode->m_deps.cbegin(), inputNode->m_deps.cend());
-    node->m_deps.insert(m_depsSet.cbegin(), m_depsSet.cend());
-
-    // Trace reverse dependencies.
+    // Only the edge is kept; what depends on what is found by walking the
+    // edges when asked.
     inputNode->m_revNodeInputList.emplace_back(this);
+    m_inputNode = inputNode;
+    node->graph->m_depsNode = nullptr;
+    ++node->graph->m_version;
+}
 
-    for (auto* dep : m_depsSet)
+void NodeInput::Detach()
+{
+    if (!m_inputNode)
     {
-        dep->m_revDeps.emplace(node);
-        dep->m_revDeps.insert(node->m_revDeps.cbegin(), node->m_revDeps.cend());
+        return;
     }
 
-    m_inputNode = inputNode;
+    auto& revNodeInputList = m_inputNode->m_revNodeInputList;
+    revNodeInputList.erase(std::find(revNodeInputList.begin(),
+                                     revNodeInputList.end(), this));
+
+    m_inputNode = nullptr;
+    node->graph->m_depsNode = nullptr;
+    ++node->graph->m_version;
+    node->MarkDirty();
 }
 }  // namespace CubbyDNN::Node
\ No newline at end of file
@@ -40,7 +40,7 @@ bool NodeType::IsBaseOf(const NodeType* _baseType, const NodeType* _derivedType)
         return false;
     }
 
-    for (const auto* base{ _derivedType }; base; ++base)
+    for (const auto* base{ _derivedType }; base; base = base->baseType)
     {
         if (*base == *_baseType)
         {
@@ -64,7 +64,8 @@ bool NodeType::IsExactlyBaseOf(const NodeType* _baseType,
         return false;
     }
 
-    for (const auto* base{ _derivedType->baseType }; base; ++base)
+    for (const auto* base{ _derivedType->baseType }; base;
+         base = base->baseType)
     {
         if (*base == *_baseType)
         {
@@ -1,19 +1,47 @@
+#include <CubbyDNN/Compute/Convert.hpp>
 #include <CubbyDNN/Core/Graph.hpp>
 #include <CubbyDNN/Node/Parameter.hpp>
 
+#include <stdexcept>
 #include <utility>
 
 namespace CubbyDNN::Node
 {
 Parameter::Parameter(Core::Graph* _graph, std::string_view _name,
-                     Core::Shape _shape, Initializer::Initializer* _initializer)
+                     Core::Shape _shape, Initializer::Initializer* _initializer,
+                     Core::Precision _precision)
     : Node(_graph, _name),
       parameterShape(std::move(_shape)),
-      initializer(_initializer)
+      initializer(_initializer),
+      precision(_precision)
 
 {
-    m_parameter.Resize(EvalShape().Shape().Size());
-    (*initializer)(m_parameter.GetSpan());
+    const std::size_t size = EvalShape().Shape().Size();
+
+    if (precision == Core::Precision::Float32)
+    {
+        m_parameter.Resize(size, graph->BufferAllocator());
+        (*initializer)(m_parameter.GetSpan());
+
+        return;
+    }
+
+    // Initializers produce fp32; narrow once and keep only the result.
+    Core::Memory<float> values(size);
+    (*initializer)(values.GetSpan());
+
+    if (precision == Core::Precision::BFloat16)
+    {
+        m_bf16Parameter.Resize(size, graph->BufferAllocator());
+        Compute::Convert::FromFloat(values.GetSpan(),
+                                    m_bf16Parameter.GetSpan());
+    }
+    else
+    {
+        m_fp16Parameter.Resize(size, graph->BufferAllocator());
+        Compute::Convert::FromFloat(values.GetSpan(),
+                                    m_fp16Parameter.GetSpan());
+    }
 }
 
 const NodeType* Parameter::Type() const
@@ -31,6 +59,45 @@ Core::Span<float> Parameter::GetParameter() const noexcept
     return m_parameter.GetSpan();
 }
 
+Core::Span<Core::BFloat16> Parameter::GetBFloat16Parameter() const noexcept
+{
+    return m_bf16Parameter.GetSpan();
+}
+
+Core::Span<Core::Float16> Parameter::GetFloat16Parameter() const noexcept
+{
+    return m_fp16Parameter.GetSpan();
+}
+
+void Parameter::Sparsify(Compute::SparseFormat format)
+{
+    if (precision != Core::Precision::Float32 || parameterShape.Rank() != 2)
+    {
+        throw std::runtime_error(
+            "Only rank-2 Float32 parameters can be sparsified");
+    }
+
+    if (m_sparseParameter)
+    {
+        throw std::runtime_error("The parameter is already sparse");
+    }
+
+    m_sparseParameter =
+        std::make_unique<Compute::SparseMatrix>(Compute::Sparse::FromDense(
+            format, parameterShape[0], parameterShape[1],
+            m_parameter.GetSpan()));
+
+    Core::Memory<float> released;
+    Swap(m_parameter, released);
+
+    MarkDirty(false);
+}
+
+const Compute::SparseMatrix* Parameter::GetSparseParameter() const noexcept
+{
+    return m_sparseParameter.get();
+}
+
 void Parameter::EvalShapeInternal()
 {
     m_shape = parameterShape;
@@ -38,6 +105,29 @@ void Parameter::EvalShapeInternal()
 
 void Parameter::EvalOutputInternal()
 {
-    Output().CopyFrom(m_parameter.GetSpan());
+    if (m_sparseParameter)
+    {
+        Compute::Sparse::ToDense(*m_sparseParameter, Output());
+
+        return;
+    }
+
+    switch (precision)
+    {
+        case Core::Precision::Float32:
+            // Viewed in place, see OutputStorage.
+            break;
+        case Core::Precision::BFloat16:
+            Compute::Convert::ToFloat(m_bf16Parameter.GetSpan(), Output());
+            break;
+        case Core::Precision::Float16:
+            Compute::Convert::ToFloat(m_fp16Parameter.GetSpan(), Output());
+            break;
+    }
+}
+
+Core::Span<float> Parameter::OutputStorage() const noexcept
+{
+    return m_sparseParameter ? Core::Span<float>() : m_parameter.GetSpan();
 }
 }  // namespace CubbyDNN::Node
\ No newline at end of file
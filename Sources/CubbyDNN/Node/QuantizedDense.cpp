@@ -0,0 +1,142 @@
+#include <CubbyDNN/Node/QuantizedDense.hpp>
+
+#include <CubbyDNN/Compute/GEMM.hpp>
+
+#include <algorithm>
+
+namespace CubbyDNN::Node
+{
+namespace
+{
+void ThrowInferenceOnly(Node*, const Node*)
+{
+    throw std::runtime_error("QuantizedDense does not support backpropagation");
+}
+}  // namespace
+
+QuantizedDense::QuantizedDense(Core::Graph* graph, std::string_view name)
+    : Node(graph, name),
+      m_input(this, "input", ThrowInferenceOnly),
+      m_inputWeight(this, "weight", ThrowInferenceOnly),
+      m_inputBias(this, "bias", ThrowInferenceOnly),
+      m_weightVersion(0)
+{
+    m_nodeInputMap["input"] = &m_input;
+    m_nodeInputMap["weight"] = &m_inputWeight;
+    m_nodeInputMap["bias"] = &m_inputBias;
+}
+
+const NodeType* QuantizedDense::Type() const
+{
+    return graph->nodeTypeManager.Type<QuantizedDense>();
+}
+
+std::string_view QuantizedDense::TypeName()
+{
+    return "QuantizedDense";
+}
+
+void QuantizedDense::EvalShapeInternal()
+{
+    if (!m_input)
+    {
+        throw std::runtime_error("No node attached at 'input'");
+    }
+
+    if (m_input.InputNode()->Shape().Rank() != 2)
+    {
+        throw std::runtime_error("The rank of 'input' must be 2");
+    }
+
+    if (m_inputWeight.InputNode()->Shape().Rank() != 2)
+    {
+        throw std::runtime_error("The rank of 'weight' must be 2");
+    }
+
+    if (m_inputBias && m_inputBias.InputNode()->Shape().Rank() != 1)
+    {
+        throw std::runtime_error("The rank of 'bias' must be 1");
+    }
+
+    if (m_input.InputNode()->Shape()[0] !=
+        m_inputWeight.InputNode()->Shape()[1])
+    {
+        throw std::runtime_error(
+            "The shape of 'input' and 'weight' is not compatible");
+    }
+
+    if (m_inputBias && m_inputWeight.InputNode()->Shape()[0] !=
+                           m_inputBias.InputNode()->Shape()[0])
+    {
+        throw std::runtime_error(
+            "The shape of 'weight' and 'bias' is not compatible");
+    }
+
+    m_shape = { m_inputWeight.InputNode()->Shape()[0],
+                m_input.InputNode()->Shape()[1] };
+
+    // Another weight may have been attached, whatever its version.
+    m_weightVersion = 0;
+}
+
+void QuantizedDense::QuantizeWeight()
+{
+    const std::size_t numOutput = m_shape[0];
+    const std::size_t numInput = m_input.InputNode()->Shape()[0];
+
+    m_weight.Resize(numOutput * numInput);
+    m_weightParam.Resize(numOutput);
+    m_weightRowSum.Resize(numOutput);
+
+    auto* weight = m_inputWeight.InputNode();
+
+    // The weight range is limited to what the active int8 kernel multiplies
+    // exactly.
+    Compute::Quantization::QuantizeRows(
+        numOutput, numInput, weight->EvalOutput().Output(),
+        Compute::GEMM::Int8MaxWeight(), m_weight.GetSpan(),
+        m_weightParam.GetSpan(), m_weightRowSum.GetSpan());
+
+    m_weightVersion = weight->OutputVersion();
+}
+
+void QuantizedDense::EvalOutputInternal()
+{
+    const std::size_t batchSize = m_shape[1];
+    const std::size_t numInput = m_input.InputNode()->Shape()[0];
+    const std::size_t numOutput = m_shape[0];
+
+    // Whenever the weight was evaluated again, as after an optimizer step
+    // marked it dirty.
+    if (m_weightVersion !=
+        m_inputWeight.InputNode()->EvalOutput().OutputVersion())
+    {
+        QuantizeWeight();
+    }
+
+    const auto input = m_input.InputNode()->EvalOutput().Output();
+    const auto [min, max] = std::minmax_element(input.begin(), input.end());
+    const auto inputParam = Compute::Quantization::ChooseUnsigned(
+        input.Length() ? *min : 0.0f, input.Length() ? *max : 0.0f);
+
+    m_quantizedInput.Resize(batchSize * numInput);
+    m_accumulator.Resize(batchSize * numOutput);
+
+    Compute::Quantization::Quantize(input, inputParam,
+                                    m_quantizedInput.GetSpan());
+
+    // accumulator(batch x out) = input(batch x in) * weight(out x in)^T
+    Compute::GEMM::GemmU8S8(batchSize, numOutput, numInput,
+                            m_quantizedInput.GetSpan(), numInput,
+                            m_weight.GetSpan(), numInput,
+                            m_accumulator.GetSpan(), numOutput);
+
+    Compute::Quantization::Dequantize(
+        batchSize, numOutput, numInput, m_accumulator.GetSpan(), inputParam,
+        Core::Span<std::int32_t>(), m_weightParam.GetSpan(),
+        m_weightRowSum.GetSpan(),
+        m_inputBias ? m_inputBias.InputNode()->EvalOutput().Output()
+                    : Core::Span<float>(),
+        m_output.GetSpan());
+}
+}  // namespace CubbyDNN::Node
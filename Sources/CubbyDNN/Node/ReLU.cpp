@@ -5,7 +5,8 @@ namespace CubbyDNN::Node
 ReLU::ReLU(Core::Graph* graph, std::string_view name, float _alpha)
     : Node(graph, name),
       alpha(_alpha),
-      m_inputLogit(this, "logit", [this](const auto* dy) { BackwardOp(dy); })
+      m_inputLogit(this, "logit", NodeInput::Call<ReLU, &ReLU::BackwardOp>),
+      m_opList{ { Compute::ElementwiseType::ReLU, _alpha } }
 {
     m_nodeInputMap["logit"] = &m_inputLogit;
 }
@@ -34,16 +35,8 @@ void ReLU::EvalOutputInternal()
 {
     m_inputLogit.InputNode()->EvalOutput();
 
-    const auto rectify = [](float value, float alpha) {
-        return value < 0.0f ? alpha * value : value;
-    };
-
-    for (std::size_t index = 0, maxIndex = m_output.Size(); index < maxIndex;
-         ++index)
-    {
-        m_output.GetSpan()[index] =
-            rectify(m_inputLogit.InputNode()->Output()[index], alpha);
-    }
+    Compute::Elementwise::Forward(m_opList, m_inputLogit.InputNode()->Output(),
+                                  m_output.GetSpan());
 }
 
 void ReLU::BackwardOp(const Node* dy)
@@ -51,17 +44,9 @@ void ReLU::BackwardOp(const Node* dy)
     m_inputLogit.InputNode()->EvalOutput();
     EvalGradient(dy);
 
-    const auto rectify = [](float value, float alpha, float gradient) {
-        return value < 0.0f ? alpha * gradient : gradient;
-    };
-
-    for (std::size_t index = 0,
-                     maxIndex = m_inputLogit.InputNode()->Gradient().Length();
-         index < maxIndex; ++index)
-    {
-        m_inputLogit.InputNode()->Gradient()[index] +=
-            rectify(m_inputLogit.InputNode()->Output()[index], alpha,
-                    m_gradient.GetSpan()[index]);
-    }
+    Compute::Elementwise::BackwardAdd(m_opList,
+                                      m_inputLogit.InputNode()->Output(),
+                                      m_gradient.GetSpan(),
+                                      m_inputLogit.InputNode()->Gradient());
 }
 }  // namespace CubbyDNN::Node
\ No newline at end of file
@@ -6,7 +6,9 @@ Softmax::Softmax(Core::Graph* graph, std::string_view name,
                  const std::vector<bool>& _groupAxis)
     : Node(graph, name),
       groupAxis(_groupAxis),
-      m_inputLogit(this, "logit", [this](const auto* dy) { BackwardOp(dy); })
+      m_inputLogit(this, "logit",
+                   NodeInput::Call<Softmax, &Softmax::BackwardOp>),
+      m_epsilon(0.0f)
 {
     m_nodeInputMap["logit"] = &m_inputLogit;
 }
@@ -31,8 +33,16 @@ void Softmax::EvalShapeInternal()
     const auto& shape = m_inputLogit.InputNode()->Shape();
     m_shape = shape;
 
+    // A single flag, or none, stands for every axis. Only a softmax over the
+    // whole logit guards its sum with 1e-4.
     if (groupAxis.empty() || groupAxis.size() == 1)
     {
+        const bool isGrouped = groupAxis.empty() || groupAxis[0];
+
+        m_layout = Compute::Softmax::Layout(
+            shape, std::vector<bool>(shape.Rank(), isGrouped));
+        m_epsilon = isGrouped ? 1e-4f : 0.0f;
+
         return;
     }
 
@@ -42,134 +52,17 @@ void Softmax::EvalShapeInternal()
             "The length of 'group axis' must be equal to the rank of 'logit'");
     }
 
-    std::vector<std::size_t> multipliedShape = { 1 };
-    for (std::size_t index = 0, maxIndex = shape.Rank() - 1; index < maxIndex;
-         ++index)
-    {
-        multipliedShape.emplace_back(multipliedShape.back() * shape[index]);
-    }
-
-    m_indexFactorList.clear();
-
-    std::size_t summationSize = m_shape.Size();
-    for (std::size_t index = 0, maxIndex = groupAxis.size(); index < maxIndex;
-         ++index)
-    {
-        if (groupAxis[index])
-        {
-            summationSize /= m_shape[index];
-        }
-        else
-        {
-            m_indexFactorList.emplace_back(
-                shape[index], multipliedShape[index],
-                !m_indexFactorList.empty()
-                    ? std::get<0>(m_indexFactorList.back()) *
-                          std::get<2>(m_indexFactorList.back())
-                    : 1);
-        }
-    }
-
-    m_summation.Resize(summationSize);
+    m_layout = Compute::Softmax::Layout(shape, groupAxis);
+    m_epsilon = 0.0f;
 }
 
 void Softmax::EvalOutputInternal()
 {
     m_inputLogit.InputNode()->EvalOutput();
 
-    const float maxInput = *m_inputLogit.InputNode()->Output().Max();
-
-    if (groupAxis.empty())
-    {
-        float expSumInv = 0.0f;
-
-        for (auto inputVal : m_inputLogit.InputNode()->Output())
-        {
-            expSumInv += std::exp(inputVal - maxInput);
-        }
-
-        expSumInv = 1.0f / (expSumInv + 1e-4f);
-
-        for (std::size_t index = 0,
-                         maxIndex = m_inputLogit.InputNode()->Output().Length();
-             index < maxIndex; ++index)
-        {
-            m_output.GetSpan()[index] =
-                expSumInv *
-                std::exp(m_inputLogit.InputNode()->Output()[index] - maxInput);
-        }
-
-        return;
-    }
-
-    if (groupAxis.size() == 1)
-    {
-        if (groupAxis[0])
-        {
-            float expSumInv = 0.0f;
-
-            for (auto inputVal : m_inputLogit.InputNode()->Output())
-            {
-                expSumInv += std::exp(inputVal - maxInput);
-            }
-
-            expSumInv = 1.0f / (expSumInv + 1e-4f);
-
-            for (std::size_t
-                     index = 0,
-                     maxIndex = m_inputLogit.InputNode()->Output().Length();
-                 index < maxIndex; ++index)
-            {
-                m_output.GetSpan()[index] =
-                    expSumInv *
-                    std::exp(m_inputLogit.InputNode()->Output()[index] -
-                             maxInput);
-            }
-        }
-        else
-        {
-            m_output.GetSpan().FillOne();
-        }
-
-        return;
-    }
-
-    auto reduceIndex = [this](std::size_t index) {
-        std::size_t result = 0;
-
-        for (const auto& indexFactorTuple : m_indexFactorList)
-        {
-            result += index / std::get<1>(indexFactorTuple) %
-                      std::get<0>(indexFactorTuple) *
-                      std::get<2>(indexFactorTuple);
-        }
-
-        return result;
-    };
-
-    m_summation.GetSpan().FillZero();
-
-    for (std::size_t index = 0,
-                     maxIndex = m_inputLogit.InputNode()->Output().Length();
-         index < maxIndex; ++index)
-    {
-        m_summation.GetSpan()[reduceIndex(index)] +=
-            std::exp(m_inputLogit.InputNode()->Output()[index] - maxInput);
-    }
-
-    for (auto& summationVal : m_summation.GetSpan())
-    {
-        summationVal = 1.0f / summationVal;
-    }
-
-    for (std::size_t index = 0,
-                     maxIndex = m_inputLogit.InputNode()->Output().Length();
-         index < maxIndex; ++index)
-    {
-        m_output.GetSpan()[index] =
-            m_summation.GetSpan()[reduceIndex(index)] *
-            std::exp(m_inputLogit.InputNode()->Output()[index] - maxInput);
-    }
+    Compute::Softmax::Forward(m_layout, m_epsilon,
+                              m_inputLogit.InputNode()->Output(),
+                              m_output.GetSpan());
 }
 
 void Softmax::BackwardOp(const Node* dy)
@@ -177,83 +70,8 @@ void Softmax::BackwardOp(const Node* dy)
     EvalOutput();
     EvalGradient(dy);
 
-    if (groupAxis.empty())
-    {
-        float sum = 0.0f;
-
-        for (std::size_t index = 0, maxIndex = m_output.Size();
-             index < maxIndex; ++index)
-        {
-            sum += m_gradient.GetSpan()[index] * m_output.GetSpan()[index];
-        }
-
-        for (std::size_t index = 0, maxIndex = m_output.Size();
-             index < maxIndex; ++index)
-        {
-            m_inputLogit.InputNode()->Gradient()[index] +=
-                m_output.GetSpan()[index] * (m_gradient.GetSpan()[index] - sum);
-        }
-
-        return;
-    }
-
-    if (groupAxis.size() == 1)
-    {
-        if (groupAxis[0])
-        {
-            float sum = 0.0f;
-
-            for (std::size_t index = 0, maxIndex = m_output.Size();
-                 index < maxIndex; ++index)
-            {
-                sum += m_gradient.GetSpan()[index] * m_output.GetSpan()[index];
-            }
-
-            for (std::size_t index = 0, maxIndex = m_output.Size();
-                 index < maxIndex; ++index)
-            {
-                m_inputLogit.InputNode()->Gradient()[index] +=
-                    m_output.GetSpan()[index] *
-                    (m_gradient.GetSpan()[index] - sum);
-            }
-        }
-        else
-        {
-            m_inputLogit.InputNode()->Gradient().FillZero();
-        }
-
-        return;
-    }
-
-    auto reduceIndex = [this](std::size_t index) {
-        std::size_t result = 0;
-
-        for (const auto& indexFactorTuple : m_indexFactorList)
-        {
-            result += index / std::get<1>(indexFactorTuple) %
-                      std::get<0>(indexFactorTuple) *
-                      std::get<2>(indexFactorTuple);
-        }
-
-        return result;
-    };
-
-    m_summation.GetSpan().FillZero();
-
-    for (std::size_t index = 0, maxIndex = m_output.Size(); index < maxIndex;
-         ++index)
-    {
-        m_summation.GetSpan()[reduceIndex(index)] +=
-            m_gradient.GetSpan()[index] * m_output.GetSpan()[index];
-    }
-
-    for (std::size_t index = 0, maxIndex = m_output.Size(); index < maxIndex;
-         ++index)
-    {
-        m_inputLogit.InputNode()->Gradient()[index] +=
-            m_output.GetSpan()[index] *
-            (m_gradient.GetSpan()[index] -
-             m_summation.GetSpan()[reduceIndex(index)]);
-    }
+    Compute::Softmax::BackwardAdd(m_layout, m_output.GetSpan(),
+                                  m_gradient.GetSpan(),
+                                  m_inputLogit.InputNode()->Gradient());
 }
 }  // namespace CubbyDNN::Node
\ No newline at end of file
@@ -5,8 +5,9 @@ namespace CubbyDNN::Node
 SoftmaxCE::SoftmaxCE(Core::Graph* graph, std::string_view name)
     : Node(graph, name),
       m_inputLabel(this, "label",
-                   [this](const auto* dy) { BackwardOpLabel(dy); }),
-      m_inputProb(this, "prob", [this](const auto* dy) { BackwardOpProb(dy); })
+                   NodeInput::Call<SoftmaxCE, &SoftmaxCE::BackwardOpLabel>),
+      m_inputProb(this, "prob",
+                  NodeInput::Call<SoftmaxCE, &SoftmaxCE::BackwardOpProb>)
 {
     m_nodeInputMap["label"] = &m_inputLabel;
     m_nodeInputMap["prob"] = &m_inputProb;
@@ -1,13 +1,36 @@
 #include <CubbyDNN/Optimizer/Momentum.hpp>
 
+#include <stdexcept>
 #include <utility>
 
 namespace CubbyDNN::Optimizer
 {
+namespace
+{
+void CheckTrainable(const std::vector<Node::Parameter*>& parameterList)
+{
+    for (auto* parameter : parameterList)
+    {
+        if (parameter->precision != Core::Precision::Float32)
+        {
+            throw std::runtime_error(
+                "Half-precision parameters cannot be trained");
+        }
+
+        if (parameter->GetSparseParameter())
+        {
+            throw std::runtime_error("Sparse parameters cannot be trained");
+        }
+    }
+}
+}  // namespace
+
 Momentum::Momentum(float _momentum,
                    std::initializer_list<Node::Parameter*> parameterList)
     : momentum(_momentum), m_parameterList(parameterList)
 {
+    CheckTrainable(m_parameterList);
+
     for (auto* parameter : m_parameterList)
     {
         m_momentumGradientList.emplace_back(
@@ -23,6 +46,8 @@ Momentum::Momentum(float _momentum,
 Momentum::Momentum(float _momentum, std::vector<Node::Parameter*> parameterList)
     : momentum(_momentum), m_parameterList(std::move(parameterList))
 {
+    CheckTrainable(m_parameterList);
+
     for (auto* parameter : m_parameterList)
     {
         m_momentumGradientList.emplace_back(
@@ -37,6 +62,18 @@ Momentum::Momentum(float _momentum, std::vector<Node::Parameter*> parameterList)
 
 void Momentum::Reduce(float learningRate, Node::Node* target)
 {
+    if (!m_backwardPlan || m_backwardPlan->Target() != target ||
+        !m_backwardPlan->IsCurrent())
+    {
+        m_backwardPlan = std::make_shared<Core::BackwardPlan>(
+            target, std::vector<Node::Node*>(m_parameterList.begin(),
+                                             m_parameterList.end()));
+    }
+
+    // Every gradient is taken at the current values before any of them is
+    // updated.
+    m_backwardPlan->Run();
+
     for (auto& momentumGradient : m_momentumGradientList)
     {
         for (auto& gradient : momentumGradient.GetSpan())
@@ -50,7 +87,7 @@ void Momentum::Reduce(float learningRate, Node::Node* target)
     for (auto* parameter : m_parameterList)
     {
         momentumGradient->GetSpan().AccumulateFrom(
-            -learningRate, parameter->EvalGradient(target).Gradient());
+            -learningRate, parameter->Gradient());
         parameter->GetParameter().AccumulateFrom(momentumGradient->GetSpan());
         parameter->MarkDirty(false);
 
@@ -0,0 +1,170 @@
+#include "doctest.h"
+#include "TestUtils.hpp"
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Optimizer/Momentum.hpp>
+
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+using Test::ToVector;
+
+constexpr std::size_t BatchSize = 6;
+
+// A ReLU MLP whose two middle layers share their weight and bias, so that
+// those parameters accumulate gradients from two consumers each.
+struct Network : Test::MLP
+{
+    Network() : MLP({ 4, 10, 16, 4, true })
+    {
+        Feed(0.0f);
+    }
+
+    void Feed(float offset)
+    {
+        MLP::Feed(BatchSize, 7, 4.0f, offset);
+    }
+
+    std::vector<std::vector<float>> PlannedGradients(Core::BackwardPlan& plan)
+    {
+        plan.Run();
+
+        std::vector<std::vector<float>> result;
+
+        for (auto* parameter : parameterList)
+        {
+            result.emplace_back(ToVector(parameter->Gradient()));
+        }
+
+        return result;
+    }
+
+    std::vector<Node::NodeWrapper> Sources() const
+    {
+        return std::vector<Node::NodeWrapper>(parameterList.begin(),
+                                              parameterList.end());
+    }
+};
+}  // namespace
+
+TEST_CASE("[BackwardPlan] - Gradients in one sweep")
+{
+    Network reference, swept;
+    auto plan = swept.graph.CompileBackward(swept.loss, swept.Sources());
+
+    // The loss, Softmax, four Dense and three ReLU nodes, and the six
+    // parameters; not the inputs.
+    CHECK(plan.StepCount() == 15);
+    CHECK(plan.Target() == swept.loss);
+    CHECK(swept.PlannedGradients(plan) == reference.Gradients());
+
+    CHECK(swept.PlannedGradients(plan) == reference.Gradients());
+
+    // A new batch.
+    Network fed;
+
+    fed.Feed(0.5f);
+    swept.Feed(0.5f);
+    CHECK(swept.PlannedGradients(plan) == fed.Gradients());
+
+    // A source the target does not depend on gets a zero gradient.
+    auto unused = swept.graph.Builder().Parameter(
+        "unused", Core::Shape{ 3 }, swept.graph.Builder().InitConstant(1.0f));
+    auto unusedPlan = swept.graph.CompileBackward(swept.loss, { unused });
+
+    unusedPlan.Run();
+    CHECK(ToVector(unused.node->Gradient()) ==
+          std::vector<float>(3, 0.0f));
+}
+
+TEST_CASE("[BackwardPlan] - Memory plans and checkpointing")
+{
+    Network reference, swept;
+    const auto expected = reference.Gradients();
+
+    swept.graph.PlanMemory({ swept.loss }, Core::PlanMode::Training);
+    swept.graph.EnableCheckpointing(swept.loss);
+
+    auto plan = swept.graph.CompileBackward(swept.loss, swept.Sources());
+
+    swept.loss->EvalOutput();
+    CHECK(swept.PlannedGradients(plan) == expected);
+
+    swept.graph.DisableCheckpointing();
+    swept.graph.PlanMemory({ swept.loss }, Core::PlanMode::Inference);
+
+    CHECK_THROWS(plan.Run());
+}
+
+TEST_CASE("[BackwardPlan] - Momentum takes every gradient before updating")
+{
+    Network reference, trained;
+    constexpr float LearningRate = 0.5f;
+
+    const auto gradientList = reference.Gradients();
+    Optimizer::Momentum optimizer(0.0f, trained.parameterList);
+
+    optimizer.Reduce(LearningRate, trained.loss);
+
+    // Without momentum, one step is plain gradient descent from the
+    // initial values.
+    for (std::size_t index = 0; index < gradientList.size(); ++index)
+    {
+        auto expected = ToVector(reference.parameterList[index]->Output());
+
+        for (std::size_t value = 0; value < expected.size(); ++value)
+        {
+            expected[value] -= LearningRate * gradientList[index][value];
+        }
+
+        CHECK(ToVector(trained.parameterList[index]->GetParameter()) ==
+              expected);
+    }
+}
+
+TEST_CASE("[BackwardPlan] - Attaching an input outdates plans")
+{
+    Network network;
+    const auto plan =
+        network.graph.CompileBackward(network.loss, network.Sources());
+
+    CHECK(plan.IsCurrent());
+
+    // Any new edge counts, even one that the plan would not step through.
+    network.graph.Builder().ReLU(network.loss, 0.0f);
+
+    CHECK(!plan.IsCurrent());
+    CHECK(network.graph.CompileBackward(network.loss, network.Sources())
+              .IsCurrent());
+}
+
+TEST_CASE("[BackwardPlan] - Momentum compiles again after rewiring")
+{
+    Network reference, trained;
+    constexpr float LearningRate = 0.5f;
+
+    Optimizer::Momentum referenceOptimizer(0.9f, reference.parameterList);
+    Optimizer::Momentum optimizer(0.9f, trained.parameterList);
+
+    referenceOptimizer.Reduce(LearningRate, reference.loss);
+    optimizer.Reduce(LearningRate, trained.loss);
+
+    // The loss stays the target, as the Softmax it reads is kept from
+    // fusing, but the Dense and ReLU nodes in between are detached.
+    const std::size_t version = trained.graph.Version();
+
+    trained.graph.Fuse({ trained.loss, (*trained.loss)["prob"]->InputNode() });
+    CHECK(trained.graph.Version() != version);
+
+    referenceOptimizer.Reduce(LearningRate, reference.loss);
+    optimizer.Reduce(LearningRate, trained.loss);
+
+    for (std::size_t index = 0; index < trained.parameterList.size(); ++index)
+    {
+        CHECK(ToVector(trained.parameterList[index]->GetParameter()) ==
+              ToVector(reference.parameterList[index]->GetParameter()));
+    }
+}
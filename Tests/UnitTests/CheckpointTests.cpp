@@ -0,0 +1,95 @@
+#include "doctest.h"
+#include "TestUtils.hpp"
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Optimizer/Momentum.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+using Test::ToVector;
+
+// A ReLU MLP with its Dense and ReLU nodes kept in evaluation order.
+struct Network : Test::MLP
+{
+    Network() : MLP({ 6, 12, 24, 5 })
+    {
+        Feed(7, 11, 5.0f, 1.0f);
+    }
+
+    std::size_t ReleasedCount() const
+    {
+        return static_cast<std::size_t>(std::count_if(
+            hiddenList.begin(), hiddenList.end(),
+            [](Node::Node* node) { return node->Output().Length() == 0; }));
+    }
+};
+}  // namespace
+
+TEST_CASE("[Checkpoint] - Explicit checkpoints")
+{
+    Network reference, checkpointed;
+
+    const auto expectedLoss = ToVector(reference.loss->EvalOutput().Output());
+    const auto expectedGradients = reference.Gradients();
+
+    checkpointed.graph.EnableCheckpointing(
+        checkpointed.loss,
+        { checkpointed.hiddenList[3], checkpointed.hiddenList[7] });
+
+    CHECK(ToVector(checkpointed.loss->EvalOutput().Output()) ==
+          expectedLoss);
+
+    // Only the checkpoints are left after the forward pass.
+    CHECK(checkpointed.ReleasedCount() == checkpointed.hiddenList.size() - 2);
+    CHECK(checkpointed.hiddenList[3]->Output().Length() > 0);
+    CHECK(checkpointed.hiddenList[7]->Output().Length() > 0);
+
+    CHECK(checkpointed.Gradients() == expectedGradients);
+
+    // A node read after it was dropped is recomputed.
+    CHECK(ToVector(checkpointed.hiddenList[5]->EvalOutput().Output()) ==
+          ToVector(reference.hiddenList[5]->EvalOutput().Output()));
+
+    checkpointed.graph.DisableCheckpointing();
+    checkpointed.loss->MarkDirty(false);
+    for (auto* node : checkpointed.hiddenList)
+    {
+        node->MarkDirty(false);
+    }
+
+    checkpointed.loss->EvalOutput();
+    CHECK(checkpointed.ReleasedCount() == 0);
+}
+
+TEST_CASE("[Checkpoint] - Training")
+{
+    Network reference, checkpointed;
+
+    checkpointed.graph.EnableCheckpointing(checkpointed.loss);
+
+    Optimizer::Momentum referenceOptimizer(0.9f, reference.parameterList);
+    Optimizer::Momentum checkpointedOptimizer(0.9f,
+                                              checkpointed.parameterList);
+
+    for (std::size_t step = 0; step < 3; ++step)
+    {
+        CHECK(ToVector(checkpointed.loss->EvalOutput().Output()) ==
+              ToVector(reference.loss->EvalOutput().Output()));
+        CHECK(checkpointed.ReleasedCount() > 0);
+
+        referenceOptimizer.Reduce(0.01f, reference.loss);
+        checkpointedOptimizer.Reduce(0.01f, checkpointed.loss);
+    }
+
+    for (std::size_t index = 0; index < reference.parameterList.size();
+         ++index)
+    {
+        CHECK(ToVector(checkpointed.parameterList[index]->GetParameter()) ==
+              ToVector(reference.parameterList[index]->GetParameter()));
+    }
+}
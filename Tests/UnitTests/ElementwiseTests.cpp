@@ -0,0 +1,131 @@
+#include "doctest.h"
+
+#include <CubbyDNN/Compute/Elementwise.hpp>
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+#include <CubbyDNN/Core/Graph.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+// Every length up to two AVX-512 vectors and past them, so that every kernel
+// runs its vector loop and its tail.
+std::vector<std::size_t> LengthList()
+{
+    std::vector<std::size_t> result;
+
+    for (std::size_t length = 0; length <= 33; ++length)
+    {
+        result.emplace_back(length);
+    }
+
+    result.emplace_back(1000);
+
+    return result;
+}
+
+// Negative, positive and both zeros.
+float Value(std::size_t index)
+{
+    return index % 9 == 4 ? -0.0f : static_cast<float>(index % 9) - 4.0f;
+}
+
+void CheckLeakyReLU(const Compute::ActivationKernel& kernel, float alpha)
+{
+    for (const auto length : LengthList())
+    {
+        std::vector<float> x(length), y(length), dy(length), dx(length);
+        std::vector<float> expected(length), expectedGradient(length);
+
+        for (std::size_t index = 0; index < length; ++index)
+        {
+            x[index] = Value(index);
+            dy[index] = static_cast<float>(index % 5) + 0.5f;
+            dx[index] = 1.0f;
+            expected[index] = x[index] < 0.0f ? alpha * x[index] : x[index];
+            expectedGradient[index] =
+                x[index] <= 0.0f ? alpha * dy[index] : dy[index];
+        }
+
+        kernel.forward(length, alpha, x.data(), y.data());
+        CHECK(y == expected);
+
+        // The zeros keep their sign, as the scalar comparison has it.
+        for (std::size_t index = 0; index < length; ++index)
+        {
+            CHECK(std::signbit(y[index]) == std::signbit(expected[index]));
+        }
+
+        kernel.backward(length, alpha, x.data(), dy.data(), dx.data(), true);
+
+        for (std::size_t index = 0; index < length; ++index)
+        {
+            CHECK(dx[index] == 1.0f + expectedGradient[index]);
+        }
+
+        // In place, as chains run them.
+        kernel.backward(length, alpha, x.data(), dy.data(), dy.data(), false);
+        CHECK(dy == expectedGradient);
+
+        kernel.forward(length, alpha, x.data(), x.data());
+        CHECK(x == expected);
+    }
+}
+}  // namespace
+
+TEST_CASE("[Elementwise] - Leaky ReLU kernels")
+{
+    for (const auto candidate : { Compute::ISA::Scalar, Compute::ISA::SSE42,
+                                  Compute::ISA::AVX2, Compute::ISA::AVX512 })
+    {
+        if (!Compute::CPUInfo::IsSupported(candidate))
+        {
+            continue;
+        }
+
+        for (const float alpha : { 0.0f, 0.01f, -0.5f })
+        {
+            CheckLeakyReLU(Compute::KernelRegistry::Get(candidate).leakyReLU,
+                           alpha);
+        }
+    }
+}
+
+TEST_CASE("[Elementwise] - ReLU over many chunks")
+{
+    // More values than one thread takes, so that the chunks are split when
+    // there is more than one.
+    constexpr std::size_t NumRow = 300, NumColumn = 700;
+
+    Core::Graph graph;
+    auto logit = graph.Builder().Input("logit");
+    auto relu = graph.Builder().ReLU(logit, 0.1f);
+    std::vector<float> data(NumRow * NumColumn);
+
+    for (std::size_t index = 0; index < data.size(); ++index)
+    {
+        data[index] = Value(index);
+    }
+
+    graph.Feed({ { "logit", Core::Shape{ NumRow, NumColumn },
+                   Core::Span<float>(data.data(), data.size()) } });
+
+    const auto output = relu.EvalOutput().Output();
+    const auto gradient = logit.node->EvalGradient(relu.node).Gradient();
+    bool isEqual = true;
+
+    for (std::size_t index = 0; index < data.size(); ++index)
+    {
+        const bool isNegative = data[index] < 0.0f;
+
+        isEqual = isEqual &&
+                  output[index] == (isNegative ? 0.1f * data[index]
+                                               : data[index]) &&
+                  gradient[index] == (data[index] <= 0.0f ? 0.1f : 1.0f);
+    }
+
+    CHECK(isEqual);
+}
\ No newline at end of file
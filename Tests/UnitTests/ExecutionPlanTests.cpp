@@ -0,0 +1,154 @@
+#include "doctest.h"
+#include "TestUtils.hpp"
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+#include <CubbyDNN/Optimizer/Momentum.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+using Test::ToVector;
+
+const Test::MLPLayout Layout{ 3, 10, 16, 4 };
+
+struct Network : Test::MLP
+{
+    Network() : MLP(Layout)
+    {
+    }
+
+    void Feed(std::size_t batchSize, float offset)
+    {
+        MLP::Feed(batchSize, 7, 3.0f, offset);
+    }
+};
+}  // namespace
+
+TEST_CASE("[ExecutionPlan] - Forward pass")
+{
+    Network reference, compiled;
+
+    reference.Feed(5, 1.0f);
+    compiled.Feed(5, 1.0f);
+
+    auto plan = compiled.graph.Compile({ compiled.prob, compiled.loss });
+
+    // x, y, three Dense layers with their parameters and activations, and
+    // the loss.
+    CHECK(plan.StepCount() == 2 + Layout.numLayer * 4 + 1);
+
+    plan.Run();
+    CHECK(ToVector(compiled.loss->Output()) ==
+          ToVector(reference.loss->EvalOutput().Output()));
+    CHECK(ToVector(compiled.prob->Output()) ==
+          ToVector(reference.prob->EvalOutput().Output()));
+
+    // New data of the same shape, then a different batch size.
+    for (const auto& [batchSize, offset] :
+         { std::pair<std::size_t, float>{ 5, 0.5f }, { 12, 0.25f } })
+    {
+        reference.Feed(batchSize, offset);
+        compiled.Feed(batchSize, offset);
+
+        plan.Run();
+        CHECK(compiled.prob->Shape() ==
+              (Core::Shape{ Layout.numClass, batchSize }));
+        CHECK(ToVector(compiled.prob->Output()) ==
+              ToVector(reference.prob->EvalOutput().Output()));
+        CHECK(ToVector(compiled.loss->Output()) ==
+              ToVector(reference.loss->EvalOutput().Output()));
+    }
+}
+
+TEST_CASE("[ExecutionPlan] - Training and memory plans")
+{
+    Network reference, compiled;
+
+    reference.Feed(6, 0.5f);
+    compiled.Feed(6, 0.5f);
+
+    auto plan = compiled.graph.Compile({ compiled.loss });
+
+    Optimizer::Momentum referenceOptimizer(0.9f, reference.parameterList);
+    Optimizer::Momentum compiledOptimizer(0.9f, compiled.parameterList);
+
+    // The gradients read the outputs the plan computed; the updated
+    // parameters dirty the nodes it runs again.
+    for (std::size_t step = 0; step < 3; ++step)
+    {
+        plan.Run();
+        CHECK(ToVector(compiled.loss->Output()) ==
+              ToVector(reference.loss->EvalOutput().Output()));
+
+        referenceOptimizer.Reduce(0.1f, reference.loss);
+        compiledOptimizer.Reduce(0.1f, compiled.loss);
+    }
+
+    // Under an inference memory plan, outputs are overwritten as the plan
+    // goes, and one read afterwards is recomputed.
+    compiled.graph.PlanMemory({ compiled.loss }, Core::PlanMode::Inference);
+    plan.Run();
+
+    CHECK(ToVector(compiled.loss->Output()) ==
+          ToVector(reference.loss->EvalOutput().Output()));
+    CHECK(ToVector(compiled.prob->EvalOutput().Output()) ==
+          ToVector(reference.prob->EvalOutput().Output()));
+}
+
+TEST_CASE("[ExecutionPlan] - Parallel execution")
+{
+    Core::ThreadPool pool(4);
+    Core::SetDefaultThreadPool(&pool);
+
+    // Four networks side by side in one graph: the towers are independent
+    // branches, and the labels are independent of the towers.
+    constexpr std::size_t NumTower = 4, BatchSize = 40;
+
+    Network reference;
+    Core::Graph graph;
+    auto& builder = graph.Builder();
+    std::vector<Node::NodeWrapper> targetList;
+
+    reference.Feed(BatchSize, 0.5f);
+
+    for (std::size_t tower = 0; tower < NumTower; ++tower)
+    {
+        const auto id = std::to_string(tower);
+        std::vector<Node::Node*> hiddenList;
+        std::vector<Node::Parameter*> parameterList;
+        auto* prob = Test::AddMLP(graph, builder.Input("x" + id), Layout,
+                                  "/" + id, hiddenList, parameterList);
+
+        targetList.emplace_back(
+            builder.SoftmaxCE(builder.Input("y" + id), prob));
+        graph.Feed({ { "x" + id, Core::Shape{ Layout.numInput, BatchSize },
+                       Test::ToSpan(reference.input) },
+                     { "y" + id, Core::Shape{ Layout.numClass, BatchSize },
+                       Test::ToSpan(reference.label) } });
+    }
+
+    auto plan = graph.Compile(targetList);
+    const auto expected = ToVector(reference.loss->EvalOutput().Output());
+
+    for (std::size_t run = 0; run < 3; ++run)
+    {
+        for (auto& target : targetList)
+        {
+            target.node->MarkDirty(false);
+        }
+
+        plan.RunParallel();
+
+        for (auto& target : targetList)
+        {
+            CHECK(ToVector(target.node->Output()) == expected);
+        }
+    }
+
+    Core::SetDefaultThreadPool(nullptr);
+}
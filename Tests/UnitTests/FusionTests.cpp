@@ -0,0 +1,424 @@
+#include "doctest.h"
+#include "TestUtils.hpp"
+
+#include <CubbyDNN/Compute/Elementwise.hpp>
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+#include <CubbyDNN/Node/FusedDense.hpp>
+#include <CubbyDNN/Node/FusedElementwise.hpp>
+#include <CubbyDNN/Node/FusedSoftmaxCE.hpp>
+#include <CubbyDNN/Node/ReLU.hpp>
+#include <CubbyDNN/Node/Softmax.hpp>
+#include <CubbyDNN/Optimizer/Momentum.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+using Test::ToVector;
+
+const Test::MLPLayout Layout{ 4, 9, 20, 5 };
+constexpr std::size_t BatchSize = 12;
+
+// The fused nodes skip the 1e-4 that Softmax and SoftmaxCE guard with, and
+// sum in another order. The guard biases the gradients of the reference by
+// up to ~1e-4 / prob, relative to the largest of them; finite differences
+// side with the fused ones.
+bool IsClose(const std::vector<float>& lhs, const std::vector<float>& rhs,
+             float tolerance = 1e-3f)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    float maxValue = 0.0f;
+
+    for (const auto value : rhs)
+    {
+        maxValue = std::max(maxValue, std::abs(value));
+    }
+
+    for (std::size_t index = 0; index < lhs.size(); ++index)
+    {
+        if (std::abs(lhs[index] - rhs[index]) > 1e-5f + tolerance * maxValue)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// A leaky ReLU MLP ending in a Softmax and a SoftmaxCE.
+struct Network : Test::MLP
+{
+    Network() : MLP(Layout)
+    {
+        Feed(BatchSize, 11, 5.0f, 1.0f);
+    }
+};
+
+bool IsClose(const std::vector<std::vector<float>>& lhs,
+             const std::vector<std::vector<float>>& rhs)
+{
+    return lhs.size() == rhs.size() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin(),
+                      [](const auto& left, const auto& right) {
+                          return IsClose(left, right, 1e-2f);
+                      });
+}
+}  // namespace
+
+TEST_CASE("[Fusion] - Dense, ReLU, Softmax and SoftmaxCE")
+{
+    Network reference, fused;
+    const auto* loss = fused.loss;
+
+    fused.loss = fused.graph.Fuse({ fused.loss }).front();
+
+    CHECK(fused.graph.NodeCount<Node::FusedDense>() == Layout.numLayer - 1);
+    CHECK(fused.graph.NodeCount<Node::FusedSoftmaxCE>() == 1);
+    CHECK(fused.loss != loss);
+    CHECK(fused.graph.Node<Node::FusedSoftmaxCE>(fused.loss->name) ==
+          fused.loss);
+
+    // The replaced nodes are left unattached.
+    CHECK(!*(*fused.graph.Node("ReLU0"))["logit"]);
+    CHECK(!*(*fused.graph.Node("SoftmaxCE0"))["prob"]);
+
+    CHECK(IsClose(ToVector(fused.loss->EvalOutput().Output()),
+                  ToVector(reference.loss->EvalOutput().Output())));
+    CHECK(IsClose(
+        ToVector(fused.graph.Node<Node::FusedSoftmaxCE>(fused.loss->name)
+                     ->Probability()),
+        ToVector(reference.prob->Output())));
+    CHECK(IsClose(fused.Gradients(), reference.Gradients()));
+
+    // Compiled plans run the fused nodes like any other.
+    auto plan = fused.graph.Compile({ fused.loss });
+    auto backwardPlan = fused.graph.CompileBackward(
+        fused.loss, std::vector<Node::NodeWrapper>(fused.parameterList.begin(),
+                                                   fused.parameterList.end()));
+
+    fused.loss->MarkDirty();
+    plan.Run();
+    backwardPlan.Run();
+
+    std::vector<std::vector<float>> gradientList;
+
+    for (auto* parameter : fused.parameterList)
+    {
+        gradientList.emplace_back(ToVector(parameter->Gradient()));
+    }
+
+    CHECK(IsClose(gradientList, reference.Gradients()));
+}
+
+TEST_CASE("[Fusion] - What is left alone")
+{
+    Network network;
+    auto& builder = network.graph.Builder();
+
+    // A Dense read by something else besides its ReLU, and a ReLU with a
+    // negative alpha, whose sign cannot be told from its output.
+    auto* dense = (*network.graph.Node("ReLU1"))["logit"]->InputNode();
+    auto* shared = builder.ReLU(dense, 0.0f).node;
+    auto* negative = builder.ReLU(
+        builder.Dense(network.graph.Node("x"),
+                      builder.Parameter("w", Core::Shape{ 2, Layout.numInput },
+                                        builder.InitConstant(1.0f)),
+                      builder.Parameter("b", Core::Shape{ 2 },
+                                        builder.InitConstant(0.0f))),
+        -0.5f).node;
+
+    // A target is not fused away, though the node that reads it may be.
+    const auto targetList =
+        network.graph.Fuse({ network.loss, network.prob, shared, negative });
+
+    CHECK(network.graph.NodeCount<Node::FusedDense>() == Layout.numLayer - 2);
+    CHECK(network.graph.NodeCount<Node::FusedSoftmaxCE>() == 0);
+    CHECK((targetList == std::vector<Node::Node*>{ network.loss,
+                                                   network.prob, shared,
+                                                   negative }));
+
+    // A Softmax over an axis after one it leaves out has groups that are
+    // not contiguous.
+    CHECK(Node::FusedSoftmaxCE::IsFusable({ true, false }));
+    CHECK(Node::FusedSoftmaxCE::IsFusable({}));
+    CHECK(!Node::FusedSoftmaxCE::IsFusable({ false, true }));
+
+    Network planned;
+
+    planned.graph.PlanMemory({ planned.loss }, Core::PlanMode::Training);
+    CHECK_THROWS(planned.graph.Fuse({ planned.loss }));
+}
+
+TEST_CASE("[Fusion] - Training")
+{
+    Network reference, fused;
+    constexpr float LearningRate = 0.1f;
+
+    fused.loss = fused.graph.Fuse({ fused.loss }).front();
+    fused.graph.PlanMemory({ fused.loss }, Core::PlanMode::Training);
+    fused.graph.EnableCheckpointing(fused.loss);
+
+    Optimizer::Momentum referenceOptimizer(0.9f, reference.parameterList);
+    Optimizer::Momentum fusedOptimizer(0.9f, fused.parameterList);
+
+    for (std::size_t step = 0; step < 3; ++step)
+    {
+        referenceOptimizer.Reduce(LearningRate, reference.loss);
+        fusedOptimizer.Reduce(LearningRate, fused.loss);
+    }
+
+    for (std::size_t index = 0; index < fused.parameterList.size(); ++index)
+    {
+        CHECK(IsClose(
+            ToVector(fused.parameterList[index]->GetParameter()),
+            ToVector(reference.parameterList[index]->GetParameter()),
+            1e-2f));
+    }
+}
+
+TEST_CASE("[Fusion] - Products of exactly zero")
+{
+    // With a weight of ones, the samples sum to zero, more or less in turn,
+    // in every row of the product; sums of integers are exact in any order.
+    // A ReLU passes alpha times the gradient on at zero, fused or not.
+    const auto build = [](Core::Graph& graph, std::vector<float>& data,
+                          float alpha) {
+        auto& builder = graph.Builder();
+        auto w = builder.Parameter(
+            "w", Core::Shape{ Layout.width, Layout.numInput },
+            builder.InitConstant(1.0f));
+        auto b = builder.Parameter("b", Core::Shape{ Layout.width },
+                                   builder.InitConstant(0.0f));
+        auto relu = builder.ReLU(builder.Dense(builder.Input("x"), w, b),
+                                 alpha);
+
+        for (std::size_t index = 0; index < data.size(); ++index)
+        {
+            const auto value = static_cast<float>(index % Layout.numInput);
+
+            switch (index / Layout.numInput % 3)
+            {
+                case 0:
+                    data[index] = value - (Layout.numInput - 1) / 2.0f;
+                    break;
+                case 1:
+                    data[index] = value;
+                    break;
+                default:
+                    data[index] = -value - 1.0f;
+                    break;
+            }
+        }
+
+        graph.Feed({ { "x", Core::Shape{ Layout.numInput, BatchSize },
+                       Test::ToSpan(data) } });
+
+        return relu.node;
+    };
+
+    for (const float alpha : { 0.0f, 0.1f })
+    {
+        Core::Graph referenceGraph, graph;
+        std::vector<float> referenceData(Layout.numInput * BatchSize);
+        std::vector<float> data(Layout.numInput * BatchSize);
+        auto* reference = build(referenceGraph, referenceData, alpha);
+        auto* fused = graph.Fuse({ build(graph, data, alpha) }).front();
+
+        CHECK(graph.NodeCount<Node::FusedDense>() == 1);
+        CHECK(ToVector(fused->EvalOutput().Output()) ==
+              ToVector(reference->EvalOutput().Output()));
+
+        for (const auto* name : { "x", "w", "b" })
+        {
+            CHECK(ToVector(graph.Node(name)->EvalGradient(fused).Gradient()) ==
+                  ToVector(referenceGraph.Node(name)
+                               ->EvalGradient(reference)
+                               .Gradient()));
+        }
+    }
+}
+
+TEST_CASE("[Fusion] - Element-wise chains")
+{
+    const std::vector<Compute::ElementwiseOp> opList{
+        { Compute::ElementwiseType::ReLU, 0.5f },
+        { Compute::ElementwiseType::ReLU, 0.0f },
+        { Compute::ElementwiseType::ReLU, -2.0f },
+    };
+
+    // Lengths around the chunk size, each step checked against its own loop.
+    for (const std::size_t size :
+         { std::size_t{ 1 }, Compute::Elementwise::ChunkSize - 1,
+           Compute::Elementwise::ChunkSize * 3 + 5 })
+    {
+        std::vector<float> input(size), output(size), expected(size);
+        std::vector<float> gradient(size), inputGradient(size, 1.0f);
+        std::vector<float> expectedGradient(size, 1.0f);
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            input[index] = static_cast<float>(index % 7) - 3.0f;
+            gradient[index] = static_cast<float>(index % 5) + 1.0f;
+        }
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            float value = input[index], slope = 1.0f;
+
+            for (const auto& op : opList)
+            {
+                slope *= value <= 0.0f ? op.alpha : 1.0f;
+                value = value < 0.0f ? op.alpha * value : value;
+            }
+
+            expected[index] = value;
+            expectedGradient[index] += gradient[index] * slope;
+        }
+
+        Compute::Elementwise::Forward(
+            opList, Core::Span<float>(input.data(), size),
+            Core::Span<float>(output.data(), size));
+        Compute::Elementwise::BackwardAdd(
+            opList, Core::Span<float>(input.data(), size),
+            Core::Span<float>(gradient.data(), size),
+            Core::Span<float>(inputGradient.data(), size));
+
+        CHECK(output == expected);
+        CHECK(inputGradient == expectedGradient);
+
+        // In place.
+        Compute::Elementwise::Forward(opList,
+                                      Core::Span<float>(input.data(), size),
+                                      Core::Span<float>(input.data(), size));
+        CHECK(input == expected);
+    }
+
+    // Chains of ReLUs over an input and after a Dense, whose first ReLU is
+    // fused into it, are the same ops: the results match exactly.
+    const auto build = [](Core::Graph& graph, std::vector<float>& data) {
+        auto& builder = graph.Builder();
+        auto x = builder.Input("x");
+        auto w = builder.Parameter(
+            "w", Core::Shape{ Layout.width, Layout.numInput },
+            builder.InitXavier(0, Layout.numInput, Layout.width));
+        auto b = builder.Parameter("b", Core::Shape{ Layout.width },
+                                   builder.InitConstant(0.1f));
+        Node::Node* chain = x;
+        Node::Node* denseChain = builder.Dense(x, w, b);
+
+        for (const float alpha : { 0.1f, 0.0f, -0.5f })
+        {
+            chain = builder.ReLU(chain, alpha);
+            denseChain = builder.ReLU(denseChain, alpha);
+        }
+
+        for (std::size_t index = 0; index < data.size(); ++index)
+        {
+            data[index] = static_cast<float>(index % 11) / 5.0f - 1.0f;
+        }
+
+        graph.Feed({ { "x", Core::Shape{ Layout.numInput, BatchSize },
+                       Test::ToSpan(data) } });
+
+        return std::vector<Node::Node*>{ chain, denseChain };
+    };
+
+    Core::Graph referenceGraph, graph;
+    std::vector<float> referenceData(Layout.numInput * BatchSize);
+    std::vector<float> data(Layout.numInput * BatchSize);
+    const auto reference = build(referenceGraph, referenceData);
+    const auto fused = build(graph, data);
+    const auto targetList = graph.Fuse({ fused[0], fused[1] });
+
+    CHECK(graph.NodeCount<Node::FusedElementwise>() == 2);
+    CHECK(graph.NodeCount<Node::FusedDense>() == 1);
+    CHECK(graph.Node<Node::FusedElementwise>(targetList[0]->name)->opList
+              .size() == 3);
+    CHECK(graph.Node<Node::FusedElementwise>(targetList[1]->name)->opList
+              .size() == 2);
+
+    for (std::size_t index = 0; index < 2; ++index)
+    {
+        CHECK(ToVector(targetList[index]->EvalOutput().Output()) ==
+              ToVector(reference[index]->EvalOutput().Output()));
+    }
+
+    CHECK(ToVector(graph.Node("x")->EvalGradient(targetList[0]).Gradient()) ==
+          ToVector(referenceGraph.Node("x")
+                       ->EvalGradient(reference[0])
+                       .Gradient()));
+    CHECK(IsClose(
+        ToVector(graph.Node("w")->EvalGradient(targetList[1]).Gradient()),
+        ToVector(referenceGraph.Node("w")
+                     ->EvalGradient(reference[1])
+                     .Gradient())));
+}
+
+TEST_CASE("[Fusion] - Softmax and SoftmaxCE on several threads")
+{
+    // Enough values for Compute::Elementwise::ThreadCount to pick more than
+    // one thread.
+    constexpr std::size_t NumGroup = 32768;
+
+    std::vector<float> logit(Layout.numClass * NumGroup);
+    std::vector<float> label(Layout.numClass * NumGroup, 0.0f);
+
+    for (std::size_t index = 0; index < logit.size(); ++index)
+    {
+        logit[index] = static_cast<float>(index % 13) / 4.0f - 1.5f;
+    }
+
+    for (std::size_t group = 0; group < NumGroup; ++group)
+    {
+        label[group * Layout.numClass + group % Layout.numClass] = 1.0f;
+    }
+
+    const auto build = [&](Core::Graph& graph) {
+        auto& builder = graph.Builder();
+        auto loss = builder.SoftmaxCE(
+            builder.Input("y"),
+            builder.Softmax(builder.Input("x"), { true, false }));
+
+        graph.Feed(
+            { { "x", Core::Shape{ Layout.numClass, NumGroup },
+                Test::ToSpan(logit) },
+              { "y", Core::Shape{ Layout.numClass, NumGroup },
+                Test::ToSpan(label) } });
+
+        return loss.node;
+    };
+
+    Core::Graph referenceGraph, graph;
+    auto* reference = build(referenceGraph);
+    auto* fused = graph.Fuse({ build(graph) }).front();
+    const auto* node = graph.Node<Node::FusedSoftmaxCE>(fused->name);
+
+    Core::ThreadPool serialPool(1), pool(4);
+
+    Core::SetDefaultThreadPool(&serialPool);
+    const auto expected = ToVector(fused->EvalOutput().Output());
+    const auto expectedProbability = ToVector(node->Probability());
+
+    // The same values, whatever the number of threads.
+    Core::SetDefaultThreadPool(&pool);
+    fused->MarkDirty(false);
+
+    CHECK(ToVector(fused->EvalOutput().Output()) == expected);
+    CHECK(ToVector(node->Probability()) == expectedProbability);
+
+    CHECK(IsClose(expected, ToVector(reference->EvalOutput().Output())));
+    CHECK(IsClose(
+        expectedProbability,
+        ToVector((*reference)["prob"]->InputNode()->Output())));
+
+    Core::SetDefaultThreadPool(nullptr);
+}
\ No newline at end of file
@@ -0,0 +1,588 @@
+#include "doctest.h"
+#include "TestUtils.hpp"
+
+#include <CubbyDNN/Compute/GEMM.hpp>
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+using Test::RandomVector;
+using Test::ToSpan;
+
+using MultiplyAddFunction = void (*)(std::size_t, std::size_t, std::size_t,
+                                     const Core::Span<float>,
+                                     const Core::Span<float>,
+                                     Core::Span<float>) noexcept;
+using ShapeList = std::vector<std::array<std::size_t, 3>>;
+
+void CheckMultiplyAdd(MultiplyAddFunction multiplyAdd,
+                      const ShapeList& shapeList)
+{
+    std::mt19937 engine(0);
+
+    for (const auto& shape : shapeList)
+    {
+        const std::size_t maxIndex = shape[0];
+        const std::size_t numRow = shape[1];
+        const std::size_t numColumn = shape[2];
+
+        auto left = RandomVector(numRow * maxIndex, engine);
+        auto right = RandomVector(numColumn * maxIndex, engine);
+        auto destination = RandomVector(numRow * numColumn, engine);
+        auto expected = destination;
+
+        for (std::size_t numR = 0; numR < numRow; ++numR)
+        {
+            for (std::size_t numC = 0; numC < numColumn; ++numC)
+            {
+                for (std::size_t numIndex = 0; numIndex < maxIndex;
+                     ++numIndex)
+                {
+                    expected[numR * numColumn + numC] +=
+                        left[numR * maxIndex + numIndex] *
+                        right[numC * maxIndex + numIndex];
+                }
+            }
+        }
+
+        multiplyAdd(maxIndex, numRow, numColumn, ToSpan(left), ToSpan(right),
+                    ToSpan(destination));
+
+        for (std::size_t index = 0; index < expected.size(); ++index)
+        {
+            CHECK(destination[index] ==
+                  doctest::Approx(expected[index]).epsilon(1e-3));
+        }
+    }
+}
+
+void CheckAllKernels(MultiplyAddFunction multiplyAdd,
+                     const ShapeList& shapeList)
+{
+    const auto isa = Compute::KernelRegistry::Active().isa;
+
+    // Every kernel the machine can run has to agree with the reference.
+    for (const auto candidate : { Compute::ISA::Scalar, Compute::ISA::SSE42,
+                                  Compute::ISA::AVX2, Compute::ISA::AVX512 })
+    {
+        if (Compute::CPUInfo::IsSupported(candidate))
+        {
+            Compute::KernelRegistry::Bind(candidate);
+            CheckMultiplyAdd(multiplyAdd, shapeList);
+        }
+    }
+
+    Compute::KernelRegistry::Bind(isa);
+}
+
+template <typename T>
+void CheckInt8Gemm(std::mt19937& engine)
+{
+    // Shapes cover fringe tiles, k not a multiple of 4 and multiple K blocks.
+    const std::size_t shapeList[][3] = {
+        { 1, 1, 1 }, { 7, 5, 3 }, { 17, 33, 130 }, { 64, 300, 784 },
+        { 9, 40, 2100 }
+    };
+
+    const std::int32_t maxWeight = Compute::GEMM::Int8MaxWeight();
+    std::uniform_int_distribution<std::int32_t> aDist(
+        std::is_signed_v<T> ? -127 : 0, std::is_signed_v<T> ? 127 : 255);
+    std::uniform_int_distribution<std::int32_t> bDist(-maxWeight, maxWeight);
+
+    for (const auto& shape : shapeList)
+    {
+        const std::size_t m = shape[0], n = shape[1], k = shape[2];
+        // Padded strides exercise strided rows.
+        const std::size_t lda = k + 5, ldb = k + 3, ldc = n + 2;
+
+        std::vector<T> a(m * lda);
+        std::vector<std::int8_t> b(n * ldb);
+        std::vector<std::int32_t> c(m * ldc, -1);
+
+        for (auto& value : a)
+        {
+            value = static_cast<T>(aDist(engine));
+        }
+
+        for (auto& value : b)
+        {
+            value = static_cast<std::int8_t>(bDist(engine));
+        }
+
+        const Core::Span<T> aSpan(a.data(), a.size());
+        const Core::Span<std::int8_t> bSpan(b.data(), b.size());
+        const Core::Span<std::int32_t> cSpan(c.data(), c.size());
+
+        if constexpr (std::is_signed_v<T>)
+        {
+            Compute::GEMM::GemmS8S8(m, n, k, aSpan, lda, bSpan, ldb, cSpan,
+                                    ldc);
+        }
+        else
+        {
+            Compute::GEMM::GemmU8S8(m, n, k, aSpan, lda, bSpan, ldb, cSpan,
+                                    ldc);
+        }
+
+        for (std::size_t numR = 0; numR < m; ++numR)
+        {
+            for (std::size_t numC = 0; numC < n; ++numC)
+            {
+                std::int32_t expected = 0;
+
+                for (std::size_t numK = 0; numK < k; ++numK)
+                {
+                    expected +=
+                        static_cast<std::int32_t>(a[numR * lda + numK]) *
+                        b[numC * ldb + numK];
+                }
+
+                CHECK(c[numR * ldc + numC] == expected);
+            }
+        }
+    }
+}
+
+// Half-precision b through Gemm (both layouts) and MultiplyAddGEMV, against
+// a reference on the widened values: only the storage is narrow, so the
+// result has to match fp32 arithmetic.
+template <typename T>
+void CheckHalfGemm(std::mt19937& engine)
+{
+    using Transpose = Compute::GEMM::Transpose;
+
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    const std::size_t shapeList[][3] = { { 1, 1, 1 },
+                                         { 3, 5, 37 },
+                                         { 9, 13, 300 },
+                                         { 37, 70, 530 } };
+
+    for (const auto& shape : shapeList)
+    {
+        const std::size_t m = shape[0], n = shape[1], k = shape[2];
+
+        for (const auto transB : { Transpose::NoTrans, Transpose::Trans })
+        {
+            const bool isTransB = transB == Transpose::Trans;
+            const std::size_t ldb = (isTransB ? k : n) + 3;
+
+            auto a = RandomVector(m * k, engine);
+            auto c = RandomVector(m * n, engine);
+            std::vector<T> b((isTransB ? n : k) * ldb);
+
+            for (auto& value : b)
+            {
+                value = T::FromFloat(dist(engine));
+            }
+
+            auto expected = c;
+
+            for (std::size_t numR = 0; numR < m; ++numR)
+            {
+                for (std::size_t numC = 0; numC < n; ++numC)
+                {
+                    for (std::size_t numK = 0; numK < k; ++numK)
+                    {
+                        expected[numR * n + numC] +=
+                            a[numR * k + numK] *
+                            b[isTransB ? numC * ldb + numK
+                                       : numK * ldb + numC]
+                                .ToFloat();
+                    }
+                }
+            }
+
+            auto gemv = c;
+            const Core::Span<T> bSpan(b.data(), b.size());
+
+            Compute::GEMM::Gemm(Transpose::NoTrans, transB, m, n, k, 1.0f,
+                                ToSpan(a), k, bSpan, ldb, 1.0f, ToSpan(c), n);
+
+            for (std::size_t index = 0; index < expected.size(); ++index)
+            {
+                CHECK(c[index] ==
+                      doctest::Approx(expected[index]).epsilon(1e-3));
+            }
+
+            // The GEMV path takes the Dense weight layout (n x k, no padding).
+            if (isTransB)
+            {
+                std::vector<T> weight(n * k);
+
+                for (std::size_t numC = 0; numC < n; ++numC)
+                {
+                    std::copy(b.begin() + numC * ldb,
+                              b.begin() + numC * ldb + k,
+                              weight.begin() + numC * k);
+                }
+
+                Compute::GEMM::MultiplyAddGEMV(
+                    k, m, n, ToSpan(a), Core::Span<T>(weight.data(), n * k),
+                    ToSpan(gemv));
+
+                for (std::size_t index = 0; index < expected.size(); ++index)
+                {
+                    CHECK(gemv[index] ==
+                          doctest::Approx(expected[index]).epsilon(1e-3));
+                }
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST_CASE("[GEMM] - MultiplyAdd")
+{
+    // Shapes cover full register tiles, fringe tiles and multiple KC blocks.
+    CheckAllKernels(Compute::GEMM::MultiplyAdd,
+                    { { 1, 1, 1 },
+                      { 7, 5, 3 },
+                      { 17, 13, 35 },
+                      { 784, 32, 300 },
+                      { 513, 70, 33 },
+                      { 300, 600, 10 } });
+}
+
+TEST_CASE("[GEMM] - MultiplyAddGEMV")
+{
+    // Every batch size up to the kernel limit and one past it, with lengths
+    // that leave a vector tail and row counts that leave a row remainder.
+    ShapeList shapeList;
+
+    for (std::size_t numRow = 1; numRow <= 9; ++numRow)
+    {
+        shapeList.push_back({ 37, numRow, 13 });
+        shapeList.push_back({ 784, numRow, 300 });
+    }
+
+    shapeList.push_back({ 5, 2, 1 });
+
+    CheckAllKernels(Compute::GEMM::MultiplyAddGEMV, shapeList);
+}
+
+TEST_CASE("[GEMM] - Gemm")
+{
+    using Transpose = Compute::GEMM::Transpose;
+
+    std::mt19937 engine(1);
+
+    const std::size_t m = 37, n = 21, k = 300;
+    // Leading dimensions larger than the logical width exercise strided rows.
+    const std::size_t padding = 3;
+
+    for (const auto transA : { Transpose::NoTrans, Transpose::Trans })
+    {
+        for (const auto transB : { Transpose::NoTrans, Transpose::Trans })
+        {
+            for (const float beta : { 0.0f, 1.0f, -1.5f })
+            {
+                const float alpha = 0.5f;
+                const bool isTransA = transA == Transpose::Trans;
+                const bool isTransB = transB == Transpose::Trans;
+
+                const std::size_t lda = (isTransA ? m : k) + padding;
+                const std::size_t ldb = (isTransB ? k : n) + padding;
+                const std::size_t ldc = n + padding;
+
+                auto a = RandomVector((isTransA ? k : m) * lda, engine);
+                auto b = RandomVector((isTransB ? n : k) * ldb, engine);
+                auto c = RandomVector(m * ldc, engine);
+                auto expected = c;
+
+                for (std::size_t numR = 0; numR < m; ++numR)
+                {
+                    for (std::size_t numC = 0; numC < n; ++numC)
+                    {
+                        float sum = 0.0f;
+
+                        for (std::size_t numK = 0; numK < k; ++numK)
+                        {
+                            sum += a[isTransA ? numK * lda + numR
+                                              : numR * lda + numK] *
+                                   b[isTransB ? numC * ldb + numK
+                                              : numK * ldb + numC];
+                        }
+
+                        expected[numR * ldc + numC] =
+                            alpha * sum + beta * c[numR * ldc + numC];
+                    }
+                }
+
+                Compute::GEMM::Gemm(transA, transB, m, n, k, alpha, ToSpan(a),
+                                    lda, ToSpan(b), ldb, beta, ToSpan(c), ldc);
+
+                for (std::size_t index = 0; index < expected.size(); ++index)
+                {
+                    CHECK(c[index] ==
+                          doctest::Approx(expected[index]).epsilon(1e-3));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("[GEMM] - Int8")
+{
+    const auto isa = Compute::KernelRegistry::Active().isa;
+    std::mt19937 engine(3);
+
+    // Integer accumulation is exact, so every kernel has to match exactly.
+    for (const auto candidate : { Compute::ISA::Scalar, Compute::ISA::SSE42,
+                                  Compute::ISA::AVX2, Compute::ISA::AVX512 })
+    {
+        if (Compute::CPUInfo::IsSupported(candidate))
+        {
+            Compute::KernelRegistry::Bind(candidate);
+            CheckInt8Gemm<std::uint8_t>(engine);
+            CheckInt8Gemm<std::int8_t>(engine);
+        }
+    }
+
+    Compute::KernelRegistry::Bind(isa);
+}
+
+TEST_CASE("[GEMM] - Half")
+{
+    const auto isa = Compute::KernelRegistry::Active().isa;
+    std::mt19937 engine(5);
+
+    for (const auto candidate : { Compute::ISA::Scalar, Compute::ISA::SSE42,
+                                  Compute::ISA::AVX2, Compute::ISA::AVX512 })
+    {
+        if (Compute::CPUInfo::IsSupported(candidate))
+        {
+            Compute::KernelRegistry::Bind(candidate);
+            CheckHalfGemm<Core::BFloat16>(engine);
+            CheckHalfGemm<Core::Float16>(engine);
+        }
+    }
+
+    Compute::KernelRegistry::Bind(isa);
+}
+
+TEST_CASE("[GEMM] - Batched")
+{
+    using Transpose = Compute::GEMM::Transpose;
+
+    const auto isa = Compute::KernelRegistry::Active().isa;
+    std::mt19937 engine(9);
+
+    // m, n, k and batch count. The last two shapes are too large for the
+    // single-block path, and the very last has fewer products than threads
+    // on most machines.
+    const std::size_t shapeList[][4] = { { 16, 16, 16, 50 },
+                                         { 5, 37, 9, 7 },
+                                         { 33, 48, 20, 13 },
+                                         { 64, 64, 64, 10 },
+                                         { 150, 40, 300, 4 },
+                                         { 200, 190, 210, 1 } };
+
+    for (const auto candidate : { Compute::ISA::Scalar, Compute::ISA::SSE42,
+                                  Compute::ISA::AVX2, Compute::ISA::AVX512 })
+    {
+        if (!Compute::CPUInfo::IsSupported(candidate))
+        {
+            continue;
+        }
+
+        Compute::KernelRegistry::Bind(candidate);
+
+        for (const auto& shape : shapeList)
+        {
+            const std::size_t m = shape[0], n = shape[1], k = shape[2];
+            const std::size_t batchCount = shape[3];
+
+            for (const auto transB : { Transpose::NoTrans, Transpose::Trans })
+            {
+                const Transpose transA = transB;
+                const bool isTrans = transB == Transpose::Trans;
+                const float alpha = 0.5f, beta = isTrans ? 0.0f : -1.5f;
+
+                const std::size_t lda = (isTrans ? m : k) + 1;
+                const std::size_t ldb = (isTrans ? k : n) + 2;
+                const std::size_t ldc = n + 3;
+                // Gaps between the matrices must be left alone.
+                const std::size_t strideA = (isTrans ? k : m) * lda + 5;
+                const std::size_t strideB = (isTrans ? n : k) * ldb + 6;
+                const std::size_t strideC = m * ldc + 7;
+
+                auto a = RandomVector(batchCount * strideA, engine);
+                auto b = RandomVector(batchCount * strideB, engine);
+                auto c = RandomVector(batchCount * strideC, engine);
+                auto expected = c;
+
+                for (std::size_t numB = 0; numB < batchCount; ++numB)
+                {
+                    const float* aBatch = a.data() + numB * strideA;
+                    const float* bBatch = b.data() + numB * strideB;
+                    const float* cBatch = c.data() + numB * strideC;
+                    float* expectedBatch = expected.data() + numB * strideC;
+
+                    for (std::size_t numR = 0; numR < m; ++numR)
+                    {
+                        for (std::size_t numC = 0; numC < n; ++numC)
+                        {
+                            float sum = 0.0f;
+
+                            for (std::size_t numK = 0; numK < k; ++numK)
+                            {
+                                sum += aBatch[isTrans ? numK * lda + numR
+                                                      : numR * lda + numK] *
+                                       bBatch[isTrans ? numC * ldb + numK
+                                                      : numK * ldb + numC];
+                            }
+
+                            expectedBatch[numR * ldc + numC] =
+                                alpha * sum + beta * cBatch[numR * ldc + numC];
+                        }
+                    }
+                }
+
+                Compute::GEMM::GemmStridedBatched(
+                    transA, transB, m, n, k, alpha, ToSpan(a), lda, strideA,
+                    ToSpan(b), ldb, strideB, beta, ToSpan(c), ldc, strideC,
+                    batchCount);
+
+                for (std::size_t index = 0; index < expected.size(); ++index)
+                {
+                    CHECK(c[index] ==
+                          doctest::Approx(expected[index]).epsilon(1e-3));
+                }
+            }
+        }
+    }
+
+    Compute::KernelRegistry::Bind(isa);
+}
+
+TEST_CASE("[GEMM] - MultiplyBatched")
+{
+    std::mt19937 engine(10);
+
+    const std::size_t batchCount = 24, maxIndex = 32, numRow = 16;
+    const std::size_t numColumn = 48;
+
+    auto left = RandomVector(batchCount * numRow * maxIndex, engine);
+    auto right = RandomVector(batchCount * numColumn * maxIndex, engine);
+    auto destination = RandomVector(batchCount * numRow * numColumn, engine);
+    std::vector<float> expected(destination.size(), 0.0f);
+
+    for (std::size_t numB = 0; numB < batchCount; ++numB)
+    {
+        const std::size_t offset = numB * numRow * numColumn;
+
+        Compute::GEMM::Multiply(
+            maxIndex, numRow, numColumn,
+            Core::Span<float>(left.data() + numB * numRow * maxIndex,
+                              numRow * maxIndex),
+            Core::Span<float>(right.data() + numB * numColumn * maxIndex,
+                              numColumn * maxIndex),
+            Core::Span<float>(expected.data() + offset, numRow * numColumn));
+    }
+
+    Compute::GEMM::MultiplyBatched(batchCount, maxIndex, numRow, numColumn,
+                                   ToSpan(left), ToSpan(right),
+                                   ToSpan(destination));
+
+    for (std::size_t index = 0; index < expected.size(); ++index)
+    {
+        CHECK(destination[index] ==
+              doctest::Approx(expected[index]).epsilon(1e-4));
+    }
+}
+
+TEST_CASE("[GEMM] - Epilogue")
+{
+    using Transpose = Compute::GEMM::Transpose;
+
+    std::mt19937 engine(11);
+
+    // m, n and k: fringe tiles, several K blocks, several row blocks, and no
+    // product at all.
+    const std::size_t shapeList[][3] = {
+        { 7, 5, 3 }, { 37, 21, 600 }, { 300, 70, 10 }, { 4, 9, 0 }
+    };
+
+    for (const auto& shape : shapeList)
+    {
+        const std::size_t m = shape[0], n = shape[1], k = shape[2];
+        const std::size_t ldc = n + 3;
+
+        auto a = RandomVector(m * k, engine);
+        auto b = RandomVector(n * k, engine);
+        auto bias = RandomVector(n, engine);
+
+        for (const float beta : { 0.0f, 1.0f })
+        {
+            auto c = RandomVector(m * ldc, engine);
+            auto expected = c;
+
+            for (std::size_t numR = 0; numR < m; ++numR)
+            {
+                for (std::size_t numC = 0; numC < n; ++numC)
+                {
+                    float sum = beta * c[numR * ldc + numC] + bias[numC];
+
+                    for (std::size_t numK = 0; numK < k; ++numK)
+                    {
+                        sum += a[numR * k + numK] * b[numC * k + numK];
+                    }
+
+                    expected[numR * ldc + numC] = sum < 0.0f ? 0.1f * sum : sum;
+                }
+            }
+
+            Compute::GEMM::Gemm(Transpose::NoTrans, Transpose::Trans, m, n, k,
+                                1.0f, ToSpan(a), k, ToSpan(b), k, beta,
+                                ToSpan(c), ldc, { bias.data(), true, 0.1f });
+
+            for (std::size_t index = 0; index < expected.size(); ++index)
+            {
+                CHECK(c[index] ==
+                      doctest::Approx(expected[index]).epsilon(1e-3));
+            }
+        }
+    }
+
+    // The GEMV path applies it to each group of batch rows.
+    const std::size_t maxIndex = 50, numRow = 11, numColumn = 13;
+    auto left = RandomVector(numRow * maxIndex, engine);
+    auto right = RandomVector(numColumn * maxIndex, engine);
+    auto bias = RandomVector(numColumn, engine);
+    std::vector<float> destination(numRow * numColumn, 0.0f);
+    std::vector<float> expected(numRow * numColumn);
+
+    for (std::size_t numR = 0; numR < numRow; ++numR)
+    {
+        for (std::size_t numC = 0; numC < numColumn; ++numC)
+        {
+            float sum = bias[numC];
+
+            for (std::size_t numIndex = 0; numIndex < maxIndex; ++numIndex)
+            {
+                sum += left[numR * maxIndex + numIndex] *
+                       right[numC * maxIndex + numIndex];
+            }
+
+            expected[numR * numColumn + numC] = sum < 0.0f ? 0.0f : sum;
+        }
+    }
+
+    Compute::GEMM::MultiplyAddGEMV(maxIndex, numRow, numColumn, ToSpan(left),
+                                   ToSpan(right), ToSpan(destination),
+                                   { bias.data(), true, 0.0f });
+
+    for (std::size_t index = 0; index < expected.size(); ++index)
+    {
+        CHECK(destination[index] ==
+              doctest::Approx(expected[index]).epsilon(1e-3));
+    }
+}
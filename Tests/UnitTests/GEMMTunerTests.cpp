@@ -0,0 +1,85 @@
+#include "doctest.h"
+
+#include <CubbyDNN/Compute/GEMMTuner.hpp>
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CubbyDNN;
+
+TEST_CASE("[GEMMTuner] - Autotune")
+{
+    using Transpose = Compute::GEMM::Transpose;
+
+    const bool isAutotune = Compute::GEMMTuner::IsAutotune();
+    const std::string path = "GEMMTunerTests.txt";
+
+    const std::size_t m = 9, n = 70, k = 600;
+
+    std::mt19937 engine(2);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    std::vector<float> a(m * k), b(k * n), c(m * n);
+
+    for (auto* vector : { &a, &b, &c })
+    {
+        for (auto& value : *vector)
+        {
+            value = dist(engine);
+        }
+    }
+
+    auto expected = c;
+
+    for (std::size_t numR = 0; numR < m; ++numR)
+    {
+        for (std::size_t numC = 0; numC < n; ++numC)
+        {
+            for (std::size_t numK = 0; numK < k; ++numK)
+            {
+                expected[numR * n + numC] += a[numR * k + numK] *
+                                             b[numK * n + numC];
+            }
+        }
+    }
+
+    Compute::GEMMTuner::Clear();
+    Compute::GEMMTuner::SetAutotune(true);
+
+    // Tuning runs the candidates on a copy of c; beta = 1 has to apply to
+    // the original values exactly once.
+    Compute::GEMM::Gemm(Transpose::NoTrans, Transpose::NoTrans, m, n, k, 1.0f,
+                        Core::Span<float>(a.data(), a.size()), k,
+                        Core::Span<float>(b.data(), b.size()), n, 1.0f,
+                        Core::Span<float>(c.data(), c.size()), n);
+
+    for (std::size_t index = 0; index < expected.size(); ++index)
+    {
+        CHECK(c[index] == doctest::Approx(expected[index]).epsilon(1e-3));
+    }
+
+    const Compute::GEMMSignature signature{ Transpose::NoTrans,
+                                            Transpose::NoTrans, m, n, k };
+    Compute::GEMMConfig tuned{};
+    CHECK(Compute::GEMMTuner::Lookup(signature, tuned));
+    CHECK(Compute::CPUInfo::IsSupported(tuned.isa));
+
+    // The winner survives a round trip through the tuning file.
+    Compute::GEMMTuner::Save(path);
+    Compute::GEMMTuner::Clear();
+
+    Compute::GEMMConfig loaded{};
+    CHECK(!Compute::GEMMTuner::Lookup(signature, loaded));
+    CHECK(Compute::GEMMTuner::Load(path));
+    CHECK(Compute::GEMMTuner::Lookup(signature, loaded));
+    CHECK(loaded == tuned);
+
+    std::remove(path.c_str());
+
+    CHECK(!Compute::GEMMTuner::Load(path));
+
+    Compute::GEMMTuner::Clear();
+    Compute::GEMMTuner::SetAutotune(isAutotune);
+}
@@ -0,0 +1,175 @@
+#include "doctest.h"
+
+#include <CubbyDNN/Compute/Convert.hpp>
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Parameter.hpp>
+#include <CubbyDNN/Optimizer/Momentum.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+// Normal fp32 values of every magnitude binary16 covers, plus exact ties and
+// values that overflow it. Subnormal inputs are left out: vcvtneps2bf16
+// flushes them to zero.
+std::vector<float> ConversionInput()
+{
+    std::mt19937 engine(6);
+    std::uniform_real_distribution<float> mantissa(1.0f, 2.0f);
+    std::uniform_int_distribution<int> exponent(-24, 17);
+    std::vector<float> result = { 0.0f,
+                                  -0.0f,
+                                  1.0f + 1.0f / 2048.0f,
+                                  1.0f + 3.0f / 2048.0f,
+                                  1.0f + 1.0f / 256.0f,
+                                  65504.0f,
+                                  65520.0f,
+                                  1e30f,
+                                  -std::numeric_limits<float>::infinity(),
+                                  std::numeric_limits<float>::quiet_NaN() };
+
+    while (result.size() < 1003)
+    {
+        const float value = std::ldexp(mantissa(engine), exponent(engine));
+        result.push_back(result.size() % 2 ? value : -value);
+    }
+
+    return result;
+}
+
+bool IsSame(float lhs, float rhs)
+{
+    return (std::isnan(lhs) && std::isnan(rhs)) || lhs == rhs;
+}
+
+template <typename T>
+void CheckConversion()
+{
+    auto input = ConversionInput();
+    std::vector<T> narrow(input.size());
+    std::vector<float> widened(input.size());
+
+    Compute::Convert::FromFloat(Core::Span<float>(input.data(), input.size()),
+                                Core::Span<T>(narrow.data(), narrow.size()));
+    Compute::Convert::ToFloat(Core::Span<T>(narrow.data(), narrow.size()),
+                              Core::Span<float>(widened.data(),
+                                                widened.size()));
+
+    // The kernels have to round exactly like the scalar conversion.
+    for (std::size_t index = 0; index < input.size(); ++index)
+    {
+        const auto expected = T::FromFloat(input[index]);
+
+        CHECK(IsSame(narrow[index].ToFloat(), expected.ToFloat()));
+        CHECK(IsSame(widened[index], expected.ToFloat()));
+    }
+}
+}  // namespace
+
+TEST_CASE("[Half] - Scalar conversion")
+{
+    // Ties round to even.
+    CHECK(Core::Float16::FromFloat(1.0f + 1.0f / 2048.0f).ToFloat() == 1.0f);
+    CHECK(Core::Float16::FromFloat(1.0f + 3.0f / 2048.0f).ToFloat() ==
+          1.0f + 2.0f / 1024.0f);
+    CHECK(Core::BFloat16::FromFloat(1.0f + 1.0f / 256.0f).ToFloat() == 1.0f);
+
+    CHECK(Core::Float16::FromFloat(65504.0f).ToFloat() == 65504.0f);
+    CHECK(std::isinf(Core::Float16::FromFloat(65520.0f).ToFloat()));
+    CHECK(std::isnan(
+        Core::BFloat16::FromFloat(std::numeric_limits<float>::quiet_NaN())
+            .ToFloat()));
+
+    // Every finite binary16 value, subnormals included, survives a round
+    // trip through fp32.
+    for (std::uint32_t bits = 0; bits < 0x10000u; ++bits)
+    {
+        const Core::Float16 value{ static_cast<std::uint16_t>(bits) };
+
+        if ((bits & 0x7C00u) != 0x7C00u)
+        {
+            CHECK(Core::Float16::FromFloat(value.ToFloat()).bits == bits);
+        }
+    }
+}
+
+TEST_CASE("[Half] - Conversion kernels")
+{
+    const auto isa = Compute::KernelRegistry::Active().isa;
+
+    for (const auto candidate : { Compute::ISA::Scalar, Compute::ISA::SSE42,
+                                  Compute::ISA::AVX2, Compute::ISA::AVX512 })
+    {
+        if (Compute::CPUInfo::IsSupported(candidate))
+        {
+            Compute::KernelRegistry::Bind(candidate);
+            CheckConversion<Core::BFloat16>();
+            CheckConversion<Core::Float16>();
+        }
+    }
+
+    Compute::KernelRegistry::Bind(isa);
+}
+
+TEST_CASE("[Half] - Dense with a half-precision weight")
+{
+    const std::size_t numInput = 300, numOutput = 10;
+
+    for (const auto precision :
+         { Core::Precision::BFloat16, Core::Precision::Float16 })
+    {
+        for (const std::size_t batchSize : { 1, 32 })
+        {
+            Core::Graph graph;
+
+            auto input = graph.Builder().Input("input");
+            auto weight = graph.Builder().Parameter(
+                "weight", Core::Shape{ numOutput, numInput },
+                graph.Builder().InitXavier(7, numInput, numOutput));
+            auto halfWeight = graph.Builder().Parameter(
+                "halfWeight", Core::Shape{ numOutput, numInput },
+                graph.Builder().InitXavier(7, numInput, numOutput),
+                precision);
+            auto bias =
+                graph.Builder().Parameter("bias", Core::Shape{ numOutput },
+                                          graph.Builder().InitConstant(0.1f));
+
+            auto dense = graph.Builder().Dense(input, weight, bias);
+            auto halfDense = graph.Builder().Dense(input, halfWeight, bias);
+
+            std::mt19937 engine(8);
+            std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+            std::vector<float> data(numInput * batchSize);
+
+            for (auto& value : data)
+            {
+                value = dist(engine);
+            }
+
+            graph.Feed({ { "input", Core::Shape{ numInput, batchSize },
+                           Core::Span<float>(data.data(), data.size()) } });
+
+            const auto expected = dense.EvalOutput().Output();
+            const auto output = halfDense.EvalOutput().Output();
+
+            // Only the weight is rounded; bf16 keeps 8 significant bits.
+            for (std::size_t index = 0; index < expected.Length(); ++index)
+            {
+                CHECK(std::abs(output[index] - expected[index]) <=
+                      0.02f * (1.0f + std::abs(expected[index])));
+            }
+
+            auto* parameter = graph.Node<Node::Parameter>("halfWeight");
+            CHECK(parameter->GetParameter().Length() == 0);
+            CHECK_THROWS(Optimizer::Momentum(0.9f, { parameter }));
+        }
+    }
+}
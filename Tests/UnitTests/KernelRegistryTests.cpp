@@ -0,0 +1,73 @@
+#include "doctest.h"
+
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+
+#include <cstdlib>
+#include <string_view>
+
+using namespace CubbyDNN;
+
+TEST_CASE("[KernelRegistry] - Tables of unsupported ISAs")
+{
+    CHECK(Compute::KernelRegistry::Get(Compute::ISA::Scalar).isa ==
+          Compute::ISA::Scalar);
+
+    for (const auto candidate : { Compute::ISA::SSE42, Compute::ISA::AVX2,
+                                  Compute::ISA::AVX512 })
+    {
+        if (Compute::CPUInfo::IsSupported(candidate))
+        {
+            CHECK(Compute::KernelRegistry::Get(candidate).isa == candidate);
+            continue;
+        }
+
+        // Falls back without running the builder of the ISA.
+        CHECK(Compute::KernelRegistry::Get(candidate).isa ==
+              Compute::CPUInfo::SupportedISA());
+        CHECK(!Compute::KernelRegistry::IsBuilt(candidate));
+    }
+}
+
+TEST_CASE("[KernelRegistry] - Names of CUBBYDNN_ISA values")
+{
+    Compute::ISA isa = Compute::ISA::Scalar;
+
+    CHECK(Compute::CPUInfo::Parse("avx2", isa));
+    CHECK(isa == Compute::ISA::AVX2);
+    CHECK(Compute::CPUInfo::Parse("AVX512", isa));
+    CHECK(isa == Compute::ISA::AVX512);
+    CHECK(Compute::CPUInfo::Parse("sse42", isa));
+    CHECK(isa == Compute::ISA::SSE42);
+    CHECK(Compute::CPUInfo::Parse("SSE4.2", isa));
+    CHECK(isa == Compute::ISA::SSE42);
+    CHECK(Compute::CPUInfo::Parse("Scalar", isa));
+    CHECK(isa == Compute::ISA::Scalar);
+
+    CHECK(!Compute::CPUInfo::Parse("avx", isa));
+    CHECK(!Compute::CPUInfo::Parse("avx2 ", isa));
+    CHECK(!Compute::CPUInfo::Parse("", isa));
+    CHECK(isa == Compute::ISA::Scalar);
+}
+
+// Has to be the only case run in its process, as other cases build the
+// tables they loop over:
+// CUBBYDNN_ISA=scalar UnitTests -tc="*CUBBYDNN_ISA*" --no-skip
+TEST_CASE("[KernelRegistry] - Scalar only under CUBBYDNN_ISA" *
+          doctest::skip())
+{
+    const char* value = std::getenv("CUBBYDNN_ISA");
+
+    REQUIRE(value);
+    REQUIRE(std::string_view(value) == "scalar");
+
+    CHECK(Compute::KernelRegistry::Active().isa == Compute::ISA::Scalar);
+    CHECK(Compute::KernelRegistry::Get(Compute::ISA::Scalar).isa ==
+          Compute::ISA::Scalar);
+    CHECK(Compute::KernelRegistry::IsBuilt(Compute::ISA::Scalar));
+
+    for (const auto other : { Compute::ISA::SSE42, Compute::ISA::AVX2,
+                              Compute::ISA::AVX512 })
+    {
+        CHECK(!Compute::KernelRegistry::IsBuilt(other));
+    }
+}
\ No newline at end of file
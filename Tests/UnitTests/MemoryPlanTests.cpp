@@ -0,0 +1,88 @@
+#include "doctest.h"
+#include "TestUtils.hpp"
+
+#include <CubbyDNN/Core/Graph.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+using Test::ToVector;
+
+const Test::MLPLayout Layout{ 5, 20, 48, 10 };
+
+// A ReLU MLP deep enough for the plan to reuse buffers several times over.
+struct Network : Test::MLP
+{
+    Network() : MLP(Layout), hidden(hiddenList[3])
+    {
+        Feed(9, 13, 6.0f, 1.0f);
+    }
+
+    std::vector<float> Gradient(const std::string& name)
+    {
+        return ToVector(graph.Node(name)->EvalGradient(loss).Gradient());
+    }
+
+    Node::Node* hidden;
+};
+}  // namespace
+
+TEST_CASE("[MemoryPlan] - Inference")
+{
+    Network reference, planned;
+
+    const auto expectedLoss = ToVector(reference.loss->EvalOutput().Output());
+    const auto expectedHidden =
+        ToVector(reference.hidden->EvalOutput().Output());
+
+    const auto& plan =
+        planned.graph.PlanMemory({ planned.loss }, Core::PlanMode::Inference);
+
+    CHECK(plan.Mode() == Core::PlanMode::Inference);
+    CHECK(plan.BufferCount() > 0);
+    CHECK(plan.PlannedSize() < plan.NaiveSize());
+
+    CHECK(ToVector(planned.loss->EvalOutput().Output()) == expectedLoss);
+
+    // The hidden layer's buffer was reused on the way to the loss, so it is
+    // recomputed when read again.
+    CHECK(ToVector(planned.hidden->EvalOutput().Output()) == expectedHidden);
+    CHECK(ToVector(planned.loss->EvalOutput().Output()) == expectedLoss);
+
+    CHECK_THROWS(planned.Gradient("w0"));
+
+    planned.graph.ClearMemoryPlan();
+
+    CHECK(ToVector(planned.loss->EvalOutput().Output()) == expectedLoss);
+    CHECK(planned.Gradient("w0") == reference.Gradient("w0"));
+}
+
+TEST_CASE("[MemoryPlan] - Training")
+{
+    Network reference, planned;
+
+    const auto& plan =
+        planned.graph.PlanMemory({ planned.loss }, Core::PlanMode::Training);
+
+    CHECK(plan.PlannedSize() < plan.NaiveSize());
+
+    for (std::size_t index = 0; index < Layout.numLayer; ++index)
+    {
+        const auto id = std::to_string(index);
+
+        CHECK(planned.Gradient("w" + id) == reference.Gradient("w" + id));
+        CHECK(planned.Gradient("b" + id) == reference.Gradient("b" + id));
+    }
+
+    // Every parameter again, now that the later ones have overwritten the
+    // gradients the earlier ones were accumulated from.
+    CHECK(planned.Gradient("w0") == reference.Gradient("w0"));
+    CHECK(planned.Gradient("w3") == reference.Gradient("w3"));
+
+    CHECK_THROWS(planned.graph.PlanMemory({ planned.loss, planned.hidden },
+                                          Core::PlanMode::Training));
+}
@@ -0,0 +1,299 @@
+#include "doctest.h"
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Core/Half.hpp>
+#include <CubbyDNN/Core/Memory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+template <typename T>
+bool IsCacheLineAligned(const Core::Memory<T>& memory)
+{
+    return reinterpret_cast<std::uintptr_t>(memory.GetSpan().begin()) %
+               Core::CacheLineSize ==
+           0;
+}
+
+template <typename T>
+void CheckAllocation()
+{
+    for (const std::size_t size : { 1, 3, 16, 17, 1000 })
+    {
+        Core::Memory<T> memory(size);
+
+        CHECK(IsCacheLineAligned(memory));
+        CHECK(memory.Size() == size);
+        CHECK(memory.Capacity() >= size);
+        CHECK(memory.Capacity() * sizeof(T) % Core::CacheLineSize == 0);
+
+        // The padding is zeroed along with the elements.
+        const auto* bytes =
+            reinterpret_cast<const unsigned char*>(memory.GetSpan().begin());
+
+        CHECK(std::all_of(bytes, bytes + memory.Capacity() * sizeof(T),
+                          [](unsigned char byte) { return byte == 0; }));
+    }
+}
+
+// Counts the blocks it hands out, so that tests can see what a pool keeps.
+class CountingAllocator final : public Core::Allocator
+{
+ public:
+    void* Allocate(std::size_t numByte) override
+    {
+        ++allocateCount;
+        liveByte += numByte;
+
+        return m_system.Allocate(numByte);
+    }
+
+    void Deallocate(void* pointer, std::size_t numByte) noexcept override
+    {
+        liveByte -= numByte;
+        m_system.Deallocate(pointer, numByte);
+    }
+
+    std::atomic<std::size_t> allocateCount{ 0 };
+    std::atomic<std::size_t> liveByte{ 0 };
+
+ private:
+    Core::SystemAllocator m_system;
+};
+
+// Output of a ReLU Dense layer on a fixed input.
+std::vector<float> EvalLayer(Core::Graph& graph)
+{
+    auto& builder = graph.Builder();
+
+    auto x = builder.Input("x");
+    auto w = builder.Parameter("w", Core::Shape{ 96, 64 },
+                               builder.InitXavier(3, 64, 96));
+    auto b = builder.Parameter("b", Core::Shape{ 96 },
+                               builder.InitConstant(0.5f));
+    auto y = builder.ReLU(builder.Dense(x, w, b));
+
+    std::vector<float> input(64 * 50);
+    for (std::size_t index = 0; index < input.size(); ++index)
+    {
+        input[index] = static_cast<float>(index % 13) - 6.0f;
+    }
+
+    graph.Feed({ { "x", Core::Shape{ 64, 50 },
+                   Core::Span<float>(input.data(), input.size()) } });
+
+    const auto output = y.EvalOutput().Output();
+    std::vector<float> result(output.Length());
+    std::copy(output.begin(), output.end(), result.begin());
+
+    return result;
+}
+}  // namespace
+
+TEST_CASE("[Memory] - Aligned allocation")
+{
+    CheckAllocation<float>();
+    CheckAllocation<std::int8_t>();
+    CheckAllocation<std::int32_t>();
+    CheckAllocation<std::size_t>();
+    CheckAllocation<Core::BFloat16>();
+
+    Core::Memory<float> memory(5);
+    memory.GetSpan().FillScalar(2.0f);
+
+    // Growing past the padded capacity reallocates on a cache line.
+    const float* begin = memory.GetSpan().begin();
+    memory.Resize(memory.Capacity());
+    CHECK(memory.GetSpan().begin() == begin);
+
+    memory.Resize(memory.Capacity() + 1);
+    CHECK(IsCacheLineAligned(memory));
+
+    Core::Memory<float> source(37);
+    source.GetSpan().FillScalar(3.0f);
+
+    const Core::Memory<float> copy(source);
+    CHECK(IsCacheLineAligned(copy));
+    CHECK(copy.Size() == 37);
+
+    for (const float value : copy.GetSpan())
+    {
+        CHECK(value == 3.0f);
+    }
+}
+
+TEST_CASE("[Memory] - Pooled allocation")
+{
+    for (std::size_t numByte = 1; numByte < (1 << 24);
+         numByte = numByte * 3 + 1)
+    {
+        const std::size_t classSize = Core::PoolAllocator::ClassSize(numByte);
+
+        CHECK(classSize >= numByte);
+        CHECK(classSize % Core::CacheLineSize == 0);
+        CHECK((classSize <= 4 * Core::CacheLineSize ||
+               classSize * 4 <= numByte * 5));
+    }
+
+    CountingAllocator upstream;
+
+    {
+        Core::PoolAllocator pool(upstream);
+
+        // A freed block is handed out again for any size in its class.
+        void* block = pool.Allocate(1000);
+        pool.Deallocate(block, 1000);
+        CHECK(pool.Allocate(900) == block);
+        CHECK(upstream.allocateCount == 1);
+
+        auto statistics = pool.Statistics();
+        CHECK(statistics.hitCount == 1);
+        CHECK(statistics.missCount == 1);
+        CHECK(statistics.cachedByte == 0);
+
+        void* other = pool.Allocate(100000);
+        pool.Deallocate(block, 900);
+        pool.Deallocate(other, 100000);
+
+        statistics = pool.Statistics();
+        CHECK(statistics.cachedByte ==
+              Core::PoolAllocator::ClassSize(1000) +
+                  Core::PoolAllocator::ClassSize(100000));
+        CHECK(upstream.liveByte == statistics.cachedByte);
+
+        // Trimming releases the largest blocks first.
+        CHECK(pool.Trim(2000) == Core::PoolAllocator::ClassSize(100000));
+        CHECK(pool.Statistics().cachedByte ==
+              Core::PoolAllocator::ClassSize(1000));
+
+        // Memory takes its buffers from the default allocator, and gives
+        // them back to the allocator they came from.
+        Core::SetDefaultAllocator(&pool);
+        Core::Memory<float> memory(250);
+        CHECK(&Core::DefaultAllocator() == &pool);
+        CHECK(pool.Statistics().hitCount == 2);
+        Core::SetDefaultAllocator(nullptr);
+        CHECK(&Core::DefaultAllocator() == &Core::StandardPool());
+        CHECK(pool.Statistics().cachedByte == 0);
+
+        // Growing it takes the new buffer from the standard pool.
+        memory.Resize(100000);
+        CHECK(IsCacheLineAligned(memory));
+        CHECK(pool.Statistics().cachedByte ==
+              Core::PoolAllocator::ClassSize(1000));
+        CHECK(pool.Statistics().missCount == 2);
+
+        // Threads sharing the pool.
+        std::vector<std::thread> threadList;
+
+        for (std::size_t thread = 0; thread < 4; ++thread)
+        {
+            threadList.emplace_back([&pool, thread] {
+                for (std::size_t index = 0; index < 1000; ++index)
+                {
+                    const std::size_t numByte = 64 * (1 + (index + thread) % 7);
+                    void* pointer = pool.Allocate(numByte);
+                    static_cast<unsigned char*>(pointer)[numByte - 1] = 1;
+                    pool.Deallocate(pointer, numByte);
+                }
+            });
+        }
+
+        for (auto& thread : threadList)
+        {
+            thread.join();
+        }
+
+        statistics = pool.Statistics();
+        CHECK(statistics.hitCount + statistics.missCount == 4004);
+        CHECK(upstream.liveByte == statistics.cachedByte);
+    }
+
+    // The pool returns everything it cached when it is destroyed.
+    CHECK(upstream.liveByte == 0);
+}
+
+TEST_CASE("[Memory] - Page placement")
+{
+    const Core::AllocationPolicy policyList[] = {
+        { Core::HugePagePolicy::Transparent, Core::NUMAPolicy::FirstTouch,
+          4096 },
+        { Core::HugePagePolicy::Explicit, Core::NUMAPolicy::Interleave,
+          4096 },
+        { Core::HugePagePolicy::None, Core::NUMAPolicy::ParallelFirstTouch,
+          4096 },
+    };
+
+    for (const auto& policy : policyList)
+    {
+        Core::PageAllocator allocator(policy);
+
+        // Both sides of minMappedByte.
+        for (const std::size_t size : { 100, 1000, 3 << 20 })
+        {
+            Core::Memory<float> memory(size, allocator);
+
+            CHECK(IsCacheLineAligned(memory));
+            CHECK(memory.GetSpan()[size - 1] == 0.0f);
+
+            memory.GetSpan().FillScalar(1.0f);
+            CHECK(memory.GetSpan()[size - 1] == 1.0f);
+        }
+
+        // A graph under the policy computes what the default one does.
+        Core::Graph defaultGraph, placedGraph(policy);
+
+        CHECK(&defaultGraph.BufferAllocator() == &Core::DefaultAllocator());
+        CHECK(&placedGraph.BufferAllocator() != &Core::DefaultAllocator());
+        CHECK(EvalLayer(placedGraph) == EvalLayer(defaultGraph));
+    }
+}
+
+TEST_CASE("[Memory] - Scratch stack")
+{
+    float* outer;
+    float* inner;
+
+    {
+        const Core::ScratchMemory<float> first(100);
+        outer = first.Data();
+        std::fill_n(outer, 100, 1.0f);
+
+        // Taken while the first is in use, as by a task run during a wait.
+        {
+            const Core::ScratchMemory<float> second(1000);
+            inner = second.Data();
+
+            CHECK(inner != outer);
+            std::fill_n(inner, 1000, 2.0f);
+        }
+
+        CHECK(std::all_of(outer, outer + 100,
+                          [](float value) { return value == 1.0f; }));
+    }
+
+    // Buffers are kept from one use to the next.
+    const Core::ScratchMemory<float> first(50);
+    const Core::ScratchMemory<float> second(500);
+
+    CHECK(first.Data() == outer);
+    CHECK(second.Data() == inner);
+    CHECK(IsCacheLineAligned(Core::Memory<float>::View(second.Data(), 500)));
+
+    // Each thread has a stack of its own.
+    float* other = nullptr;
+
+    std::thread([&] {
+        const Core::ScratchMemory<float> scratch(50);
+        other = scratch.Data();
+    }).join();
+
+    CHECK(other != outer);
+}
@@ -0,0 +1,124 @@
+#include "doctest.h"
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Parameter.hpp>
+#include <CubbyDNN/Optimizer/Momentum.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace CubbyDNN;
+
+TEST_CASE("[Node] - Zero-copy outputs")
+{
+    Core::Graph graph;
+    auto& builder = graph.Builder();
+
+    auto x = builder.Input("x");
+    auto w = builder.Parameter("w", Core::Shape{ 4, 3 },
+                               builder.InitXavier(1, 3, 4));
+    auto b = builder.Parameter("b", Core::Shape{ 4 },
+                               builder.InitConstant(0.25f));
+    auto h = builder.Parameter("h", Core::Shape{ 4, 3 },
+                               builder.InitConstant(0.5f),
+                               Core::Precision::BFloat16);
+    auto y = builder.Dense(x, w, b);
+
+    auto* weight = graph.Node<Node::Parameter>("w");
+
+    std::vector<float> first(3 * 2, 1.0f), second(3 * 5, 2.0f);
+
+    // The input is the fed data itself, however often it is fed.
+    graph.Feed({ { "x", Core::Shape{ 3, 2 },
+                   Core::Span<float>(first.data(), first.size()) } });
+    CHECK(x.EvalOutput().Output().begin() == first.data());
+
+    graph.Feed({ { "x", Core::Shape{ 3, 5 },
+                   Core::Span<float>(second.data(), second.size()) } });
+    CHECK(x.EvalOutput().Output().begin() == second.data());
+    CHECK(x.Output().Length() == second.size());
+
+    // A Float32 parameter is its values; a half-precision one is widened
+    // into a buffer of its own.
+    CHECK(w.EvalOutput().Output().begin() == weight->GetParameter().begin());
+    CHECK(h.EvalOutput().Output().begin() != nullptr);
+    CHECK(h.Output()[0] == 0.5f);
+
+    const auto before = y.EvalOutput().Output()[0];
+
+    // Updating the values in place shows through the view on the next
+    // evaluation.
+    Optimizer::Momentum optimizer(0.9f, { weight });
+    optimizer.Reduce(0.1f, y);
+
+    CHECK(w.EvalOutput().Output().begin() == weight->GetParameter().begin());
+    CHECK(y.EvalOutput().Output()[0] != before);
+
+    // Once sparsified there are no dense values left to view.
+    std::vector<float> dense(weight->GetParameter().begin(),
+                             weight->GetParameter().end());
+    weight->Sparsify(Compute::SparseFormat::CSR);
+
+    const auto output = w.EvalOutput().Output();
+    CHECK(std::vector<float>(output.begin(), output.end()) == dense);
+}
+
+TEST_CASE("[Node] - Dependencies")
+{
+    Core::Graph graph;
+    auto& builder = graph.Builder();
+
+    auto x = builder.Input("x");
+    auto a = builder.ReLU(x);
+    auto b = builder.ReLU(a);
+    auto c = builder.ReLU(x);
+    auto d = builder.SoftmaxCE(b, c);
+
+    // Ids in order of creation.
+    CHECK(graph.NodeCount() == 5);
+    CHECK(x.node->Id() == 0);
+    CHECK(d.node->Id() == 4);
+
+    CHECK(graph.IsDependOn(d, x));
+    CHECK(graph.IsDependOn(b, a));
+    CHECK(!graph.IsDependOn(b, c));
+    CHECK(!graph.IsDependOn(x, x));
+    CHECK(x.node->HasRevDeps(d));
+    CHECK(!c.node->HasRevDeps(b));
+    CHECK(d["label"]->IsDependOn(x));
+    CHECK(!d["prob"]->IsDependOn(a));
+
+    // Each node after its inputs, and after its consumers.
+    const auto deps = graph.SortDeps({ d });
+    const auto position = [&deps](Node::Node* node) {
+        return std::find(deps.begin(), deps.end(), node) - deps.begin();
+    };
+
+    CHECK(deps.size() == 5);
+    CHECK(position(x) < position(a));
+    CHECK(position(a) < position(b));
+    CHECK(position(x) < position(c));
+    CHECK(position(b) < position(d));
+    CHECK(position(c) < position(d));
+    CHECK((graph.SortRevDeps({ a }) ==
+           std::vector<Node::Node*>{ d, b, a }));
+
+    // Attaching an input is seen by the next query.
+    auto e = builder.ReLU(d);
+    CHECK(graph.IsDependOn(e, x));
+
+    // Deep graphs are walked without recursion.
+    Node::Node* node = e;
+
+    for (std::size_t index = 0; index < 100000; ++index)
+    {
+        node = builder.ReLU(node);
+    }
+
+    CHECK(graph.SortDeps({ node }).size() == graph.NodeCount());
+    CHECK(graph.IsDependOn(node, x));
+
+    // A node created after the last query about the same node.
+    auto z = builder.Input("z");
+    CHECK(!graph.IsDependOn(node, z));
+}
@@ -0,0 +1,118 @@
+#include "doctest.h"
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Core/Shape.hpp>
+#include <CubbyDNN/Node/Parameter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+// The largest error of output relative to the largest value of expected.
+float RelativeError(Core::Span<float> output, Core::Span<float> expected)
+{
+    float maxError = 0.0f, maxValue = 0.0f;
+
+    for (std::size_t index = 0; index < expected.Length(); ++index)
+    {
+        maxError =
+            std::max(maxError, std::abs(output[index] - expected[index]));
+        maxValue = std::max(maxValue, std::abs(expected[index]));
+    }
+
+    return maxError / maxValue;
+}
+}  // namespace
+
+TEST_CASE("[QuantizedDense] - Forward")
+{
+    const std::size_t numInput = 40, numOutput = 12;
+
+    for (const std::size_t batchSize : { 1, 5, 64 })
+    {
+        Core::Graph graph;
+
+        auto input = graph.Builder().Input("input");
+        auto weight = graph.Builder().Parameter(
+            "weight", Core::Shape{ numOutput, numInput },
+            graph.Builder().InitXavier(1, numInput, numOutput));
+        auto bias =
+            graph.Builder().Parameter("bias", Core::Shape{ numOutput },
+                                      graph.Builder().InitConstant(0.1f));
+
+        auto dense = graph.Builder().Dense(input, weight, bias);
+        auto quantized = graph.Builder().QuantizedDense(input, weight, bias);
+
+        std::mt19937 engine(4);
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        std::vector<float> data(numInput * batchSize);
+
+        for (auto& value : data)
+        {
+            value = dist(engine);
+        }
+
+        graph.Feed({ { "input", Core::Shape{ numInput, batchSize },
+                       Core::Span<float>(data.data(), data.size()) } });
+
+        const auto expected = dense.EvalOutput().Output();
+        const auto output = quantized.EvalOutput().Output();
+
+        CHECK(quantized.node->Shape() == dense.node->Shape());
+
+        // 8-bit input and 7-bit-or-better weights keep the error within a
+        // few percent of the output range.
+        CHECK(RelativeError(output, expected) <= 0.03f);
+
+        CHECK_THROWS(weight.node->EvalGradient(quantized));
+    }
+}
+
+TEST_CASE("[QuantizedDense] - Weight updates")
+{
+    const std::size_t numInput = 24, numOutput = 8, batchSize = 3;
+    Core::Graph graph;
+
+    auto input = graph.Builder().Input("input");
+    auto weight = graph.Builder().Parameter(
+        "weight", Core::Shape{ numOutput, numInput },
+        graph.Builder().InitXavier(2, numInput, numOutput));
+    auto bias = graph.Builder().Parameter(
+        "bias", Core::Shape{ numOutput }, graph.Builder().InitConstant(0.0f));
+
+    auto dense = graph.Builder().Dense(input, weight, bias);
+    auto quantized = graph.Builder().QuantizedDense(input, weight, bias);
+    std::vector<float> data(numInput * batchSize);
+
+    for (std::size_t index = 0; index < data.size(); ++index)
+    {
+        data[index] = static_cast<float>(index % 5) / 4.0f;
+    }
+
+    graph.Feed({ { "input", Core::Shape{ numInput, batchSize },
+                   Core::Span<float>(data.data(), data.size()) } });
+
+    const auto before = quantized.EvalOutput().Output();
+    const std::vector<float> beforeList(before.begin(), before.end());
+
+    // The same shape with other values, marked dirty as an optimizer step
+    // leaves it.
+    auto* parameter = graph.Node<Node::Parameter>("weight");
+
+    for (auto& value : parameter->GetParameter())
+    {
+        value = -value;
+    }
+
+    parameter->MarkDirty(false);
+
+    const auto output = quantized.EvalOutput().Output();
+
+    CHECK(RelativeError(output, dense.EvalOutput().Output()) <= 0.03f);
+    CHECK(!std::equal(beforeList.begin(), beforeList.end(), output.begin()));
+}
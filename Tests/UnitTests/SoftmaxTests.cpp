@@ -0,0 +1,227 @@
+#include "doctest.h"
+
+#include <CubbyDNN/Compute/KernelRegistry.hpp>
+#include <CubbyDNN/Compute/Softmax.hpp>
+#include <CubbyDNN/Core/Graph.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+bool IsClose(float lhs, float rhs)
+{
+    return std::abs(lhs - rhs) <= 1e-6f + 1e-5f * std::abs(rhs);
+}
+
+bool IsClose(const std::vector<float>& lhs, const std::vector<float>& rhs)
+{
+    return lhs.size() == rhs.size() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin(),
+                      [](float a, float b) { return IsClose(a, b); });
+}
+
+// Spread over [-8, 8) without a pattern the groups could line up with.
+std::vector<float> Values(std::size_t size, std::size_t seed)
+{
+    std::vector<float> result(size);
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        result[index] =
+            static_cast<float>((index * 7919 + seed * 104729) % 1601) / 100.0f -
+            8.0f;
+    }
+
+    return result;
+}
+
+// Softmax and its gradient with each value sorted into its group by the
+// coordinates along the axes left out of groupAxis, in double precision.
+void Reference(const Core::Shape& shape, const std::vector<bool>& groupAxis,
+               const std::vector<float>& x, const std::vector<float>& dy,
+               std::vector<float>& y, std::vector<float>& dx)
+{
+    std::vector<std::size_t> keyList(x.size());
+
+    for (std::size_t index = 0; index < x.size(); ++index)
+    {
+        std::size_t rest = index, key = 0;
+
+        for (std::size_t axis = 0; axis < shape.Rank(); ++axis)
+        {
+            if (!groupAxis[axis])
+            {
+                key = key * shape[axis] + rest % shape[axis];
+            }
+
+            rest /= shape[axis];
+        }
+
+        keyList[index] = key;
+    }
+
+    std::map<std::size_t, double> maxMap, sumMap, dotMap;
+
+    for (std::size_t index = 0; index < x.size(); ++index)
+    {
+        const auto found = maxMap.find(keyList[index]);
+
+        if (found == maxMap.end() || found->second < x[index])
+        {
+            maxMap[keyList[index]] = x[index];
+        }
+    }
+
+    for (std::size_t index = 0; index < x.size(); ++index)
+    {
+        sumMap[keyList[index]] += std::exp(x[index] - maxMap[keyList[index]]);
+    }
+
+    y.resize(x.size());
+
+    for (std::size_t index = 0; index < x.size(); ++index)
+    {
+        y[index] = static_cast<float>(
+            std::exp(x[index] - maxMap[keyList[index]]) /
+            sumMap[keyList[index]]);
+        dotMap[keyList[index]] += static_cast<double>(dy[index]) * y[index];
+    }
+
+    dx.resize(x.size());
+
+    for (std::size_t index = 0; index < x.size(); ++index)
+    {
+        dx[index] = 1.0f + static_cast<float>(
+                               y[index] * (dy[index] - dotMap[keyList[index]]));
+    }
+}
+
+void CheckSoftmax(const Core::Shape& shape, const std::vector<bool>& groupAxis)
+{
+    const auto x = Values(shape.Size(), 0);
+    const auto dy = Values(shape.Size(), 1);
+    std::vector<float> expected, expectedGradient;
+
+    Reference(shape, groupAxis, x, dy, expected, expectedGradient);
+
+    auto input = x, gradient = dy;
+    std::vector<float> y(x.size()), dx(x.size(), 1.0f);
+    const auto layout = Compute::Softmax::Layout(shape, groupAxis);
+
+    Compute::Softmax::Forward(layout, 0.0f,
+                              Core::Span<float>(input.data(), input.size()),
+                              Core::Span<float>(y.data(), y.size()));
+    Compute::Softmax::BackwardAdd(
+        layout, Core::Span<float>(y.data(), y.size()),
+        Core::Span<float>(gradient.data(), gradient.size()),
+        Core::Span<float>(dx.data(), dx.size()));
+
+    CHECK(IsClose(y, expected));
+    CHECK(IsClose(dx, expectedGradient));
+}
+}  // namespace
+
+TEST_CASE("[Softmax] - Max and exp kernels")
+{
+    for (const auto candidate : { Compute::ISA::Scalar, Compute::ISA::SSE42,
+                                  Compute::ISA::AVX2, Compute::ISA::AVX512 })
+    {
+        if (!Compute::CPUInfo::IsSupported(candidate))
+        {
+            continue;
+        }
+
+        const auto& kernel = Compute::KernelRegistry::Get(candidate).softmax;
+
+        // Every length up to two AVX-512 vectors and past them.
+        for (std::size_t length = 0; length <= 1000;
+             length += length < 33 ? 1 : 967)
+        {
+            auto x = Values(length, length);
+            std::vector<float> y(length);
+            double expectedSum = 0.0;
+
+            // The maximum anywhere, the vector loop or the tail.
+            if (length)
+            {
+                x[length / 2] = 9.0f;
+            }
+
+            CHECK(kernel.reduceMax(length, x.data()) ==
+                  (length ? 9.0f : -std::numeric_limits<float>::infinity()));
+
+            const float sum =
+                kernel.shiftedExp(length, 1.5f, x.data(), y.data());
+            bool isEqual = true;
+
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                const auto expected = std::exp(x[index] - 1.5f);
+
+                isEqual = isEqual && IsClose(y[index], expected);
+                expectedSum += expected;
+            }
+
+            CHECK(isEqual);
+            CHECK(IsClose(sum, static_cast<float>(expectedSum)));
+
+            // In place, as grouped positions run it.
+            CHECK(kernel.shiftedExp(length, 1.5f, x.data(), x.data()) == sum);
+            CHECK(x == y);
+        }
+
+        // Masked logits come out as zero, not as the smallest float.
+        std::vector<float> x = { -std::numeric_limits<float>::infinity(),
+                                 -200.0f, 0.0f };
+        const std::vector<float> expected = { 0.0f, 0.0f, 1.0f };
+        std::vector<float> y(x.size());
+
+        CHECK(kernel.shiftedExp(x.size(), 0.0f, x.data(), y.data()) == 1.0f);
+        CHECK(y == expected);
+    }
+}
+
+TEST_CASE("[Softmax] - Grouped axes")
+{
+    // Every way of grouping three axes, including none and all of them.
+    for (std::size_t flag = 0; flag < 8; ++flag)
+    {
+        CheckSoftmax({ 3, 4, 5 }, { (flag & 1) != 0, (flag & 2) != 0,
+                                    (flag & 4) != 0 });
+    }
+
+    // Axes of size 1 between axes with the same flag.
+    CheckSoftmax({ 6, 1, 7 }, { true, false, true });
+    CheckSoftmax({ 6, 1, 7 }, { false, true, false });
+
+    // Positions of their own past one chunk, and many small groups.
+    CheckSoftmax({ Compute::Softmax::ChunkSize + 37, 3 }, { false, true });
+    CheckSoftmax({ 10, 10000 }, { true, false });
+}
+
+TEST_CASE("[Softmax] - Per-group maximum")
+{
+    // Two groups a thousand apart. A maximum over the whole logit would
+    // underflow every exponential of the second.
+    Core::Graph graph;
+    auto logit = graph.Builder().Input("logit");
+    auto softmax = graph.Builder().Softmax(logit, { true, false });
+    std::vector<float> data = { 1000.0f, 1001.0f, -1000.0f, -999.0f };
+
+    graph.Feed({ { "logit", Core::Shape{ 2, 2 },
+                   Core::Span<float>(data.data(), data.size()) } });
+
+    const auto output = softmax.EvalOutput().Output();
+    const float low = 1.0f / (1.0f + std::exp(1.0f));
+
+    CHECK(IsClose(output[0], low));
+    CHECK(IsClose(output[1], 1.0f - low));
+    CHECK(IsClose(output[2], low));
+    CHECK(IsClose(output[3], 1.0f - low));
+}
\ No newline at end of file
@@ -0,0 +1,198 @@
+#include "doctest.h"
+#include "TestUtils.hpp"
+
+#include <CubbyDNN/Compute/GEMM.hpp>
+#include <CubbyDNN/Compute/Sparse.hpp>
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Parameter.hpp>
+#include <CubbyDNN/Optimizer/Momentum.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+using Test::ToSpan;
+
+// Random values with roughly the given fraction of them zeroed.
+std::vector<float> PrunedVector(std::size_t size, float sparsity,
+                                std::mt19937& engine)
+{
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::bernoulli_distribution isPruned(sparsity);
+    std::vector<float> result(size);
+
+    for (auto& value : result)
+    {
+        value = isPruned(engine) ? 0.0f : dist(engine);
+    }
+
+    return result;
+}
+
+constexpr Compute::SparseFormat FormatList[] = {
+    Compute::SparseFormat::CSR, Compute::SparseFormat::Block4x4,
+    Compute::SparseFormat::Block8x1
+};
+}  // namespace
+
+TEST_CASE("[Sparse] - Compression")
+{
+    std::mt19937 engine(11);
+
+    // 13 x 37 leaves partial blocks on both edges for every format.
+    const std::size_t numRow = 13, numColumn = 37;
+    auto dense = PrunedVector(numRow * numColumn, 0.85f, engine);
+    std::size_t numNonZero = 0;
+
+    for (const float value : dense)
+    {
+        numNonZero += value != 0.0f;
+    }
+
+    for (const auto format : FormatList)
+    {
+        const auto matrix = Compute::Sparse::FromDense(
+            format, numRow, numColumn, ToSpan(dense));
+        std::vector<float> restored(dense.size(), 1.0f);
+
+        Compute::Sparse::ToDense(matrix, ToSpan(restored));
+
+        CHECK(restored == dense);
+        CHECK(matrix.values.Size() >= numNonZero);
+        CHECK(matrix.values.Size() < dense.size());
+    }
+
+    const auto csr = Compute::Sparse::FromDense(
+        Compute::SparseFormat::CSR, numRow, numColumn, ToSpan(dense));
+
+    CHECK(csr.values.Size() == numNonZero);
+    CHECK(csr.rowOffset.Size() == numRow + 1);
+}
+
+TEST_CASE("[Sparse] - Products")
+{
+    std::mt19937 engine(12);
+
+    const std::size_t numRow = 29, numColumn = 70;
+
+    for (const auto format : FormatList)
+    {
+        for (const std::size_t batchSize : { 1, 3, 40 })
+        {
+            auto weight = PrunedVector(numRow * numColumn, 0.8f, engine);
+            auto input = PrunedVector(batchSize * numColumn, 0.0f, engine);
+            auto gradient = PrunedVector(batchSize * numRow, 0.0f, engine);
+            const auto matrix = Compute::Sparse::FromDense(
+                format, numRow, numColumn, ToSpan(weight));
+
+            auto output = PrunedVector(batchSize * numRow, 0.0f, engine);
+            auto expectedOutput = output;
+
+            Compute::Sparse::MultiplyAdd(batchSize, ToSpan(input), matrix,
+                                         ToSpan(output));
+            Compute::GEMM::MultiplyAdd(numColumn, batchSize, numRow,
+                                       ToSpan(input), ToSpan(weight),
+                                       ToSpan(expectedOutput));
+
+            for (std::size_t index = 0; index < output.size(); ++index)
+            {
+                CHECK(output[index] ==
+                      doctest::Approx(expectedOutput[index]).epsilon(1e-4));
+            }
+
+            auto destination =
+                PrunedVector(batchSize * numColumn, 0.0f, engine);
+            auto expectedDestination = destination;
+
+            Compute::Sparse::dMultiplyAddLeft(batchSize, ToSpan(gradient),
+                                              matrix, ToSpan(destination));
+            Compute::GEMM::dMultiplyAddLeft(
+                numColumn, batchSize, numRow, ToSpan(gradient), ToSpan(weight),
+                ToSpan(expectedDestination));
+
+            for (std::size_t index = 0; index < destination.size(); ++index)
+            {
+                CHECK(destination[index] ==
+                      doctest::Approx(expectedDestination[index])
+                          .epsilon(1e-4));
+            }
+        }
+    }
+}
+
+TEST_CASE("[Sparse] - Dense with a sparse weight")
+{
+    const std::size_t numInput = 50, numOutput = 21, batchSize = 6;
+
+    for (const auto format : FormatList)
+    {
+        Core::Graph graph;
+        std::mt19937 engine(13);
+
+        auto input = graph.Builder().Input("input");
+        auto weight = graph.Builder().Parameter(
+            "weight", Core::Shape{ numOutput, numInput },
+            graph.Builder().InitConstant(0.0f));
+        auto sparseWeight = graph.Builder().Parameter(
+            "sparseWeight", Core::Shape{ numOutput, numInput },
+            graph.Builder().InitConstant(0.0f));
+        auto bias =
+            graph.Builder().Parameter("bias", Core::Shape{ numOutput },
+                                      graph.Builder().InitConstant(0.1f));
+
+        auto dense = graph.Builder().Dense(input, weight, bias);
+        auto sparseDense = graph.Builder().Dense(input, sparseWeight, bias);
+
+        auto* parameter = graph.Node<Node::Parameter>("weight");
+        auto* sparseParameter = graph.Node<Node::Parameter>("sparseWeight");
+        const auto pruned = PrunedVector(numOutput * numInput, 0.9f, engine);
+
+        std::copy(pruned.begin(), pruned.end(),
+                  parameter->GetParameter().begin());
+        std::copy(pruned.begin(), pruned.end(),
+                  sparseParameter->GetParameter().begin());
+        sparseParameter->Sparsify(format);
+
+        CHECK(sparseParameter->GetParameter().Length() == 0);
+        CHECK_THROWS(sparseParameter->Sparsify(format));
+
+        auto data = PrunedVector(numInput * batchSize, 0.0f, engine);
+
+        graph.Feed({ { "input", Core::Shape{ numInput, batchSize },
+                       ToSpan(data) } });
+
+        const auto expected = dense.EvalOutput().Output();
+        const auto output = sparseDense.EvalOutput().Output();
+
+        for (std::size_t index = 0; index < expected.Length(); ++index)
+        {
+            CHECK(output[index] ==
+                  doctest::Approx(expected[index]).epsilon(1e-4));
+        }
+
+        // The parameter still reads back as a dense matrix.
+        const auto restored = sparseWeight.EvalOutput().Output();
+
+        for (std::size_t index = 0; index < pruned.size(); ++index)
+        {
+            CHECK(restored[index] == pruned[index]);
+        }
+
+        // The input gradient buffer is shared, so keep a copy of the first.
+        const auto denseGradient = input.node->EvalGradient(dense).Gradient();
+        const std::vector<float> expectedGradient(denseGradient.begin(),
+                                                  denseGradient.end());
+        const auto gradient = input.node->EvalGradient(sparseDense).Gradient();
+
+        for (std::size_t index = 0; index < expectedGradient.size(); ++index)
+        {
+            CHECK(gradient[index] ==
+                  doctest::Approx(expectedGradient[index]).epsilon(1e-4));
+        }
+
+        CHECK_THROWS(Optimizer::Momentum(0.9f, { sparseParameter }));
+    }
+}
@@ -0,0 +1,172 @@
+#ifndef CUBBYDNN_TEST_UTILS_HPP
+#define CUBBYDNN_TEST_UTILS_HPP
+
+#include <CubbyDNN/Core/Graph.hpp>
+#include <CubbyDNN/Node/Parameter.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace CubbyDNN::Test
+{
+//! A copy of span, which stays as it is when the buffer is written again.
+inline std::vector<float> ToVector(Core::Span<float> span)
+{
+    std::vector<float> result(span.Length());
+    std::copy(span.begin(), span.end(), result.begin());
+
+    return result;
+}
+
+inline Core::Span<float> ToSpan(std::vector<float>& vector)
+{
+    return Core::Span<float>(vector.data(), vector.size());
+}
+
+//! size values drawn uniformly from [-1, 1).
+inline std::vector<float> RandomVector(std::size_t size,
+                                       std::mt19937& engine)
+{
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> result(size);
+
+    for (auto& value : result)
+    {
+        value = dist(engine);
+    }
+
+    return result;
+}
+
+//! The sizes of an MLP of numLayer Dense layers, numInput wide at the input,
+//! width wide in between and numClass wide at the output.
+struct MLPLayout
+{
+    std::size_t numLayer;
+    std::size_t numInput;
+    std::size_t width;
+    std::size_t numClass;
+    //! Whether the layers between the first and the last share one weight
+    //! and bias, which then accumulate gradients from several consumers.
+    bool isMiddleShared = false;
+};
+
+//! Adds an MLP over x to graph: leaky ReLU layers, the last a Softmax over
+//! axis 0 instead. Weights are Xavier-initialized with the index of their
+//! layer as the seed and biases start at 0.1, so that MLPs of the same
+//! layout compute the same values. Parameters are named "w" and "b" after
+//! that index and suffix. The Dense and activation nodes are appended to
+//! hiddenList in evaluation order, the parameters to parameterList, and the
+//! Softmax is returned.
+inline Node::Node* AddMLP(Core::Graph& graph, Node::Node* x,
+                          const MLPLayout& layout, const std::string& suffix,
+                          std::vector<Node::Node*>& hiddenList,
+                          std::vector<Node::Parameter*>& parameterList)
+{
+    auto& builder = graph.Builder();
+    Node::Node* layer = x;
+    std::size_t fanIn = layout.numInput;
+
+    for (std::size_t index = 0; index < layout.numLayer; ++index)
+    {
+        const bool isLast = index + 1 == layout.numLayer;
+        const std::size_t fanOut = isLast ? layout.numClass : layout.width;
+
+        // A shared layer reads the parameters of the first of them.
+        const auto id =
+            std::to_string(layout.isMiddleShared && index > 1 && !isLast
+                               ? 1
+                               : index) +
+            suffix;
+
+        if (!graph.Node("w" + id))
+        {
+            builder.Parameter("w" + id, Core::Shape{ fanOut, fanIn },
+                              builder.InitXavier(index, fanIn, fanOut));
+            builder.Parameter("b" + id, Core::Shape{ fanOut },
+                              builder.InitConstant(0.1f));
+            parameterList.emplace_back(graph.Node<Node::Parameter>("w" + id));
+            parameterList.emplace_back(graph.Node<Node::Parameter>("b" + id));
+        }
+
+        hiddenList.emplace_back(builder.Dense(layer, graph.Node("w" + id),
+                                              graph.Node("b" + id)));
+        layer = isLast ? builder.Softmax(hiddenList.back(), { true, false })
+                       : builder.ReLU(hiddenList.back(), .01f);
+        hiddenList.emplace_back(layer);
+        fanIn = fanOut;
+    }
+
+    return layer;
+}
+
+//! AddMLP over input "x", followed by a SoftmaxCE against one-hot labels
+//! "y", in a graph of its own.
+struct MLP
+{
+    explicit MLP(const MLPLayout& _layout)
+        : layout(_layout), prob(nullptr), loss(nullptr)
+    {
+        auto& builder = graph.Builder();
+        auto x = builder.Input("x");
+        auto y = builder.Input("y");
+
+        prob = AddMLP(graph, x, layout, "", hiddenList, parameterList);
+        loss = builder.SoftmaxCE(y, prob);
+    }
+
+    //! Feeds batchSize samples of x[index] = (index % period) / scale -
+    //! offset, labelled with one class after another.
+    void Feed(std::size_t batchSize, std::size_t period, float scale,
+              float offset)
+    {
+        input.resize(layout.numInput * batchSize);
+        label.assign(layout.numClass * batchSize, 0.0f);
+
+        for (std::size_t index = 0; index < input.size(); ++index)
+        {
+            input[index] = static_cast<float>(index % period) / scale - offset;
+        }
+
+        for (std::size_t index = 0; index < batchSize; ++index)
+        {
+            label[index * layout.numClass + index % layout.numClass] = 1.0f;
+        }
+
+        graph.Feed(
+            { { "x", Core::Shape{ layout.numInput, batchSize }, ToSpan(input) },
+              { "y", Core::Shape{ layout.numClass, batchSize },
+                ToSpan(label) } });
+    }
+
+    //! One Node::EvalGradient of the loss per parameter.
+    std::vector<std::vector<float>> Gradients()
+    {
+        std::vector<std::vector<float>> result;
+
+        for (auto* parameter : parameterList)
+        {
+            result.emplace_back(
+                ToVector(parameter->EvalGradient(loss).Gradient()));
+        }
+
+        return result;
+    }
+
+    const MLPLayout layout;
+
+    std::vector<float> input;
+    std::vector<float> label;
+
+    Core::Graph graph;
+    //! The Dense and activation nodes, in evaluation order.
+    std::vector<Node::Node*> hiddenList;
+    std::vector<Node::Parameter*> parameterList;
+    Node::Node* prob;
+    Node::Node* loss;
+};
+}  // namespace CubbyDNN::Test
+
+#endif
@@ -0,0 +1,198 @@
+#include "doctest.h"
+#include "TestUtils.hpp"
+
+#include <CubbyDNN/Compute/GEMM.hpp>
+#include <CubbyDNN/Core/ThreadPool.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace CubbyDNN;
+
+namespace
+{
+using Test::RandomVector;
+using Test::ToSpan;
+
+// Makes a pool of numThread threads the default for as long as it lives, so
+// that the parallel paths run even on a machine with a single core.
+struct ScopedPool
+{
+    explicit ScopedPool(std::size_t numThread) : pool(numThread)
+    {
+        Core::SetDefaultThreadPool(&pool);
+    }
+
+    ~ScopedPool()
+    {
+        Core::SetDefaultThreadPool(nullptr);
+    }
+
+    Core::ThreadPool pool;
+};
+
+// c = a(m x k) * b(k x n) on the pool, checked against a naive product.
+void CheckGemm(std::size_t m, std::size_t n, std::size_t k)
+{
+    std::mt19937 engine(static_cast<unsigned int>(m + n + k));
+    auto a = RandomVector(m * k, engine);
+    auto b = RandomVector(k * n, engine);
+    std::vector<float> c(m * n, 1.0f);
+
+    Compute::GEMM::Gemm(Compute::GEMM::Transpose::NoTrans,
+                        Compute::GEMM::Transpose::NoTrans, m, n, k, 1.0f,
+                        ToSpan(a), k, ToSpan(b), n, 0.0f, ToSpan(c), n);
+
+    bool isEqual = true;
+
+    for (std::size_t numR = 0; numR < m; ++numR)
+    {
+        for (std::size_t numC = 0; numC < n; ++numC)
+        {
+            double expected = 0.0;
+
+            for (std::size_t numK = 0; numK < k; ++numK)
+            {
+                expected += static_cast<double>(a[numR * k + numK]) *
+                            b[numK * n + numC];
+            }
+
+            isEqual = isEqual &&
+                      std::abs(c[numR * n + numC] - expected) < 1e-3 * k;
+        }
+    }
+
+    CHECK(isEqual);
+}
+}  // namespace
+
+TEST_CASE("[ThreadPool] - ParallelFor")
+{
+    Core::ThreadPool pool(4);
+
+    CHECK(pool.ThreadCount() == 4);
+
+    for (const std::size_t count : { 0, 1, 7, 1000 })
+    {
+        for (const std::size_t grain : { 1, 3, 250 })
+        {
+            std::vector<std::atomic<int>> hitList(count);
+            std::atomic<bool> isWithinGrain{ true };
+
+            pool.ParallelFor(count, grain, 4,
+                             [&](std::size_t begin, std::size_t end) {
+                                 if (end - begin > grain)
+                                 {
+                                     isWithinGrain = false;
+                                 }
+
+                                 for (auto index = begin; index < end; ++index)
+                                 {
+                                     ++hitList[index];
+                                 }
+                             });
+
+            CHECK(isWithinGrain);
+
+            bool isOnce = true;
+
+            for (const auto& hit : hitList)
+            {
+                isOnce = isOnce && hit == 1;
+            }
+
+            CHECK(isOnce);
+        }
+    }
+
+    // Loops started from inside a loop share the same threads.
+    std::atomic<std::size_t> sum{ 0 };
+
+    pool.ParallelFor(16, 1, 4, [&](std::size_t outer, std::size_t) {
+        pool.ParallelFor(100, 10, 4, [&](std::size_t begin, std::size_t end) {
+            for (auto index = begin; index < end; ++index)
+            {
+                sum += outer * 100 + index;
+            }
+        });
+    });
+
+    CHECK(sum == 1600 * 1599 / 2);
+}
+
+TEST_CASE("[ThreadPool] - Exceptions")
+{
+    Core::ThreadPool pool(3);
+
+    CHECK_THROWS(pool.ParallelFor(64, 1, 3, [](std::size_t begin, std::size_t) {
+        if (begin == 40)
+        {
+            throw std::runtime_error("failed");
+        }
+    }));
+
+    // The pool is still usable afterwards.
+    std::atomic<std::size_t> count{ 0 };
+    Core::TaskGroup group(pool);
+
+    for (std::size_t index = 0; index < 32; ++index)
+    {
+        group.Run([&count] { ++count; });
+    }
+
+    group.Wait();
+    CHECK(count == 32);
+}
+
+TEST_CASE("[ThreadPool] - Kernels")
+{
+    ScopedPool scopedPool(4);
+
+    // Blocked over four threads, and split along K for an output with
+    // fewer register tiles than threads.
+    CheckGemm(300, 200, 700);
+    CheckGemm(16, 16, 32768);
+
+    std::mt19937 engine(1);
+    std::uniform_int_distribution<int> dist(-64, 64);
+    const std::size_t m = 64, n = 256, k = 512;
+    std::vector<std::uint8_t> a(m * k);
+    std::vector<std::int8_t> b(n * k);
+    std::vector<std::int32_t> c(m * n);
+
+    for (auto& value : a)
+    {
+        value = static_cast<std::uint8_t>(dist(engine) + 64);
+    }
+
+    for (auto& value : b)
+    {
+        value = static_cast<std::int8_t>(dist(engine));
+    }
+
+    Compute::GEMM::GemmU8S8(m, n, k, Core::Span<std::uint8_t>(a.data(), m * k),
+                            k, Core::Span<std::int8_t>(b.data(), n * k), k,
+                            Core::Span<std::int32_t>(c.data(), m * n), n);
+
+    bool isEqual = true;
+
+    for (std::size_t numR = 0; numR < m; ++numR)
+    {
+        for (std::size_t numC = 0; numC < n; ++numC)
+        {
+            std::int32_t expected = 0;
+
+            for (std::size_t numK = 0; numK < k; ++numK)
+            {
+                expected += a[numR * k + numK] * b[numC * k + numK];
+            }
+
+            isEqual = isEqual && c[numR * n + numC] == expected;
+        }
+    }
+
+    CHECK(isEqual);
+}